@@ -16,8 +16,28 @@
  */
 #include <lib.hpp>
 #include <env.hpp>
+#include <mmap.hpp>
+#include <workers.hpp>
+#include <stream.hpp>
+#include <multiline.hpp>
 #include <parser.hpp>
 
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#if !defined(_WIN32) && !defined(_WIN64)
+	#include <poll.h>
+	#include <strings.h>
+#endif
+
 /**
  * Подключаем модуль файловой системы
  */
@@ -45,15 +65,21 @@ static void help(const string & name) noexcept {
 		"\x1B[33m\x1B[1m+\x1B[0m Flag for convert notation: \x1B[1m[-notation | --notation]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Flag for generating headers when parsing CSV files: \x1B[1m[-header | --header]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Flag for generating a readable file format (XML or JSON): \x1B[1m[-prettify | --prettify]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Flag for record-by-record conversion of stdin or -src file with constant memory, implied by NDJSON (TEXT | JSON | CSV | CEF | SYSLOG | GROK | BASE64 | XML with -record): \x1B[1m[-stream | --stream]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Flag for profiling GROK expressions on stdin or -src file, reports match cost of every subpattern: \x1B[1m[-grokProfile | --grokProfile]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Joining continuation lines into one event in stream mode (INDENT = lines starting with a space or tab continue the event, otherwise a regular expression matching the first line of an event): \x1B[1m[-multiline <value> | --multiline=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Maximum number of lines of one multiline event (default: 500): \x1B[1m[-multilineLines <value> | --multilineLines=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Maximum size of one multiline event in bytes (default: 1048576): \x1B[1m[-multilineBytes <value> | --multilineBytes=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Time in milliseconds after which a pending multiline event read from stdin is flushed (default: 0 = wait for the next event): \x1B[1m[-multilineTimeout <value> | --multilineTimeout=<value>]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Display application version: \x1B[1m[-version | --version | -V]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Display information about available application functions: \x1B[1m[-info | --info | -H]\x1B[0m\r\n\r\n"
 		"\x1B[34m\x1B[1m[ARGS]\x1B[0m\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m CEF file parsing mode: \x1B[1m[-cef <value> | --cef=<value>]\x1B[0m\r\n"
 		"\x1B[32m\x1B[1m  -\x1B[0m (LOW | MEDIUM | STRONG)\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Format of the file from which reading is performed: \x1B[1m[-from <value> | --from=<value>]\x1B[0m\r\n"
-		"\x1B[32m\x1B[1m  -\x1B[0m (XML | JSON | INI | YAML | CSV | CEF | SYSLOG | GROK | TEXT | BASE64)\r\n\r\n"
+		"\x1B[32m\x1B[1m  -\x1B[0m (XML | JSON | NDJSON | INI | YAML | CSV | CEF | SYSLOG | GROK | TEXT | BASE64)\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m File format to which the writing is made: \x1B[1m[-to <value> | --to=<value>]\x1B[0m\r\n"
-		"\x1B[32m\x1B[1m  -\x1B[0m (XML | JSON | INI | YAML | CSV | CEF | SYSLOG | TEXT | BASE64 | MD5 | SHA1 | SHA224 | SHA256 | SHA384 | SHA512)\r\n\r\n"
+		"\x1B[32m\x1B[1m  -\x1B[0m (XML | JSON | NDJSON | INI | YAML | CSV | CEF | SYSLOG | TEXT | BASE64 | MD5 | SHA1 | SHA224 | SHA256 | SHA384 | SHA512)\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Format date (if required): \x1B[1m[-formatDate \"<value>\" | --formatDate=\"<value>\"]\x1B[0m\r\n"
 		"\x1B[32m\x1B[1m  -\x1B[0m ( %%m/%%d/%%Y %%H:%%M:%%S | %%H:%%M:%%S %%d.%%m.%%Y | ... )\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Logging level (if required): \x1B[1m[-logLevel <value> | --logLevel=<value>]\x1B[0m\r\n"
@@ -63,9 +89,17 @@ static void help(const string & name) noexcept {
 		"\x1B[33m\x1B[1m+\x1B[0m File or directory address for saving converted files: \x1B[1m[-dest <value> | --dest=<value>]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Separator for parsing CSV files (default: \";\"): \x1B[1m[-delim <value> | --delim=<value>]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Address of the file or directory with files to convert: \x1B[1m[-src <value> | --src=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Name of the repeated XML element converted as a separate record in stream mode: \x1B[1m[-record <value> | --record=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Number of threads for converting files of a directory, chunks of a large CSV file or blocks of GROK lines in stream mode (0 = all CPU cores, default: 1): \x1B[1m[-threads <value> | --threads=<value>]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Address of the file in JSON format with GROK templates: \x1B[1m[-patterns <value> | --patterns=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Address of the precompiled GROK bundle (loaded instead of building templates, created if missing or outdated): \x1B[1m[-bundle <value> | --bundle=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Maximum number of PCRE2 match steps for one GROK expression on one line (default: PCRE2 limit): \x1B[1m[-matchLimit <value> | --matchLimit=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Maximum PCRE2 backtracking depth for GROK expressions without JIT (default: PCRE2 limit): \x1B[1m[-depthLimit <value> | --depthLimit=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Maximum size of the JIT stack of each thread in bytes for GROK expressions (default: 32768): \x1B[1m[-jitStack <value> | --jitStack=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Time budget in microseconds for matching one line against GROK expressions, checked after each expression (a running match is not interrupted, use -matchLimit for that), lines over budget are skipped even when the last expression matched: \x1B[1m[-timeBudget <value> | --timeBudget=<value>]\x1B[0m\r\n\r\n"
 		"\x1B[33m\x1B[1m+\x1B[0m Date format for generating date from UnixTimeStamp: \x1B[1m[-formatDate <value> | --formatDate=<value>]\x1B[0m\r\n\r\n"
-		"\x1B[33m\x1B[1m+\x1B[0m Address of the file with the regular expression in GROK format: \x1B[1m[-express <value> | --express=<value>]\x1B[0m\r\n\r\n";
+		"\x1B[33m\x1B[1m+\x1B[0m Address of the file with the regular expression in GROK format: \x1B[1m[-express <value> | --express=<value>]\x1B[0m\r\n\r\n"
+		"\x1B[33m\x1B[1m+\x1B[0m Flag for reading the -express file as a list of alternative GROK expressions (one per line, tried in order, the first match wins): \x1B[1m[-expressList | --expressList]\x1B[0m\r\n\r\n";
 		// Выводим сообщение справки
 		::printf(msg.c_str(), name.c_str());
 	}
@@ -193,8 +227,44 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 		string name = "", text = "";
 		// Создаём формат даты
 		string formatDate = DATE_FORMAT;
+		// Флаг потоковой обработки данных из stdin
+		bool stream = false;
+		// Флаг профилирования регулярных выражений GROK
+		bool profile = false;
+		// Выполняем поиск флагов потоковой обработки и профилирования среди параметров запуска
+		for(int32_t i = 1; i < count; i++){
+			/**
+			 * Выполняем работу для Windows
+			 */
+			#if defined(_WIN32) || defined(_WIN64)
+				// Определяем передан ли флаг потоковой обработки (формат NDJSON и многострочные события всегда обрабатываются по записям)
+				stream = (stream || (
+					(::wcscmp(params[i], L"-stream") == 0) || (::wcscmp(params[i], L"--stream") == 0) ||
+					(::wcscmp(params[i], L"-multiline") == 0) || (::wcsncmp(params[i], L"--multiline=", 12) == 0) ||
+					(::_wcsicmp(params[i], L"ndjson") == 0) || (::_wcsicmp(params[i], L"--from=ndjson") == 0) || (::_wcsicmp(params[i], L"--to=ndjson") == 0)
+				));
+				// Определяем передан ли флаг профилирования (корпус строк читается целиком)
+				profile = (profile || (::wcscmp(params[i], L"-grokProfile") == 0) || (::wcscmp(params[i], L"--grokProfile") == 0));
+			/**
+			 * Выполняем работу для Unix
+			 */
+			#else
+				// Определяем передан ли флаг потоковой обработки (формат NDJSON и многострочные события всегда обрабатываются по записям)
+				stream = (stream || (
+					(::strcmp(params[i], "-stream") == 0) || (::strcmp(params[i], "--stream") == 0) ||
+					(::strcmp(params[i], "-multiline") == 0) || (::strncmp(params[i], "--multiline=", 12) == 0) ||
+					(::strcasecmp(params[i], "ndjson") == 0) || (::strcasecmp(params[i], "--from=ndjson") == 0) || (::strcasecmp(params[i], "--to=ndjson") == 0)
+				));
+				// Определяем передан ли флаг профилирования (корпус строк читается целиком)
+				profile = (profile || (::strcmp(params[i], "-grokProfile") == 0) || (::strcmp(params[i], "--grokProfile") == 0));
+			#endif
+		}
+		// Если потоковая обработка или профилирование активированы
+		if(stream || profile)
+			// Запрещаем чтение текстовой переменной из stdin при инициализации параметров
+			env.text("");
 		// Считываем строку из буфера stdin
-		if(!::isatty(STDIN_FILENO)){
+		else if(!::isatty(STDIN_FILENO)){
 			// Результат полученный из потока
 			string result = "";
 			// Выполняем чтение данных из потока
@@ -323,8 +393,18 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 		// Если указанны форматы конвертирования
 		if(env.isString(false, "from") && env.isString(false, "to") &&
 		  !env.isBoolean(false, "date") && !env.isBoolean(false, "bytes") && !env.isBoolean(false, "seconds")){
-			// Регулярное выражение в формате GROK
-			string express = "";
+			// Список регулярных выражений в формате GROK в порядке перебора
+			vector <string> expressions;
+			// Объект шаблонов GROK
+			json patterns;
+			// Адрес файла пакета предварительно собранных шаблонов GROK
+			string bundle = "";
+			// Отметка исходных шаблонов GROK, для которых собран пакет
+			uint64_t stamp = 0;
+			// Флаг готовности пакета шаблонов GROK
+			bool bundled = false;
+			// Ограничения выполнения регулярных выражений GROK
+			grok_t::limits_t limits;
 			// Выполняем инициализацию объекта парсера
 			parser_t parser(&fmk, &log);
 			// Тип рабочего формата данных
@@ -366,6 +446,10 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 			else if(fmk.compare("json", env.get <string> (false, "from")))
 				// Определяем формат данных
 				from = type_t::JSON;
+			// Если формат входящих данных указан как NDJSON (по одной записи JSON в строке)
+			else if(fmk.compare("ndjson", env.get <string> (false, "from")))
+				// Определяем формат данных
+				from = type_t::JSON;
 			// Если формат входящих данных указан как INI
 			else if(fmk.compare("ini", env.get <string> (false, "from")))
 				// Определяем формат данных
@@ -386,45 +470,109 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 			else if(fmk.compare("grok", env.get <string> (false, "from"))) {
 				// Определяем формат данных
 				from = type_t::GROK;
+				// Если адрес пакета шаблонов указан
+				if(env.isString(false, "bundle"))
+					// Получаем адрес пакета шаблонов
+					bundle = env.get <string> (false, "bundle");
+				// Если максимальное количество шагов сопоставления указано
+				if(env.isUint(false, "matchLimit"))
+					// Получаем максимальное количество шагов сопоставления
+					limits.match = env.get <uint32_t> (false, "matchLimit");
+				// Если максимальная глубина возвратов указана
+				if(env.isUint(false, "depthLimit"))
+					// Получаем максимальную глубину возвратов
+					limits.depth = env.get <uint32_t> (false, "depthLimit");
+				// Если максимальный размер стека JIT указан
+				if(env.isUint(false, "jitStack"))
+					// Получаем максимальный размер стека JIT
+					limits.stack = static_cast <size_t> (env.get <uint32_t> (false, "jitStack"));
+				// Если максимальное время сопоставления строки указано
+				if(env.isUint(false, "timeBudget"))
+					// Получаем максимальное время сопоставления строки
+					limits.budget = static_cast <uint64_t> (env.get <uint32_t> (false, "timeBudget"));
+				// Выполняем установку ограничений выполнения регулярных выражений
+				parser.limits(limits);
 				// Если файл шаблона указан
 				if(env.isString(false, "patterns")){
-					// Объект шаблонов
-					json patterns;
 					// Выполяем получение текста шаблонов
 					const auto & buffer = fs.read(env.get <string> (false, "patterns"));
-					// Выполняем парсинг полученных текстовых данных
-					if(patterns.Parse(buffer.data(), buffer.size()).HasParseError()){
-						/**
-						 * Если включён режим отладки
-						 */
-						#if defined(DEBUG_MODE)
-							// Выводим сообщение об ошибке
-							log.debug("Patterns JSON: (offset %d): %s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, patterns.GetErrorOffset(), GetParseError_En(patterns.GetParseError()));
-						/**
-						* Если режим отладки не включён
-						*/
-						#else
-							// Выводим сообщение об ошибке
-							log.print("Patterns JSON: (offset %d): %s", log_t::flag_t::CRITICAL, patterns.GetErrorOffset(), GetParseError_En(patterns.GetParseError()));
-						#endif
+					// Получаем отметку исходных шаблонов для проверки актуальности пакета
+					stamp = ::CityHash64(buffer.data(), buffer.size());
+					// Если пакет шаблонов не загружен, выполняем разбор шаблонов
+					if(bundle.empty() || !fs.isFile(bundle) || !(bundled = parser.loadPatterns(bundle, stamp))){
+						// Выполняем парсинг полученных текстовых данных
+						if(patterns.Parse(buffer.data(), buffer.size()).HasParseError()){
+							/**
+							 * Если включён режим отладки
+							 */
+							#if defined(DEBUG_MODE)
+								// Выводим сообщение об ошибке
+								log.debug("Patterns JSON: (offset %d): %s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, patterns.GetErrorOffset(), GetParseError_En(patterns.GetParseError()));
+							/**
+							* Если режим отладки не включён
+							*/
+							#else
+								// Выводим сообщение об ошибке
+								log.print("Patterns JSON: (offset %d): %s", log_t::flag_t::CRITICAL, patterns.GetErrorOffset(), GetParseError_En(patterns.GetParseError()));
+							#endif
+						}
+						// Если данные шаблонов получены
+						if(patterns.IsObject() && !patterns.ObjectEmpty())
+							// Выполняем добавление поддерживаемых шаблонов
+							parser.patterns(patterns);
 					}
-					// Если данные шаблонов получены
-					if(patterns.IsObject() && !patterns.ObjectEmpty())
-						// Выполняем добавление поддерживаемых шаблонов
-						parser.patterns(patterns);
-				}
+				// Если указан только пакет шаблонов
+				} else if(!bundle.empty() && fs.isFile(bundle))
+					// Выполняем загрузку пакета шаблонов
+					bundled = parser.loadPatterns(bundle, stamp);
 				// Если регулярное выражение передано
 				if(env.isString(false, "express")){
 					// Выполняем чтение данных регулярного выражения
 					const auto & buffer = fs.read(env.get <string> (false, "express"));
+					// Если каждая строка файла является отдельным выражением
+					if(env.isBoolean(false, "expressList")){
+						// Позиция начала и конца текущей строки
+						size_t begin = 0, end = 0;
+						// Выполняем перебор всех строк файла
+						while(begin < buffer.size()){
+							// Выполняем поиск конца строки
+							const char * found = reinterpret_cast <const char *> (::memchr(buffer.data() + begin, '\n', buffer.size() - begin));
+							// Получаем позицию конца строки
+							end = (found != nullptr ? static_cast <size_t> (found - buffer.data()) : buffer.size());
+							// Получаем текущее регулярное выражение
+							string express(buffer.data() + begin, end - begin);
+							// Смещаемся на следующую строку
+							begin = (end + 1);
+							// Удаляем завершающий символ возврата каретки
+							if(!express.empty() && (express.back() == '\r'))
+								// Уменьшаем размер регулярного выражения
+								express.pop_back();
+							// Если регулярное выражение получено
+							if(!express.empty())
+								// Добавляем регулярное выражение в список
+								expressions.push_back(::move(express));
+						}
+					// Если весь файл является одним выражением
+					} else if(!buffer.empty()) {
+						// Формируем полученное регулярное выражение
+						expressions.emplace_back(buffer.begin(), buffer.end());
+						// Выполняем поиск первого перевода строки
+						const auto it = std::find(buffer.begin(), buffer.end(), '\n');
+						// Если после перевода строки в файле есть другие данные
+						if((it != buffer.end()) && (std::find_if(it, buffer.end(), [](const char letter) noexcept -> bool {
+							// Выводим результат проверки символа
+							return ((letter != '\r') && (letter != '\n'));
+						}) != buffer.end()))
+							// Выводим предупреждение о многострочном выражении
+							log.print("File of the GROK expression contains several lines and is used as one expression, set -expressList to try each line as a separate expression", log_t::flag_t::WARNING);
+					}
 					// Если регулярное выражение не получено
-					if(buffer.empty()){
+					if(expressions.empty()){
 						// Выводим сообщение об ошибке
 						log.print("Regular expression in GROK format is not set", log_t::flag_t::CRITICAL);
 						// Выводим удачное завершение работы
 						return EXIT_FAILURE;
-					// Формируем полученное регулярное выражение
-					} else express.assign(buffer.begin(), buffer.end());
+					}
 				// Выводим сообщение об ошибке
 				} else {
 					// Выводим сообщение об ошибке
@@ -432,6 +580,10 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 					// Выводим удачное завершение работы
 					return EXIT_FAILURE;
 				}
+				// Если пакет шаблонов указан, но отсутствует или устарел
+				if(!bundle.empty() && !bundled)
+					// Выполняем сборку пакета шаблонов для следующих запусков
+					bundled = parser.savePatterns(bundle, expressions, stamp);
 			// Если формат входящих данных указан как SysLog
 			} else if(fmk.compare("syslog", env.get <string> (false, "from")))
 				// Определяем формат данных
@@ -459,6 +611,10 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 			else if(fmk.compare("json", env.get <string> (false, "to")))
 				// Определяем формат данных
 				to = type_t::JSON;
+			// Если формат исходящих данных указан как NDJSON (по одной записи JSON в строке)
+			else if(fmk.compare("ndjson", env.get <string> (false, "to")))
+				// Определяем формат данных
+				to = type_t::JSON;
 			// Если формат исходящих данных указан как INI
 			else if(fmk.compare("ini", env.get <string> (false, "to")))
 				// Определяем формат данных
@@ -557,83 +713,1026 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 					}
 				}
 			}
-			// Если данные прочитаны из потока
-			if(!text.empty()){
-				// Объект в формате JSON
-				json result(kObjectType);
+			// Форматы прямого конвертирования без построения объекта JSON
+			parser_t::format_t source = parser_t::format_t::NONE, target = parser_t::format_t::NONE;
+			// Если формат входящих данных указан как JSON
+			if(from == type_t::JSON)
+				// Устанавливаем формат прямого конвертирования
+				source = parser_t::format_t::JSON;
+			// Если формат входящих данных указан как CSV без заголовков
+			else if((from == type_t::CSV) && !env.isBoolean(false, "header"))
+				// Устанавливаем формат прямого конвертирования
+				source = parser_t::format_t::CSV;
+			// Если формат исходящих данных указан как JSON
+			if(to == type_t::JSON)
+				// Устанавливаем формат прямого конвертирования
+				target = parser_t::format_t::JSON;
+			// Если формат исходящих данных указан как YAML
+			else if(to == type_t::YAML)
+				// Устанавливаем формат прямого конвертирования
+				target = parser_t::format_t::YAML;
+			// Если массив записей JSON конвертируется в формат CSV
+			else if((to == type_t::CSV) && (from == type_t::JSON))
+				// Устанавливаем формат прямого конвертирования
+				target = parser_t::format_t::CSV;
+			// Разделитель используемый для формата CSV
+			const char delim = (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';');
+			// Флаг формирования заголовков для формата CSV
+			const bool header = env.isBoolean(false, "header");
+			/**
+			 * targetFn Функция получения адреса файла для потокового вывода результата
+			 * @param name      название исходного файла
+			 * @param directory флаг конвертирования файлов каталога
+			 * @param filename  адрес файла для сохранения (пустой адрес - вывод в поток вывода)
+			 * @return          результат получения адреса
+			 */
+			auto targetFn = [&](const string & name, const bool directory, string & filename) noexcept -> bool {
+				// Выполняем очистку адреса файла
+				filename.clear();
+				// Если адрес каталога назначения не указан
+				if(!env.isString(false, "dest"))
+					// Результат выводится в поток вывода
+					return true;
+				// Получаем адрес каталога
+				const string & addr = env.get <string> (false, "dest");
+				// Если адрес каталога не получен
+				if(addr.empty())
+					// Сообщаем, что адрес не получен
+					return false;
+				// Если конвертируются файлы каталога и каталог назначения не существует
+				if(directory && !fs.isDir(addr) && !fs.isFile(addr))
+					// Выполняем создание каталога
+					fs.makePath(addr);
+				// Если адрес является каталогом
+				if(fs.isDir(addr)){
+					// Получаем расширение файла
+					const string extension = env.get <string> (false, "to");
+					// Переводим расширение в нижний регистр
+					fmk.transform(extension, fmk_t::transform_t::LOWER);
+					// Выполняем создание адреса файла для сохранения
+					filename = fmk.format("%s%s%s.%s", addr.c_str(), AWH_FS_SEPARATOR, name.c_str(), extension.c_str());
+				// Если файлы каталога можно сохранить только в каталог
+				} else if(directory)
+					// Сообщаем, что адрес не получен
+					return false;
+				// Устанавливаем адрес файла для сохранения
+				else filename = addr;
+				// Сообщаем, что адрес получен
+				return true;
+			};
+			/**
+			 * streamFn Функция потоковой конвертации массива записей JSON в CSV с выводом строк по мере разбора
+			 * @param parser   объект парсера текущего потока
+			 * @param text     текст для конвертации
+			 * @param filename адрес файла для сохранения (пустой адрес - вывод в поток вывода)
+			 * @return         количество выведенных строк
+			 */
+			auto streamFn = [&](parser_t & parser, const string_view text, const string & filename) noexcept -> size_t {
+				// Флаг создания файла для сохранения
+				bool created = false;
+				// Буфер сформированных строк для вывода
+				string output = "";
+				// Функция вывода накопленных строк
+				auto flushFn = [&]() noexcept -> void {
+					// Если данные для вывода получены
+					if(!output.empty()){
+						// Если адрес файла для сохранения не указан
+						if(filename.empty())
+							// Выводим данные в поток вывода
+							cout.write(output.data(), output.size());
+						// Если файл для сохранения ещё не создан
+						else if(!created) {
+							// Выполняем запись данных в файл
+							fs.write(filename, output.data(), output.size());
+							// Запоминаем, что файл создан
+							created = true;
+						// Выполняем добавление данных в файл
+						} else fs.append(filename, output.data(), output.size());
+						// Выполняем очистку буфера данных
+						output.clear();
+					}
+				};
+				// Выполняем построчную конвертацию, каждая строка передаётся на вывод по завершении записи
+				const size_t rows = parser.transcode(text, source, target, false, header, delim, [&](const string & row) noexcept -> void {
+					// Добавляем полученную строку
+					output.append(row);
+					// Если накоплен блок данных для вывода
+					if(output.size() >= 0x100000)
+						// Выполняем вывод накопленных строк
+						flushFn();
+				});
+				// Если строки получены
+				if(rows > 0)
+					// Выполняем вывод оставшихся строк
+					flushFn();
+				// Если данные выводятся в поток вывода
+				if(filename.empty())
+					// Выполняем сброс буфера потока вывода
+					cout.flush();
+				// Выводим количество выведенных строк
+				return rows;
+			};
+			// Количество потоков для конвертирования
+			size_t threads = 1;
+			// Если количество потоков передано
+			if(env.isUint(false, "threads")){
+				// Получаем количество потоков
+				threads = static_cast <size_t> (env.get <uint32_t> (false, "threads"));
+				// Если количество потоков не указано, используем все ядра процессора
+				if(threads == 0)
+					// Получаем количество ядер процессора
+					threads = std::max(static_cast <size_t> (1), static_cast <size_t> (std::thread::hardware_concurrency()));
+			}
+			// Устанавливаем количество потоков парсинга больших файлов CSV
+			parser.threads(threads);
+			// Название повторяющегося элемента записи XML
+			string record = "";
+			// Если формат входящих данных указан как XML и передано название элемента записи
+			if((from == type_t::XML) && env.isString(false, "record"))
+				// Получаем название элемента записи
+				record = env.get <string> (false, "record");
+			// Если требуется профилирование регулярных выражений GROK
+			if(profile && (from == type_t::GROK)){
+				// Корпус строк для профилирования
+				string corpus = "";
+				// Если указан адрес файла корпуса
+				if(env.isString(false, "src")){
+					// Создаём объект отображения файла в память
+					mmap_t mapping(&fmk, &log);
+					// Если файл отображён в память
+					if(mapping.open(env.get <string> (false, "src")))
+						// Получаем корпус строк
+						corpus.assign(mapping.view());
+				// Выполняем чтение корпуса из stdin
+				} else if(!::isatty(STDIN_FILENO)) {
+					// Количество прочитанных байт
+					ssize_t bytes = 0;
+					// Буфер для чтения данных из stdin
+					vector <char> chunk(0x10000);
+					// Выполняем чтение данных из stdin порциями
+					while((bytes = ::read(STDIN_FILENO, chunk.data(), chunk.size())) != 0){
+						// Если во время чтения произошла ошибка
+						if(bytes < 0){
+							// Если чтение было прервано сигналом, повторяем попытку
+							if(errno == EINTR)
+								// Продолжаем чтение
+								continue;
+							// Выходим из цикла
+							break;
+						}
+						// Добавляем полученную порцию данных в корпус
+						corpus.append(chunk.data(), static_cast <size_t> (bytes));
+					}
+				}
+				// Если корпус строк не получен
+				if(corpus.empty()){
+					// Выводим сообщение об ошибке
+					log.print("Lines for profiling GROK expressions are not set", log_t::flag_t::CRITICAL);
+					// Выводим неудачное завершение работы
+					return EXIT_FAILURE;
+				}
+				// Переходим по всем регулярным выражениям
+				for(size_t i = 0; i < expressions.size(); i++){
+					// Выполняем профилирование регулярного выражения
+					const auto & report = parser.profile(corpus, expressions.at(i));
+					// Если отчёт профилирования не получен
+					if(report.items.empty()){
+						// Выводим сообщение об ошибке
+						log.print("GROK expression #%zu could not be profiled", log_t::flag_t::CRITICAL, i + 1);
+						// Переходим к следующему выражению
+						continue;
+					}
+					// Получаем общее время выполнения выражения
+					const double total = (static_cast <double> (report.items.front().time) / 1000000.);
+					// Выводим заголовок отчёта
+					::printf(
+						"\x1B[1mGROK expression #%zu\x1B[0m: %s\r\n  lines: %zu, matched: %zu, skipped: %zu, backtracks: %llu, time: %.3f ms\r\n\r\n",
+						i + 1, expressions.at(i).c_str(), report.lines, report.matched, report.skipped,
+						static_cast <unsigned long long> (report.items.front().backtracks), total
+					);
+					// Выводим заголовок таблицы подшаблонов
+					::printf("  %6s %12s %12s %12s %8s  %s\r\n", "group", "calls", "backtracks", "time (ms)", "share", "subpattern");
+					// Переходим по всем подшаблонам выражения
+					for(size_t j = 1; j < report.items.size(); j++){
+						// Получаем профиль подшаблона
+						const auto & item = report.items.at(j);
+						// Глубина вложенности подшаблона
+						size_t depth = 0;
+						// Определяем глубину вложенности подшаблона
+						for(uint32_t parent = item.parent; (parent > 0) && (parent < report.items.size()); parent = report.items.at(parent).parent)
+							// Увеличиваем глубину вложенности
+							depth++;
+						// Получаем время выполнения подшаблона
+						const double time = (static_cast <double> (item.time) / 1000000.);
+						// Выводим профиль подшаблона
+						::printf(
+							"  %6u %12llu %12llu %12.3f %7.2f%%  %s%s\r\n", item.group,
+							static_cast <unsigned long long> (item.calls), static_cast <unsigned long long> (item.backtracks),
+							time, (total > 0. ? ((time / total) * 100.) : 0.), string(depth * 2, ' ').c_str(), item.label.c_str()
+						);
+					}
+					// Выводим разделитель отчётов
+					::printf("\r\n");
+				}
+				// Выводим удачное завершение работы
+				return EXIT_SUCCESS;
+			}
+			// Если требуется потоковая обработка данных из stdin, указанного файла или каталога с журналами GROK
+			if(stream && (!::isatty(STDIN_FILENO) || (env.isString(false, "src") && (fs.isFile(env.get <string> (false, "src")) || ((from == type_t::GROK) && fs.isDir(env.get <string> (false, "src"))))))){
 				// Определяем формат данных
 				switch(static_cast <uint8_t> (from)){
-					// Если формат входящих данных указан как Text
+					// Если формат входящих данных поддерживает обработку по записям
 					case static_cast <uint8_t> (type_t::TEXT):
-						// Выполняем передачу данных как она есть
-						result.SetString(text.c_str(), text.length(), result.GetAllocator());
-					break;
-					// Если формат входящих данных указан как XML
-					case static_cast <uint8_t> (type_t::XML):
-						// Выполняем конвертацию данных
-						result = parser.xml(text);
-					break;
-					// Если формат входящих данных указан как JSON
 					case static_cast <uint8_t> (type_t::JSON):
-						// Выполняем конвертацию данных
-						result = parser.json(text);
-					break;
-					// Если формат входящих данных указан как INI
-					case static_cast <uint8_t> (type_t::INI):
-						// Выполняем конвертацию данных
-						result = parser.ini(text);
-					break;
-					// Если формат входящих данных указан как YAML
-					case static_cast <uint8_t> (type_t::YAML):
-						// Выполняем конвертацию данных
-						result = parser.yaml(text);
-					break;
-					// Если формат входящих данных указан как CEF
-					case static_cast <uint8_t> (type_t::CEF): {
-						// Режим парсинга CEF по умолчанию
-						cef_t::mode_t mode = cef_t::mode_t::STRONG;
-						// Если режим парсинга CEF передан
-						if(env.isString(false, "cef")){
-							// Получаем режим парсинга
-							const string & cef = env.get <string> (false, "cef");
-							// Если режим парсинга установлен как строгий
-							if(fmk.compare("strong", cef))
-								// Устанавливаем строгий режим парсинга
-								mode = cef_t::mode_t::STRONG;
-							// Если режим парсинга установлен как простой
-							else if(fmk.compare("low", cef))
-								// Устанавливаем простой режим парсинга
-								mode = cef_t::mode_t::LOW;
-							// Если режим парсинга установлен как средний
-							else if(fmk.compare("medium", cef))
-								// Устанавливаем средний режим парсинга
-								mode = cef_t::mode_t::MEDIUM;
-						}
-						// Выполняем конвертацию данных
-						result = parser.cef(text, mode);
-					} break;
-					// Если формат входящих данных указан как CSV
-					case static_cast <uint8_t> (type_t::CSV):
-						// Выполняем конвертацию данных
-						result = parser.csv(text, env.isBoolean(false, "header"));
-					break;
-					// Если формат входящих данных указан как GROK
+					case static_cast <uint8_t> (type_t::CEF):
 					case static_cast <uint8_t> (type_t::GROK):
-						// Выполняем конвертацию данных
-						result = parser.grok(text, express);
-					break;
-					// Если формат входящих данных указан как SysLog
+					case static_cast <uint8_t> (type_t::CSV):
 					case static_cast <uint8_t> (type_t::SYSLOG):
-						// Выполняем конвертацию данных
-						result = parser.syslog(text);
-					break;
-					// Если формат входящих данных указан как BASE64
-					case static_cast <uint8_t> (type_t::BASE64): {
-						// Выполняем декодирование хэша BASE64
-						const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
-						// Выполняем установку полученного хэша BASE64
-						result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
-					} break;
+					case static_cast <uint8_t> (type_t::BASE64): break;
+					// Если формат входящих данных не поддерживает обработку по записям
+					default: {
+						// Документ XML читается по записям, если указано название элемента записи
+						if((from == type_t::XML) && !record.empty())
+							// Выходим из условия
+							break;
+						// Выводим сообщение об ошибке
+						log.print("Format \"%s\" is not supported in stream mode", log_t::flag_t::CRITICAL, fmk.transform(env.get <string> (false, "from"), fmk_t::transform_t::UPPER).c_str());
+						// Выводим неудачное завершение работы
+						return EXIT_FAILURE;
+					}
+				}
+				// Адрес файла для сохранения
+				string filename = "";
+				// Если указан адрес каталога назначения
+				if(env.isString(false, "dest")){
+					// Получаем адрес каталога
+					const string & addr = env.get <string> (false, "dest");
+					// Если адрес каталога не получен
+					if(addr.empty()){
+						// Выводим сообщение об ошибке
+						log.print("Directory address is not set", log_t::flag_t::CRITICAL);
+						// Выводим неудачное завершение работы
+						return EXIT_FAILURE;
+					}
+					// Устанавливаем адрес файла для сохранения
+					filename = addr;
+					// Если адрес является каталогом
+					if(fs.isDir(addr)){
+						// Получаем расширение файла
+						const string extension = env.get <string> (false, "to");
+						// Переводим расширение в нижний регистр
+						fmk.transform(extension, fmk_t::transform_t::LOWER);
+						// Выполняем создание адреса файла для сохранения
+						filename = fmk.format("%s%s%s.%s", addr.c_str(), AWH_FS_SEPARATOR, "result", extension.c_str());
+					}
+				}
+				// Режим парсинга CEF по умолчанию
+				cef_t::mode_t mode = cef_t::mode_t::STRONG;
+				// Если режим парсинга CEF передан
+				if(env.isString(false, "cef")){
+					// Получаем режим парсинга
+					const string & cef = env.get <string> (false, "cef");
+					// Если режим парсинга установлен как строгий
+					if(fmk.compare("strong", cef))
+						// Устанавливаем строгий режим парсинга
+						mode = cef_t::mode_t::STRONG;
+					// Если режим парсинга установлен как простой
+					else if(fmk.compare("low", cef))
+						// Устанавливаем простой режим парсинга
+						mode = cef_t::mode_t::LOW;
+					// Если режим парсинга установлен как средний
+					else if(fmk.compare("medium", cef))
+						// Устанавливаем средний режим парсинга
+						mode = cef_t::mode_t::MEDIUM;
+				}
+				// Флаг создания файла для сохранения
+				bool created = false;
+				// Формат NDJSON выводится по одной записи в строке без форматирования
+				const bool prettify = (env.isBoolean(false, "prettify") && !fmk.compare("ndjson", env.get <string> (false, "to")));
+				// Буфер сформированных данных для вывода
+				string output = "";
+				// Количество полученных записей и записей которые не удалось сконвертировать
+				size_t records = 0, failed = 0;
+				// Создаём объект работы с хэшами
+				hash_t hash(&log);
+				// Создаём объект разбора потока на записи
+				stream_t reader(&fmk, &log);
+				// Записи SysLog и CEF могут передаваться с префиксом длины (RFC 6587)
+				if((from == type_t::SYSLOG) || (from == type_t::CEF))
+					// Разрешаем автоматическое определение префикса длины
+					reader.framing(stream_t::framing_t::AUTO);
+				// Функция вывода накопленных данных
+				auto flushFn = [&]() noexcept -> void {
+					// Если данные для вывода получены
+					if(!output.empty()){
+						// Если адрес файла для сохранения не указан
+						if(filename.empty())
+							// Выводим данные в поток вывода
+							cout.write(output.data(), output.size());
+						// Если файл для сохранения ещё не создан
+						else if(!created) {
+							// Выполняем запись данных в файл
+							fs.write(filename, output.data(), output.size());
+							// Запоминаем, что файл создан
+							created = true;
+						// Выполняем добавление данных в файл
+						} else fs.append(filename, output.data(), output.size());
+						// Выполняем очистку буфера данных
+						output.clear();
+					}
+					// Если данные выводятся в поток вывода
+					if(filename.empty())
+						// Выполняем сброс буфера потока вывода
+						cout.flush();
+				};
+				/**
+				 * recordFn Функция конвертирования полученной записи в формат вывода
+				 * @param parser объект парсера текущего потока
+				 * @param hash   объект работы с хэшами текущего потока
+				 * @param result запись в формате JSON
+				 * @param first  флаг первой записи потока
+				 * @return       сконвертированная запись
+				 */
+				auto recordFn = [&](parser_t & parser, hash_t & hash, const json & result, const bool first) noexcept -> string {
+					// Буфер данных для записи
+					string data = "";
+					// Форматы хэшей и текста требуют на входе строку
+					const bool structured = (
+						(to == type_t::XML) || (to == type_t::JSON) ||
+						(to == type_t::INI) || (to == type_t::YAML) ||
+						(to == type_t::CEF) || (to == type_t::CSV) || (to == type_t::SYSLOG)
+					);
+					// Если результат получен
+					if(!result.IsNull() && (structured || result.IsString())){
+						// Определяем формат данных
+						switch(static_cast <uint8_t> (to)){
+							// Если формат исходящих данных указан как Text
+							case static_cast <uint8_t> (type_t::TEXT):
+								// Выполняем вывод текст как он есть
+								data.assign(result.GetString(), result.GetStringLength());
+							break;
+							// Если формат исходящих данных указан как XML
+							case static_cast <uint8_t> (type_t::XML):
+								// Выполняем конвертирование в формат XML
+								data = parser.xml(result, env.isBoolean(false, "prettify"));
+							break;
+							// Если формат исходящих данных указан как JSON
+							case static_cast <uint8_t> (type_t::JSON):
+								// Выполняем конвертирование в формат JSON
+								data = parser.json(result, prettify);
+							break;
+							// Если формат исходящих данных указан как INI
+							case static_cast <uint8_t> (type_t::INI):
+								// Выполняем конвертирование в формат INI
+								data = parser.ini(result);
+							break;
+							// Если формат исходящих данных указан как YAML
+							case static_cast <uint8_t> (type_t::YAML):
+								// Выполняем конвертирование в формат YAML
+								data = parser.yaml(result);
+							break;
+							// Если формат исходящих данных указан как CEF
+							case static_cast <uint8_t> (type_t::CEF):
+								// Выполняем конвертирование в формат CEF
+								data = parser.cef(result, mode);
+							break;
+							// Если формат исходящих данных указан как CSV
+							case static_cast <uint8_t> (type_t::CSV):
+								// Выполняем конвертирование в формат CSV (заголовок выводится только для первой записи)
+								data = parser.csv(result, (env.isBoolean(false, "header") && first), delim);
+							break;
+							// Если формат исходящих данных указан как SysLog
+							case static_cast <uint8_t> (type_t::SYSLOG):
+								// Выполняем конвертирование в формат SysLog
+								data = parser.syslog(result);
+							break;
+							// Если формат исходящих данных указан как BASE64
+							case static_cast <uint8_t> (type_t::BASE64):
+								// Выполняем конвертирование в формат BASE64
+								hash.encode(result.GetString(), result.GetStringLength(), hash_t::cipher_t::BASE64, data);
+							break;
+							// Если формат исходящих данных указан как MD5
+							case static_cast <uint8_t> (type_t::MD5):
+								// Выполняем конвертирование в формат MD5
+								hash.hashing(result.GetString(), hash_t::type_t::MD5, data);
+							break;
+							// Если формат исходящих данных указан как SHA1
+							case static_cast <uint8_t> (type_t::SHA1):
+								// Выполняем конвертирование в формат SHA1
+								hash.hashing(result.GetString(), hash_t::type_t::SHA1, data);
+							break;
+							// Если формат исходящих данных указан как SHA224
+							case static_cast <uint8_t> (type_t::SHA224):
+								// Выполняем конвертирование в формат SHA224
+								hash.hashing(result.GetString(), hash_t::type_t::SHA224, data);
+							break;
+							// Если формат исходящих данных указан как SHA256
+							case static_cast <uint8_t> (type_t::SHA256):
+								// Выполняем конвертирование в формат SHA256
+								hash.hashing(result.GetString(), hash_t::type_t::SHA256, data);
+							break;
+							// Если формат исходящих данных указан как SHA384
+							case static_cast <uint8_t> (type_t::SHA384):
+								// Выполняем конвертирование в формат SHA384
+								hash.hashing(result.GetString(), hash_t::type_t::SHA384, data);
+							break;
+							// Если формат исходящих данных указан как SHA512
+							case static_cast <uint8_t> (type_t::SHA512):
+								// Выполняем конвертирование в формат SHA512
+								hash.hashing(result.GetString(), hash_t::type_t::SHA512, data);
+							break;
+							// Если формат исходящих данных указан как HMAC MD5
+							case static_cast <uint8_t> (type_t::HMAC_MD5):
+								// Выполняем конвертирование в формат HMAC MD5
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::MD5, data);
+							break;
+							// Если формат исходящих данных указан как HMAC SHA1
+							case static_cast <uint8_t> (type_t::HMAC_SHA1):
+								// Выполняем конвертирование в формат HMAC SHA1
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::SHA1, data);
+							break;
+							// Если формат исходящих данных указан как HMAC SHA224
+							case static_cast <uint8_t> (type_t::HMAC_SHA224):
+								// Выполняем конвертирование в формат HMAC SHA224
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::SHA224, data);
+							break;
+							// Если формат исходящих данных указан как HMAC SHA256
+							case static_cast <uint8_t> (type_t::HMAC_SHA256):
+								// Выполняем конвертирование в формат HMAC SHA256
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::SHA256, data);
+							break;
+							// Если формат исходящих данных указан как HMAC SHA384
+							case static_cast <uint8_t> (type_t::HMAC_SHA384):
+								// Выполняем конвертирование в формат HMAC SHA384
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::SHA384, data);
+							break;
+							// Если формат исходящих данных указан как HMAC SHA512
+							case static_cast <uint8_t> (type_t::HMAC_SHA512):
+								// Выполняем конвертирование в формат HMAC SHA512
+								hash.hmac(hmac, result.GetString(), hash_t::type_t::SHA512, data);
+							break;
+						}
+					}
+					// Выводим результат
+					return data;
+				};
+				/**
+				 * appendFn Функция добавления сконвертированной записи в буфер вывода
+				 * @param data сконвертированная запись
+				 */
+				auto appendFn = [&](const string & data) noexcept -> void {
+					// Если данные для записи получены
+					if(!data.empty()){
+						// Добавляем сконвертированную запись в буфер вывода
+						output.append(data);
+						// Добавляем разделитель записей
+						output.append(1, '\n');
+						// Если размер буфера превышает максимальный размер
+						if(output.size() >= 0x10000)
+							// Выполняем вывод накопленных данных
+							flushFn();
+					// Увеличиваем количество записей которые не удалось сконвертировать
+					} else failed++;
+				};
+				// Создаём объект сборки многострочных событий
+				multiline_t joiner(&fmk, &log);
+				// Флаг сборки многострочных событий
+				const bool multiline = env.isString(false, "multiline");
+				// Если сборка многострочных событий требуется
+				if(multiline){
+					// Получаем правило определения начала события
+					const string & rule = env.get <string> (false, "multiline");
+					// Если событие продолжают строки с отступом
+					if(fmk.compare("indent", rule))
+						// Устанавливаем правило определения начала события по отступам
+						joiner.indent();
+					// Если регулярное выражение начала события не скомпилировано
+					else if(!joiner.pattern(rule)) {
+						// Выводим сообщение об ошибке
+						log.print("Regular expression of the multiline event start is broken", log_t::flag_t::CRITICAL);
+						// Выводим неудачное завершение работы
+						return EXIT_FAILURE;
+					}
+					// Выполняем установку ограничений размера события
+					joiner.max(
+						(env.isUint(false, "multilineLines") ? static_cast <size_t> (env.get <uint32_t> (false, "multilineLines")) : 0),
+						(env.isUint(false, "multilineBytes") ? static_cast <size_t> (env.get <uint32_t> (false, "multilineBytes")) : 0)
+					);
+					// Если время ожидания продолжения события указано
+					if(env.isUint(false, "multilineTimeout"))
+						// Устанавливаем время ожидания продолжения события
+						joiner.timeout(static_cast <time_t> (env.get <uint32_t> (false, "multilineTimeout")));
+					// Разрешаем передачу пустых строк, они входят в многострочные события
+					reader.blank(true);
+					// Передаём полученные строки на сборку многострочных событий
+					reader.on([&joiner](const char * buffer, const size_t size) noexcept -> void {
+						// Добавляем строку в событие
+						joiner.push(buffer, size);
+					});
+				}
+				/**
+				 * eventFn Функция обработки полученной записи
+				 * @param buffer буфер данных записи
+				 * @param size   размер буфера данных записи
+				 */
+				auto eventFn = [&](const char * buffer, const size_t size) noexcept -> void {
+					// Увеличиваем количество полученных записей
+					records++;
+					// Объект в формате JSON
+					json result(kObjectType);
+					// Определяем формат данных
+					switch(static_cast <uint8_t> (from)){
+						// Если формат входящих данных указан как Text
+						case static_cast <uint8_t> (type_t::TEXT):
+							// Выполняем передачу данных как она есть
+							result.SetString(buffer, size, result.GetAllocator());
+						break;
+						// Если формат входящих данных указан как JSON
+						case static_cast <uint8_t> (type_t::JSON):
+							// Выполняем конвертацию данных
+							result = parser.json(string_view(buffer, size));
+						break;
+						// Если формат входящих данных указан как CEF
+						case static_cast <uint8_t> (type_t::CEF):
+							// Выполняем конвертацию данных
+							result = parser.cef(string_view(buffer, size), mode);
+						break;
+						// Если формат входящих данных указан как GROK
+						case static_cast <uint8_t> (type_t::GROK):
+							// Выполняем конвертацию данных
+							result = parser.grok(string_view(buffer, size), expressions);
+						break;
+						// Если формат входящих данных указан как SysLog
+						case static_cast <uint8_t> (type_t::SYSLOG):
+							// Выполняем конвертацию данных
+							result = parser.syslog(string_view(buffer, size));
+						break;
+						// Если формат входящих данных указан как BASE64
+						case static_cast <uint8_t> (type_t::BASE64): {
+							// Выполняем декодирование хэша BASE64
+							const string & data = hash.decode <string> (buffer, size, hash_t::cipher_t::BASE64);
+							// Выполняем установку полученного хэша BASE64
+							result.SetString(data.c_str(), data.length(), result.GetAllocator());
+						} break;
+					}
+					// Выполняем конвертирование полученной записи
+					appendFn(recordFn(parser, hash, result, (records == 1)));
+				};
+				// Если сборка многострочных событий требуется
+				if(multiline)
+					// Устанавливаем функцию обработки собранного события
+					joiner.on(eventFn);
+				// Устанавливаем функцию обработки полученной записи
+				else reader.on(eventFn);
+				// Если документ XML читается по записям
+				if(!record.empty()){
+					/**
+					 * itemFn Функция обработки полученной записи XML
+					 * @param item запись в формате JSON
+					 */
+					auto itemFn = [&](const json & item) noexcept -> void {
+						// Увеличиваем количество полученных записей
+						records++;
+						// Выполняем конвертирование полученной записи
+						appendFn(recordFn(parser, hash, item, (records == 1)));
+					};
+					// Если указан адрес файла для чтения
+					if(env.isString(false, "src")){
+						// Создаём объект отображения файла в память
+						mmap_t mapping(&fmk, &log);
+						// Если файл отображён в память
+						if(mapping.open(env.get <string> (false, "src")))
+							// Выполняем чтение записей прямо из отображённого файла
+							parser.xml(mapping.view(), record, itemFn);
+					// Выполняем чтение записей из stdin
+					} else parser.xml(STDIN_FILENO, record, itemFn);
+				// Если документ CSV читается построчно (значения в кавычках могут содержать переносы строк)
+				} else if(from == type_t::CSV) {
+					/**
+					 * itemFn Функция обработки полученной строки CSV
+					 * @param item запись в формате JSON
+					 */
+					auto itemFn = [&](const json & item) noexcept -> void {
+						// Увеличиваем количество полученных записей
+						records++;
+						// Выполняем конвертирование полученной записи
+						appendFn(recordFn(parser, hash, item, (records == 1)));
+					};
+					// Если указан адрес файла для чтения
+					if(env.isString(false, "src")){
+						// Создаём объект отображения файла в память
+						mmap_t mapping(&fmk, &log);
+						// Если файл отображён в память
+						if(mapping.open(env.get <string> (false, "src")))
+							// Выполняем чтение строк прямо из отображённого файла
+							parser.csv(mapping.view(), header, itemFn);
+					// Выполняем чтение строк из stdin
+					} else parser.csv(STDIN_FILENO, header, itemFn);
+				// Если журнал GROK сопоставляется построчно блоками (многострочные события собираются по записям)
+				} else if((from == type_t::GROK) && !multiline) {
+					// Количество строк не совпавших с регулярным выражением
+					size_t unmatched = 0;
+					// Размер блока строк передаваемого одному потоку
+					const size_t block = 0x100000;
+					// Объекты парсеров дополнительных потоков (первый блок обрабатывается основным парсером)
+					vector <unique_ptr <parser_t>> parsers;
+					// Выполняем создание парсеров дополнительных потоков
+					for(size_t i = 1; i < threads; i++){
+						// Создаём собственный объект парсера потока
+						parsers.emplace_back(new parser_t(&fmk, &log));
+						// Выполняем установку ограничений выполнения регулярных выражений
+						parsers.back()->limits(limits);
+						// Используем шаблоны и собранные выражения основного парсера без повторной загрузки пакета
+						parsers.back()->share(parser);
+					}
+					// Создаём пул постоянных рабочих потоков для дополнительных блоков
+					workers_t pool(&fmk, &log);
+					// Выполняем запуск рабочих потоков (первый блок обрабатывается текущим потоком)
+					pool.start(threads - 1);
+					/**
+					 * batchFn Функция сопоставления блоков строк в пуле потоков
+					 * @param data текст для сопоставления
+					 * @param last флаг последней порции текста
+					 * @return     количество обработанных байт
+					 */
+					auto batchFn = [&](const string_view data, const bool last) noexcept -> size_t {
+						// Количество обработанных байт
+						size_t offset = 0;
+						// Список блоков строк текущего прохода
+						vector <string_view> blocks;
+						// Выполняем обработку текста проходами по одному блоку на поток
+						while(offset < data.size()){
+							// Выполняем очистку списка блоков
+							blocks.clear();
+							// Выполняем разбиение текста на блоки по границам строк
+							while((blocks.size() < threads) && (offset < data.size())){
+								// Получаем предполагаемый конец блока
+								size_t end = (offset + block);
+								// Если блок выходит за пределы текста
+								if(end >= data.size())
+									// Ограничиваем блок концом текста
+									end = data.size();
+								// Выполняем поиск конца строки после границы блока
+								else {
+									// Выполняем поиск перевода строки
+									const char * found = reinterpret_cast <const char *> (::memchr(data.data() + end, '\n', data.size() - end));
+									// Устанавливаем конец блока после перевода строки
+									end = (found != nullptr ? static_cast <size_t> (found - data.data()) + 1 : data.size());
+								}
+								// Если блок не завершён переводом строки, а текст ещё будет дополнен
+								if(!last && (end == data.size()) && (data.back() != '\n'))
+									// Выходим из цикла
+									break;
+								// Добавляем блок строк
+								blocks.push_back(data.substr(offset, end - offset));
+								// Смещаемся на размер блока
+								offset = end;
+							}
+							// Если блоков для обработки нет
+							if(blocks.empty())
+								// Выходим из цикла
+								break;
+							// Результаты конвертирования блоков
+							vector <string> results(blocks.size());
+							// Количество совпавших, не совпавших и не сконвертированных строк каждого блока
+							vector <size_t> matched(blocks.size(), 0), skipped(blocks.size(), 0), broken(blocks.size(), 0);
+							/**
+							 * blockFn Функция сопоставления одного блока строк
+							 * @param index индекс блока строк
+							 */
+							auto blockFn = [&](const size_t index) noexcept -> void {
+								// Количество полученных записей блока
+								size_t count = 0;
+								// Создаём объект работы с хэшами потока
+								hash_t hash(&log);
+								// Получаем объект парсера потока
+								parser_t & worker = (index == 0 ? parser : (* parsers.at(index - 1)));
+								// Выполняем сопоставление всех строк блока с однократной сборкой регулярного выражения
+								const auto & counts = worker.grok(blocks.at(index), expressions, [&](const json & item) noexcept -> void {
+									// Выполняем конвертирование полученной записи
+									const string & data = recordFn(worker, hash, item, ((records == 0) && (index == 0) && (++count == 1)));
+									// Если запись не сконвертирована
+									if(data.empty())
+										// Увеличиваем количество не сконвертированных записей
+										broken.at(index)++;
+									// Если запись сконвертирована
+									else {
+										// Добавляем сконвертированную запись
+										results.at(index).append(data);
+										// Добавляем разделитель записей
+										results.at(index).append(1, '\n');
+									}
+								});
+								// Запоминаем количество совпавших строк
+								matched.at(index) = counts.first;
+								// Запоминаем количество не совпавших строк
+								skipped.at(index) = counts.second;
+							};
+							// Если блок всего один
+							if(blocks.size() == 1)
+								// Выполняем сопоставление блока в текущем потоке
+								blockFn(0);
+							// Если блоков несколько
+							else {
+								// Выполняем передачу дополнительных блоков в очередь рабочих потоков
+								for(size_t i = 1; i < blocks.size(); i++){
+									// Добавляем задачу сопоставления блока
+									pool.push([&blockFn, i]() noexcept -> void {
+										// Выполняем сопоставление блока
+										blockFn(i);
+									});
+								}
+								// Первый блок сопоставляем в текущем потоке
+								blockFn(0);
+								// Выполняем ожидание сопоставления всех блоков прохода
+								pool.wait();
+							}
+							// Выполняем вывод результатов в исходном порядке строк
+							for(size_t i = 0; i < blocks.size(); i++){
+								// Увеличиваем количество полученных записей
+								records += matched.at(i);
+								// Увеличиваем количество записей которые не удалось сконвертировать
+								failed += broken.at(i);
+								// Увеличиваем количество не совпавших строк
+								unmatched += skipped.at(i);
+								// Добавляем сконвертированные записи в буфер вывода
+								output.append(results.at(i));
+								// Выполняем вывод накопленных данных
+								flushFn();
+							}
+						}
+						// Выводим количество обработанных байт
+						return offset;
+					};
+					// Если указан адрес файла или каталога для чтения
+					if(env.isString(false, "src")){
+						// Получаем адрес файла или каталога
+						const string & addr = env.get <string> (false, "src");
+						// Список файлов для сопоставления
+						vector <string> files;
+						// Если адрес является каталогом
+						if(fs.isDir(addr))
+							// Выполняем чтение каталога
+							fs.readDir(addr, "", true, [&files](const string & filename) noexcept -> void {
+								// Добавляем файл в список для сопоставления
+								files.push_back(filename);
+							});
+						// Добавляем указанный файл
+						else files.push_back(addr);
+						// Выполняем перебор всех файлов
+						for(auto & filename : files){
+							// Создаём объект отображения файла в память
+							mmap_t mapping(&fmk, &log);
+							// Если файл отображён в память
+							if(mapping.open(filename))
+								// Выполняем сопоставление всех строк файла
+								batchFn(mapping.view(), true);
+						}
+					// Выполняем чтение данных из stdin
+					} else {
+						// Количество прочитанных байт
+						ssize_t bytes = 0;
+						// Буфер накопленных строк
+						string buffer = "";
+						// Буфер для чтения данных из stdin
+						vector <char> chunk(0x10000);
+						// Выполняем чтение данных из stdin порциями
+						while((bytes = ::read(STDIN_FILENO, chunk.data(), chunk.size())) != 0){
+							// Если во время чтения произошла ошибка
+							if(bytes < 0){
+								// Если чтение было прервано сигналом, повторяем попытку
+								if(errno == EINTR)
+									// Продолжаем чтение
+									continue;
+								// Выходим из цикла
+								break;
+							}
+							// Добавляем полученную порцию данных в буфер
+							buffer.append(chunk.data(), static_cast <size_t> (bytes));
+							// Если накоплено достаточно строк для всех потоков
+							if(buffer.size() >= (block * threads))
+								// Выполняем сопоставление накопленных строк и удаляем их из буфера
+								buffer.erase(0, batchFn(buffer, false));
+						}
+						// Выполняем сопоставление оставшихся строк
+						batchFn(buffer, true);
+					}
+					// Если часть строк не совпала с регулярным выражением
+					if(unmatched > 0)
+						// Выводим сообщение об ошибке
+						log.print("GROK expression did not match %zu lines out of %zu", log_t::flag_t::WARNING, unmatched, unmatched + records);
+					// Если выражений несколько, выводим количество совпадений каждого выражения
+					if(expressions.size() > 1){
+						// Получаем количество совпадений основного парсера
+						vector <size_t> hits = parser.hits(expressions);
+						// Переходим по всем парсерам дополнительных потоков
+						for(auto & item : parsers){
+							// Получаем количество совпадений парсера потока
+							const auto & counts = item->hits(expressions);
+							// Переходим по всем выражениям
+							for(size_t i = 0; (i < counts.size()) && (i < hits.size()); i++)
+								// Суммируем количество совпадений
+								hits.at(i) += counts.at(i);
+						}
+						// Переходим по всем выражениям
+						for(size_t i = 0; i < hits.size(); i++)
+							// Выводим количество совпадений выражения
+							log.print("GROK expression #%zu matched %zu lines", log_t::flag_t::INFO, i + 1, hits.at(i));
+					}
+					// Получаем количество пропущенных строк и превышений ограничений основного парсера
+					size_t skipped = parser.skipped(expressions);
+					// Получаем количество превышений ограничений каждого выражения основного парсера
+					vector <size_t> timeouts = parser.timeouts(expressions);
+					// Переходим по всем парсерам дополнительных потоков
+					for(auto & item : parsers){
+						// Суммируем количество пропущенных строк
+						skipped += item->skipped(expressions);
+						// Получаем количество превышений ограничений парсера потока
+						const auto & counts = item->timeouts(expressions);
+						// Переходим по всем выражениям
+						for(size_t i = 0; (i < counts.size()) && (i < timeouts.size()); i++)
+							// Суммируем количество превышений ограничений
+							timeouts.at(i) += counts.at(i);
+					}
+					// Если часть строк пропущена из-за превышения ограничений
+					if(skipped > 0){
+						// Выводим количество пропущенных строк
+						log.print("GROK skipped %zu lines over the match limits", log_t::flag_t::WARNING, skipped);
+						// Переходим по всем выражениям
+						for(size_t i = 0; i < timeouts.size(); i++){
+							// Если выражение превышало ограничения
+							if(timeouts.at(i) > 0)
+								// Выводим количество превышений ограничений выражения
+								log.print("GROK expression #%zu exceeded the match limits on %zu lines", log_t::flag_t::WARNING, i + 1, timeouts.at(i));
+						}
+					}
+				// Если указан адрес файла для чтения
+				} else if(env.isString(false, "src")) {
+					// Создаём объект отображения файла в память
+					mmap_t mapping(&fmk, &log);
+					// Если файл отображён в память
+					if(mapping.open(env.get <string> (false, "src"))){
+						// Размер порции данных файла
+						const size_t size = 0x10000;
+						// Выполняем разбор файла на записи порциями, чтобы вывод шёл по мере конвертирования
+						for(size_t offset = 0; offset < mapping.size(); offset += size){
+							// Передаём очередную порцию данных на разбор
+							reader.push(mapping.data() + offset, std::min(size, mapping.size() - offset));
+							// Выполняем вывод накопленных данных
+							flushFn();
+						}
+					}
+					// Выполняем обработку последней записи
+					reader.finish();
+				// Выполняем разбор потока на записи
+				} else {
+					// Количество прочитанных байт
+					ssize_t bytes = 0;
+					// Буфер для чтения данных из stdin
+					vector <char> buffer(0x10000);
+					/**
+					 * waitFn Функция ожидания данных stdin с выводом многострочного события по истечении времени
+					 */
+					auto waitFn = [&]() noexcept -> void {
+						/**
+						 * Выполняем работу для Unix
+						 */
+						#if !defined(_WIN32) && !defined(_WIN64)
+							// Если ожидающее многострочное событие выводится по истечении времени
+							if(multiline && (joiner.timeout() > 0)){
+								// Параметры ожидания данных stdin
+								struct pollfd fds = {STDIN_FILENO, POLLIN, 0};
+								// Выполняем ожидание данных stdin не дольше времени ожидания события
+								while(::poll(&fds, 1, static_cast <int> (joiner.timeout())) == 0){
+									// Если ожидающее событие выведено
+									if(joiner.idle())
+										// Выполняем вывод накопленных данных
+										flushFn();
+								}
+							}
+						#endif
+					};
+					// Выполняем ожидание первой порции данных stdin
+					waitFn();
+					// Выполняем чтение данных из stdin порциями
+					while((bytes = ::read(STDIN_FILENO, buffer.data(), buffer.size())) != 0){
+						// Если во время чтения произошла ошибка
+						if(bytes < 0){
+							// Если чтение было прервано сигналом, повторяем попытку
+							if(errno == EINTR)
+								// Продолжаем чтение
+								continue;
+							// Выходим из цикла
+							break;
+						}
+						// Передаём полученную порцию данных на разбор
+						reader.push(buffer.data(), static_cast <size_t> (bytes));
+						// Выполняем вывод накопленных данных
+						flushFn();
+						// Выполняем ожидание следующей порции данных stdin
+						waitFn();
+					}
+					// Выполняем обработку последней записи
+					reader.finish();
+				}
+				// Выполняем вывод последнего многострочного события
+				joiner.finish();
+				// Выполняем вывод накопленных данных
+				flushFn();
+				// Если часть записей не удалось сконвертировать
+				if(failed > 0)
+					// Выводим сообщение об ошибке
+					log.print("Conversion of %zu records out of %zu from \"%s\" format to \"%s\" format is failed", log_t::flag_t::WARNING, failed, records, fmk.transform(env.get <string> (false, "from"), fmk_t::transform_t::UPPER).c_str(), fmk.transform(env.get <string> (false, "to"), fmk_t::transform_t::UPPER).c_str());
+			// Если данные прочитаны из потока
+			} else if(!text.empty()){
+				// Адрес файла для потокового вывода
+				string filename = "";
+				// Массив записей JSON конвертируется в CSV с выводом строк по мере разбора
+				const bool streamed = ((target == parser_t::format_t::CSV) && targetFn("result", false, filename) && (streamFn(parser, text, filename) > 0));
+				// Выполняем прямое конвертирование без построения промежуточного объекта JSON
+				const string transcoded = (!streamed ? parser.transcode(text, source, target, env.isBoolean(false, "prettify"), header, delim) : "");
+				// Объект в формате JSON
+				json result(kObjectType);
+				// Если строки уже выведены
+				if(streamed)
+					// Сбрасываем объект результата, дальнейший вывод не требуется
+					result.SetNull();
+				// Если прямое конвертирование не выполнено
+				else if(transcoded.empty()){
+					// Определяем формат данных
+					switch(static_cast <uint8_t> (from)){
+						// Если формат входящих данных указан как Text
+						case static_cast <uint8_t> (type_t::TEXT):
+							// Выполняем передачу данных как она есть
+							result.SetString(text.c_str(), text.length(), result.GetAllocator());
+						break;
+						// Если формат входящих данных указан как XML
+						case static_cast <uint8_t> (type_t::XML):
+							// Выполняем конвертацию данных
+							result = parser.xml(text);
+						break;
+						// Если формат входящих данных указан как JSON
+						case static_cast <uint8_t> (type_t::JSON):
+							// Выполняем конвертацию данных
+							result = parser.json(text);
+						break;
+						// Если формат входящих данных указан как INI
+						case static_cast <uint8_t> (type_t::INI):
+							// Выполняем конвертацию данных
+							result = parser.ini(text);
+						break;
+						// Если формат входящих данных указан как YAML
+						case static_cast <uint8_t> (type_t::YAML):
+							// Выполняем конвертацию данных
+							result = parser.yaml(text);
+						break;
+						// Если формат входящих данных указан как CEF
+						case static_cast <uint8_t> (type_t::CEF): {
+							// Режим парсинга CEF по умолчанию
+							cef_t::mode_t mode = cef_t::mode_t::STRONG;
+							// Если режим парсинга CEF передан
+							if(env.isString(false, "cef")){
+								// Получаем режим парсинга
+								const string & cef = env.get <string> (false, "cef");
+								// Если режим парсинга установлен как строгий
+								if(fmk.compare("strong", cef))
+									// Устанавливаем строгий режим парсинга
+									mode = cef_t::mode_t::STRONG;
+								// Если режим парсинга установлен как простой
+								else if(fmk.compare("low", cef))
+									// Устанавливаем простой режим парсинга
+									mode = cef_t::mode_t::LOW;
+								// Если режим парсинга установлен как средний
+								else if(fmk.compare("medium", cef))
+									// Устанавливаем средний режим парсинга
+									mode = cef_t::mode_t::MEDIUM;
+							}
+							// Выполняем конвертацию данных
+							result = parser.cef(text, mode);
+						} break;
+						// Если формат входящих данных указан как CSV
+						case static_cast <uint8_t> (type_t::CSV):
+							// Выполняем конвертацию данных
+							result = parser.csv(text, env.isBoolean(false, "header"));
+						break;
+						// Если формат входящих данных указан как GROK
+						case static_cast <uint8_t> (type_t::GROK):
+							// Выполняем конвертацию данных
+							result = parser.grok(text, expressions);
+						break;
+						// Если формат входящих данных указан как SysLog
+						case static_cast <uint8_t> (type_t::SYSLOG):
+							// Выполняем конвертацию данных
+							result = parser.syslog(text);
+						break;
+						// Если формат входящих данных указан как BASE64
+						case static_cast <uint8_t> (type_t::BASE64): {
+							// Выполняем декодирование хэша BASE64
+							const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
+							// Выполняем установку полученного хэша BASE64
+							result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
+						} break;
+					}
 				}
 				// Если результат получен
 				if(!result.IsNull()){
@@ -671,7 +1770,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 								// Если формат входящих данных указан как JSON
 								case static_cast <uint8_t> (type_t::JSON):
 									// Выполняем конвертирование в формат JSON
-									buffer = parser.json(result, env.isBoolean(false, "prettify"));
+									buffer = (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify")));
 								break;
 								// Если формат входящих данных указан как INI
 								case static_cast <uint8_t> (type_t::INI):
@@ -681,7 +1780,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 								// Если формат входящих данных указан как YAML
 								case static_cast <uint8_t> (type_t::YAML):
 									// Выполняем конвертирование в формат YAML
-									buffer = parser.yaml(result);
+									buffer = (!transcoded.empty() ? transcoded : parser.yaml(result));
 								break;
 								// Если формат входящих данных указан как CEF
 								case static_cast <uint8_t> (type_t::CEF): {
@@ -710,7 +1809,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 								// Если формат входящих данных указан как CSV
 								case static_cast <uint8_t> (type_t::CSV):
 									// Выполняем конвертирование в формат CSV
-									buffer = parser.csv(result, env.isBoolean(false, "header"), (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'));
+									buffer = (!transcoded.empty() ? transcoded : parser.csv(result, env.isBoolean(false, "header"), delim));
 								break;
 								// Если формат входящих данных указан как SysLog
 								case static_cast <uint8_t> (type_t::SYSLOG):
@@ -815,7 +1914,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 							// Если формат входящих данных указан как JSON
 							case static_cast <uint8_t> (type_t::JSON):
 								// Выполняем конвертирование в формат JSON
-								cout << parser.json(result, env.isBoolean(false, "prettify")) << endl;
+								cout << (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify"))) << endl;
 							break;
 							// Если формат входящих данных указан как INI
 							case static_cast <uint8_t> (type_t::INI):
@@ -825,7 +1924,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 							// Если формат входящих данных указан как YAML
 							case static_cast <uint8_t> (type_t::YAML):
 								// Выполняем конвертирование в формат YAML
-								cout << parser.yaml(result) << endl;
+								cout << (!transcoded.empty() ? transcoded : parser.yaml(result)) << endl;
 							break;
 							// Если формат входящих данных указан как CEF
 							case static_cast <uint8_t> (type_t::CEF): {
@@ -854,7 +1953,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 							// Если формат входящих данных указан как CSV
 							case static_cast <uint8_t> (type_t::CSV):
 								// Выполняем конвертирование в формат CSV
-								cout << parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';')) << endl;
+								cout << (!transcoded.empty() ? transcoded : parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'))) << endl;
 							break;
 							// Если формат входящих данных указан как SysLog
 							case static_cast <uint8_t> (type_t::SYSLOG):
@@ -942,90 +2041,132 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 					// Переводим расширение в нижний регистр
 					fmk.transform(extension, fmk_t::transform_t::LOWER);
 					// Выполняем чтение каталога
-					fs.readDir(addr, extension, true, [&](const string & filename) noexcept -> void {
-						// Выполняем чтение данных файла
-						const auto & buffer = fs.read(filename);
+					// Список файлов для конвертирования
+					vector <string> files;
+					// Выполняем чтение каталога
+					fs.readDir(addr, extension, true, [&files](const string & filename) noexcept -> void {
+						// Добавляем файл в список для конвертирования
+						files.push_back(filename);
+					});
+					// Мютекс для блокировки вывода результата
+					std::mutex locker;
+					// Количество сконвертированных и не сконвертированных файлов
+					atomic <size_t> converted(0), failed(0);
+					/**
+					 * convertFn Функция конвертирования одного файла
+					 * @param parser   объект парсера текущего потока
+					 * @param filename адрес файла для конвертирования
+					 * @return         результат конвертирования файла
+					 */
+					auto convertFn = [&](parser_t & parser, const string & filename) noexcept -> bool {
+						// Создаём объект отображения файла в память
+						mmap_t mapping(&fmk, &log);
+						// Выполняем отображение данных файла в память
+						mapping.open(filename);
 						// Получаем название файла
 						const string & name = fs.components(filename).first;
 						// Если данные файла загружены
-						if(!buffer.empty()){
+						if(!mapping.empty()){
+							// Получаем текст файла без копирования
+							const string_view text = mapping.view();
+							// Если массив записей JSON конвертируется в CSV
+							if(target == parser_t::format_t::CSV){
+								// Адрес файла для потокового вывода
+								string filename = "";
+								// Если адрес файла для сохранения получен
+								if(targetFn(name, true, filename)){
+									// Блокировка вывода, чтобы строки разных файлов не перемешивались
+									unique_lock <std::mutex> lock(locker, std::defer_lock);
+									// Если строки выводятся в поток вывода
+									if(filename.empty())
+										// Выполняем блокировку вывода
+										lock.lock();
+									// Выполняем конвертирование с выводом строк по мере разбора
+									if(streamFn(parser, text, filename) > 0)
+										// Сообщаем, что файл сконвертирован
+										return true;
+								}
+							}
+							// Выполняем прямое конвертирование без построения промежуточного объекта JSON
+							const string transcoded = parser.transcode(text, source, target, env.isBoolean(false, "prettify"), header, delim);
 							// Объект в формате JSON
 							json result(kObjectType);
-							// Формируем полученный текст
-							const string text(buffer.begin(), buffer.end());
-							// Определяем формат данных
-							switch(static_cast <uint8_t> (from)){
-								// Если формат входящих данных указан как Text
-								case static_cast <uint8_t> (type_t::TEXT):
-									// Выполняем передачу данных как она есть
-									result.SetString(text.c_str(), text.length(), result.GetAllocator());
-								break;
-								// Если формат входящих данных указан как XML
-								case static_cast <uint8_t> (type_t::XML):
-									// Выполняем конвертацию данных
-									result = parser.xml(text);
-								break;
-								// Если формат входящих данных указан как JSON
-								case static_cast <uint8_t> (type_t::JSON):
-									// Выполняем конвертацию данных
-									result = parser.json(text);
-								break;
-								// Если формат входящих данных указан как INI
-								case static_cast <uint8_t> (type_t::INI):
-									// Выполняем конвертацию данных
-									result = parser.ini(text);
-								break;
-								// Если формат входящих данных указан как YAML
-								case static_cast <uint8_t> (type_t::YAML):
-									// Выполняем конвертацию данных
-									result = parser.yaml(text);
-								break;
-								// Если формат входящих данных указан как CEF
-								case static_cast <uint8_t> (type_t::CEF): {
-									// Режим парсинга CEF по умолчанию
-									cef_t::mode_t mode = cef_t::mode_t::STRONG;
-									// Если режим парсинга CEF передан
-									if(env.isString(false, "cef")){
-										// Получаем режим парсинга
-										const string & cef = env.get <string> (false, "cef");
-										// Если режим парсинга установлен как строгий
-										if(fmk.compare("strong", cef))
-											// Устанавливаем строгий режим парсинга
-											mode = cef_t::mode_t::STRONG;
-										// Если режим парсинга установлен как простой
-										else if(fmk.compare("low", cef))
-											// Устанавливаем простой режим парсинга
-											mode = cef_t::mode_t::LOW;
-										// Если режим парсинга установлен как средний
-										else if(fmk.compare("medium", cef))
-											// Устанавливаем средний режим парсинга
-											mode = cef_t::mode_t::MEDIUM;
-									}
-									// Выполняем конвертацию данных
-									result = parser.cef(text, mode);
-								} break;
-								// Если формат входящих данных указан как CSV
-								case static_cast <uint8_t> (type_t::CSV):
-									// Выполняем конвертацию данных
-									result = parser.csv(text, env.isBoolean(false, "header"));
-								break;
-								// Если формат входящих данных указан как GROK
-								case static_cast <uint8_t> (type_t::GROK):
-									// Выполняем конвертацию данных
-									result = parser.grok(text, express);
-								break;
-								// Если формат входящих данных указан как SysLog
-								case static_cast <uint8_t> (type_t::SYSLOG):
-									// Выполняем конвертацию данных
-									result = parser.syslog(text);
-								break;
-								// Если формат входящих данных указан как BASE64
-								case static_cast <uint8_t> (type_t::BASE64): {
-									// Выполняем декодирование хэша BASE64
-									const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
-									// Выполняем установку полученного хэша BASE64
-									result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
-								} break;
+							// Если прямое конвертирование не выполнено
+							if(transcoded.empty()){
+								// Определяем формат данных
+								switch(static_cast <uint8_t> (from)){
+									// Если формат входящих данных указан как Text
+									case static_cast <uint8_t> (type_t::TEXT):
+										// Выполняем передачу данных как она есть
+										result.SetString(text.data(), text.length(), result.GetAllocator());
+									break;
+									// Если формат входящих данных указан как XML
+									case static_cast <uint8_t> (type_t::XML):
+										// Выполняем конвертацию данных
+										result = parser.xml(text);
+									break;
+									// Если формат входящих данных указан как JSON
+									case static_cast <uint8_t> (type_t::JSON):
+										// Выполняем конвертацию данных
+										result = parser.json(text);
+									break;
+									// Если формат входящих данных указан как INI
+									case static_cast <uint8_t> (type_t::INI):
+										// Выполняем конвертацию данных
+										result = parser.ini(text);
+									break;
+									// Если формат входящих данных указан как YAML
+									case static_cast <uint8_t> (type_t::YAML):
+										// Выполняем конвертацию данных
+										result = parser.yaml(text);
+									break;
+									// Если формат входящих данных указан как CEF
+									case static_cast <uint8_t> (type_t::CEF): {
+										// Режим парсинга CEF по умолчанию
+										cef_t::mode_t mode = cef_t::mode_t::STRONG;
+										// Если режим парсинга CEF передан
+										if(env.isString(false, "cef")){
+											// Получаем режим парсинга
+											const string & cef = env.get <string> (false, "cef");
+											// Если режим парсинга установлен как строгий
+											if(fmk.compare("strong", cef))
+												// Устанавливаем строгий режим парсинга
+												mode = cef_t::mode_t::STRONG;
+											// Если режим парсинга установлен как простой
+											else if(fmk.compare("low", cef))
+												// Устанавливаем простой режим парсинга
+												mode = cef_t::mode_t::LOW;
+											// Если режим парсинга установлен как средний
+											else if(fmk.compare("medium", cef))
+												// Устанавливаем средний режим парсинга
+												mode = cef_t::mode_t::MEDIUM;
+										}
+										// Выполняем конвертацию данных
+										result = parser.cef(text, mode);
+									} break;
+									// Если формат входящих данных указан как CSV
+									case static_cast <uint8_t> (type_t::CSV):
+										// Выполняем конвертацию данных
+										result = parser.csv(text, env.isBoolean(false, "header"));
+									break;
+									// Если формат входящих данных указан как GROK
+									case static_cast <uint8_t> (type_t::GROK):
+										// Выполняем конвертацию данных
+										result = parser.grok(text, expressions);
+									break;
+									// Если формат входящих данных указан как SysLog
+									case static_cast <uint8_t> (type_t::SYSLOG):
+										// Выполняем конвертацию данных
+										result = parser.syslog(text);
+									break;
+									// Если формат входящих данных указан как BASE64
+									case static_cast <uint8_t> (type_t::BASE64): {
+										// Выполняем декодирование хэша BASE64
+										const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
+										// Выполняем установку полученного хэша BASE64
+										result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
+									} break;
+								}
 							}
 							// Если результат получен
 							if(!result.IsNull()){
@@ -1043,15 +2184,15 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											if(!fs.isDir(addr)){
 												// Выводим сообщение об ошибке
 												log.print("Directory at address \"%s\" could not be created", log_t::flag_t::CRITICAL, addr.c_str());
-												// Выводим удачное завершение работы
-												return;
+												// Сообщаем, что файл не сконвертирован
+												return false;
 											}
 										// Если адрес передан в качестве файла
 										} else if(fs.isFile(addr)) {
 											// Выводим сообщение об ошибке
 											log.print("Destination address must be a directory and not a file \"%s\"", log_t::flag_t::CRITICAL, addr.c_str());
-											// Выводим удачное завершение работы
-											return;
+											// Сообщаем, что файл не сконвертирован
+											return false;
 										}
 										// Буфер данных для записи
 										string buffer = "";
@@ -1070,7 +2211,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											// Если формат входящих данных указан как JSON
 											case static_cast <uint8_t> (type_t::JSON):
 												// Выполняем конвертирование в формат JSON
-												buffer = parser.json(result, env.isBoolean(false, "prettify"));
+												buffer = (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify")));
 											break;
 											// Если формат входящих данных указан как INI
 											case static_cast <uint8_t> (type_t::INI):
@@ -1080,7 +2221,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											// Если формат входящих данных указан как YAML
 											case static_cast <uint8_t> (type_t::YAML):
 												// Выполняем конвертирование в формат YAML
-												buffer = parser.yaml(result);
+												buffer = (!transcoded.empty() ? transcoded : parser.yaml(result));
 											break;
 											// Если формат входящих данных указан как CEF
 											case static_cast <uint8_t> (type_t::CEF): {
@@ -1109,7 +2250,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											// Если формат входящих данных указан как CSV
 											case static_cast <uint8_t> (type_t::CSV):
 												// Выполняем конвертирование в формат CSV
-												buffer = parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'));
+												buffer = (!transcoded.empty() ? transcoded : parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';')));
 											break;
 											// Если формат входящих данных указан как SysLog
 											case static_cast <uint8_t> (type_t::SYSLOG):
@@ -1192,17 +2333,22 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											fmk.transform(extension, fmk_t::transform_t::LOWER);
 											// Выполняем запись данных в файл
 											fs.write(fmk.format("%s%s%s.%s", addr.c_str(), AWH_FS_SEPARATOR, name.c_str(), extension.c_str()), buffer.data(), buffer.size());
+											// Сообщаем, что файл сконвертирован
+											return true;
+										}
 										// Выводим сообщение об ошибке
-										} else log.print("Conversion from \"%s\" format to \"%s\" format is failed", log_t::flag_t::WARNING, fmk.transform(env.get <string> (false, "from"), fmk_t::transform_t::UPPER).c_str(), fmk.transform(env.get <string> (false, "to"), fmk_t::transform_t::UPPER).c_str());
-										// Выводим удачное завершение работы
-										return;
+										log.print("Conversion from \"%s\" format to \"%s\" format is failed", log_t::flag_t::WARNING, fmk.transform(env.get <string> (false, "from"), fmk_t::transform_t::UPPER).c_str(), fmk.transform(env.get <string> (false, "to"), fmk_t::transform_t::UPPER).c_str());
+										// Сообщаем, что файл не сконвертирован
+										return false;
 									}
 									// Выводим сообщение об ошибке
 									log.print("Directory address is not set", log_t::flag_t::CRITICAL);
-									// Выводим удачное завершение работы
-									return;
+									// Сообщаем, что файл не сконвертирован
+									return false;
 								// Если адрес для сохранения файла не указан
 								} else {
+									// Выполняем блокировку вывода, чтобы результаты разных файлов не перемешивались
+									const lock_guard <std::mutex> lock(locker);
 									// Определяем формат данных
 									switch(static_cast <uint8_t> (to)){
 										// Если формат входящих данных указан как Text
@@ -1218,7 +2364,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как JSON
 										case static_cast <uint8_t> (type_t::JSON):
 											// Выполняем конвертирование в формат JSON
-											cout << parser.json(result, env.isBoolean(false, "prettify")) << endl;
+											cout << (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify"))) << endl;
 										break;
 										// Если формат входящих данных указан как INI
 										case static_cast <uint8_t> (type_t::INI):
@@ -1228,7 +2374,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как YAML
 										case static_cast <uint8_t> (type_t::YAML):
 											// Выполняем конвертирование в формат YAML
-											cout << parser.yaml(result) << endl;
+											cout << (!transcoded.empty() ? transcoded : parser.yaml(result)) << endl;
 										break;
 										// Если формат входящих данных указан как CEF
 										case static_cast <uint8_t> (type_t::CEF): {
@@ -1257,7 +2403,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как CSV
 										case static_cast <uint8_t> (type_t::CSV):
 											// Выполняем конвертирование в формат CSV
-											cout << parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';')) << endl;
+											cout << (!transcoded.empty() ? transcoded : parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'))) << endl;
 										break;
 										// Если формат входящих данных указан как SysLog
 										case static_cast <uint8_t> (type_t::SYSLOG):
@@ -1332,95 +2478,171 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 											cout << hash_t(&log).hmac <string> (hmac, result.GetString(), hash_t::type_t::SHA512) << endl;
 										break;
 									}
+									// Сообщаем, что файл сконвертирован
+									return true;
 								}
 							}
 						}
-					});
+						// Сообщаем, что файл не сконвертирован
+						return false;
+					};
+					// Потоков не должно быть больше чем файлов
+					threads = std::max(static_cast <size_t> (1), std::min(threads, files.size()));
+					// Если конвертирование выполняется в одном потоке
+					if(threads == 1){
+						// Выполняем перебор всех файлов каталога
+						for(auto & filename : files){
+							// Выполняем конвертирование файла
+							if(convertFn(parser, filename))
+								// Увеличиваем количество сконвертированных файлов
+								converted++;
+							// Увеличиваем количество не сконвертированных файлов
+							else failed++;
+						}
+					// Если конвертирование выполняется в пуле потоков
+					} else {
+						// Индекс следующего файла для конвертирования
+						atomic <size_t> index(0);
+						// Список рабочих потоков
+						vector <std::thread> workers;
+						// Выделяем память для рабочих потоков
+						workers.reserve(threads);
+						// Выполняем запуск рабочих потоков
+						for(size_t i = 0; i < threads; i++){
+							// Добавляем рабочий поток
+							workers.emplace_back([&]() noexcept -> void {
+								// Создаём собственный объект парсера рабочего потока
+								parser_t worker(&fmk, &log);
+								// Выполняем установку ограничений выполнения регулярных выражений
+								worker.limits(limits);
+								// Если формат входящих данных указан как GROK
+								if(from == type_t::GROK)
+									// Используем шаблоны и собранные выражения основного парсера без повторной загрузки пакета
+									worker.share(parser);
+								// Индекс текущего файла
+								size_t current = 0;
+								// Выполняем получение файлов до тех пор, пока они не закончатся
+								while((current = index.fetch_add(1)) < files.size()){
+									// Выполняем конвертирование файла
+									if(convertFn(worker, files.at(current)))
+										// Увеличиваем количество сконвертированных файлов
+										converted++;
+									// Увеличиваем количество не сконвертированных файлов
+									else failed++;
+								}
+							});
+						}
+						// Выполняем ожидание завершения рабочих потоков
+						for(auto & worker : workers)
+							// Ожидаем завершения рабочего потока
+							worker.join();
+					}
+					// Если есть не сконвертированные файлы
+					if(failed > 0)
+						// Выводим итоговое сообщение
+						log.print("Converted %zu files, failed to convert %zu files using %zu threads", log_t::flag_t::WARNING, converted.load(), failed.load(), threads);
+					// Выводим итоговое сообщение
+					else log.print("Converted %zu files using %zu threads", log_t::flag_t::INFO, converted.load(), threads);
 				// Если адрес является файлом
 				} else if(fs.isFile(addr)) {
-					// Выполняем чтение данных файла
-					const auto & buffer = fs.read(addr);
+					// Создаём объект отображения файла в память
+					mmap_t mapping(&fmk, &log);
+					// Выполняем отображение данных файла в память
+					mapping.open(addr);
 					// Получаем название файла
 					const string & name = fs.components(addr).first;
 					// Если данные файла загружены
-					if(!buffer.empty()){
+					if(!mapping.empty()){
+						// Получаем текст файла без копирования
+						const string_view text = mapping.view();
+						// Адрес файла для потокового вывода
+						string filename = "";
+						// Массив записей JSON конвертируется в CSV с выводом строк по мере разбора
+						const bool streamed = ((target == parser_t::format_t::CSV) && targetFn(name, false, filename) && (streamFn(parser, text, filename) > 0));
+						// Выполняем прямое конвертирование без построения промежуточного объекта JSON
+						const string transcoded = (!streamed ? parser.transcode(text, source, target, env.isBoolean(false, "prettify"), header, delim) : "");
 						// Объект в формате JSON
 						json result(kObjectType);
-						// Формируем полученный текст
-						const string text(buffer.begin(), buffer.end());
-						// Определяем формат данных
-						switch(static_cast <uint8_t> (from)){
-							// Если формат входящих данных указан как Text
-							case static_cast <uint8_t> (type_t::TEXT):
-								// Выполняем передачу данных как она есть
-								result.SetString(text.c_str(), text.length(), result.GetAllocator());
-							break;
-							// Если формат входящих данных указан как XML
-							case static_cast <uint8_t> (type_t::XML):
-								// Выполняем конвертацию данных
-								result = parser.xml(text);
-							break;
-							// Если формат входящих данных указан как JSON
-							case static_cast <uint8_t> (type_t::JSON):
-								// Выполняем конвертацию данных
-								result = parser.json(text);
-							break;
-							// Если формат входящих данных указан как INI
-							case static_cast <uint8_t> (type_t::INI):
-								// Выполняем конвертацию данных
-								result = parser.ini(text);
-							break;
-							// Если формат входящих данных указан как YAML
-							case static_cast <uint8_t> (type_t::YAML):
-								// Выполняем конвертацию данных
-								result = parser.yaml(text);
-							break;
-							// Если формат входящих данных указан как CEF
-							case static_cast <uint8_t> (type_t::CEF): {
-								// Режим парсинга CEF по умолчанию
-								cef_t::mode_t mode = cef_t::mode_t::STRONG;
-								// Если режим парсинга CEF передан
-								if(env.isString(false, "cef")){
-									// Получаем режим парсинга
-									const string & cef = env.get <string> (false, "cef");
-									// Если режим парсинга установлен как строгий
-									if(fmk.compare("strong", cef))
-										// Устанавливаем строгий режим парсинга
-										mode = cef_t::mode_t::STRONG;
-									// Если режим парсинга установлен как простой
-									else if(fmk.compare("low", cef))
-										// Устанавливаем простой режим парсинга
-										mode = cef_t::mode_t::LOW;
-									// Если режим парсинга установлен как средний
-									else if(fmk.compare("medium", cef))
-										// Устанавливаем средний режим парсинга
-										mode = cef_t::mode_t::MEDIUM;
-								}
-								// Выполняем конвертацию данных
-								result = parser.cef(text, mode);
-							} break;
-							// Если формат входящих данных указан как CSV
-							case static_cast <uint8_t> (type_t::CSV):
-								// Выполняем конвертацию данных
-								result = parser.csv(text, env.isBoolean(false, "header"));
-							break;
-							// Если формат входящих данных указан как GROK
-							case static_cast <uint8_t> (type_t::GROK):
-								// Выполняем конвертацию данных
-								result = parser.grok(text, express);
-							break;
-							// Если формат входящих данных указан как SysLog
-							case static_cast <uint8_t> (type_t::SYSLOG):
-								// Выполняем конвертацию данных
-								result = parser.syslog(text);
-							break;
-							// Если формат входящих данных указан как BASE64
-							case static_cast <uint8_t> (type_t::BASE64): {
-								// Выполняем декодирование хэша BASE64
-								const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
-								// Выполняем установку входящих данных в результат
-								result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
-							} break;
+						// Если строки уже выведены
+						if(streamed)
+							// Сбрасываем объект результата, дальнейший вывод не требуется
+							result.SetNull();
+						// Если прямое конвертирование не выполнено
+						else if(transcoded.empty()){
+							// Определяем формат данных
+							switch(static_cast <uint8_t> (from)){
+								// Если формат входящих данных указан как Text
+								case static_cast <uint8_t> (type_t::TEXT):
+									// Выполняем передачу данных как она есть
+									result.SetString(text.data(), text.length(), result.GetAllocator());
+								break;
+								// Если формат входящих данных указан как XML
+								case static_cast <uint8_t> (type_t::XML):
+									// Выполняем конвертацию данных
+									result = parser.xml(text);
+								break;
+								// Если формат входящих данных указан как JSON
+								case static_cast <uint8_t> (type_t::JSON):
+									// Выполняем конвертацию данных
+									result = parser.json(text);
+								break;
+								// Если формат входящих данных указан как INI
+								case static_cast <uint8_t> (type_t::INI):
+									// Выполняем конвертацию данных
+									result = parser.ini(text);
+								break;
+								// Если формат входящих данных указан как YAML
+								case static_cast <uint8_t> (type_t::YAML):
+									// Выполняем конвертацию данных
+									result = parser.yaml(text);
+								break;
+								// Если формат входящих данных указан как CEF
+								case static_cast <uint8_t> (type_t::CEF): {
+									// Режим парсинга CEF по умолчанию
+									cef_t::mode_t mode = cef_t::mode_t::STRONG;
+									// Если режим парсинга CEF передан
+									if(env.isString(false, "cef")){
+										// Получаем режим парсинга
+										const string & cef = env.get <string> (false, "cef");
+										// Если режим парсинга установлен как строгий
+										if(fmk.compare("strong", cef))
+											// Устанавливаем строгий режим парсинга
+											mode = cef_t::mode_t::STRONG;
+										// Если режим парсинга установлен как простой
+										else if(fmk.compare("low", cef))
+											// Устанавливаем простой режим парсинга
+											mode = cef_t::mode_t::LOW;
+										// Если режим парсинга установлен как средний
+										else if(fmk.compare("medium", cef))
+											// Устанавливаем средний режим парсинга
+											mode = cef_t::mode_t::MEDIUM;
+									}
+									// Выполняем конвертацию данных
+									result = parser.cef(text, mode);
+								} break;
+								// Если формат входящих данных указан как CSV
+								case static_cast <uint8_t> (type_t::CSV):
+									// Выполняем конвертацию данных
+									result = parser.csv(text, env.isBoolean(false, "header"));
+								break;
+								// Если формат входящих данных указан как GROK
+								case static_cast <uint8_t> (type_t::GROK):
+									// Выполняем конвертацию данных
+									result = parser.grok(text, expressions);
+								break;
+								// Если формат входящих данных указан как SysLog
+								case static_cast <uint8_t> (type_t::SYSLOG):
+									// Выполняем конвертацию данных
+									result = parser.syslog(text);
+								break;
+								// Если формат входящих данных указан как BASE64
+								case static_cast <uint8_t> (type_t::BASE64): {
+									// Выполняем декодирование хэша BASE64
+									const string & hash = hash_t(&log).decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
+									// Выполняем установку входящих данных в результат
+									result.SetString(hash.c_str(), hash.length(), result.GetAllocator());
+								} break;
+							}
 						}
 						// Если результат получен
 						if(!result.IsNull()){
@@ -1458,7 +2680,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как JSON
 										case static_cast <uint8_t> (type_t::JSON):
 											// Выполняем конвертирование в формат JSON
-											buffer = parser.json(result, env.isBoolean(false, "prettify"));
+											buffer = (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify")));
 										break;
 										// Если формат входящих данных указан как INI
 										case static_cast <uint8_t> (type_t::INI):
@@ -1468,7 +2690,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как YAML
 										case static_cast <uint8_t> (type_t::YAML):
 											// Выполняем конвертирование в формат YAML
-											buffer = parser.yaml(result);
+											buffer = (!transcoded.empty() ? transcoded : parser.yaml(result));
 										break;
 										// Если формат входящих данных указан как CEF
 										case static_cast <uint8_t> (type_t::CEF): {
@@ -1497,7 +2719,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 										// Если формат входящих данных указан как CSV
 										case static_cast <uint8_t> (type_t::CSV):
 											// Выполняем конвертирование в формат CSV
-											buffer = parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'));
+											buffer = (!transcoded.empty() ? transcoded : parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';')));
 										break;
 										// Если формат входящих данных указан как SysLog
 										case static_cast <uint8_t> (type_t::SYSLOG):
@@ -1602,7 +2824,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 									// Если формат входящих данных указан как JSON
 									case static_cast <uint8_t> (type_t::JSON):
 										// Выполняем конвертирование в формат JSON
-										cout << parser.json(result, env.isBoolean(false, "prettify")) << endl;
+										cout << (!transcoded.empty() ? transcoded : parser.json(result, env.isBoolean(false, "prettify"))) << endl;
 									break;
 									// Если формат входящих данных указан как INI
 									case static_cast <uint8_t> (type_t::INI):
@@ -1612,7 +2834,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 									// Если формат входящих данных указан как YAML
 									case static_cast <uint8_t> (type_t::YAML):
 										// Выполняем конвертирование в формат YAML
-										cout << parser.yaml(result) << endl;
+										cout << (!transcoded.empty() ? transcoded : parser.yaml(result)) << endl;
 									break;
 									// Если формат входящих данных указан как CEF
 									case static_cast <uint8_t> (type_t::CEF): {
@@ -1641,7 +2863,7 @@ static void version(const fmk_t * fmk, const log_t * log, const fs_t * fs, const
 									// Если формат входящих данных указан как CSV
 									case static_cast <uint8_t> (type_t::CSV):
 										// Выполняем конвертирование в формат CSV
-										cout << parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';')) << endl;
+										cout << (!transcoded.empty() ? transcoded : parser.csv(result, (env.isString(false, "delim") ? env.get <string> (false, "delim").front() : ';'))) << endl;
 									break;
 									// Если формат входящих данных указан как SysLog
 									case static_cast <uint8_t> (type_t::SYSLOG):
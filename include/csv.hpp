@@ -22,10 +22,16 @@
 /**
  * Подключаем зависимые заголовки
  */
+#include <cmath>
 #include <vector>
+#include <memory>
 #include <string>
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
 #include <iostream>
 #include <algorithm>
+#include <string_view>
 #include <functional>
 
 /**
@@ -35,6 +41,12 @@
 #include <awh/sys/fmk.hpp>
 #include <awh/sys/log.hpp>
 
+/**
+ * Наши модули
+ */
+#include <mmap.hpp>
+#include <workers.hpp>
+
 /**
  * Подключаем заголовочные файлы JSON
  */
@@ -64,15 +76,94 @@ namespace anyks {
 	 *
 	 */
 	typedef class ACU_SHARED_EXPORT CSV {
+		public:
+			/**
+			 * Режим хранения ячеек
+			 */
+			enum class storage_t : uint8_t {
+				STRINGS = 0x00, // Каждая ячейка хранится отдельной строкой
+				ARENA   = 0x01  // Ячейки хранятся в едином буфере, строки задаются смещениями
+			};
+		private:
+			/**
+			 * Тип значений столбца
+			 */
+			enum class type_t : uint8_t {
+				NONE    = 0x00, // Тип не определён, значения проверяются по отдельности
+				NUMBER  = 0x01, // Целые числа
+				DECIMAL = 0x02, // Числа с плавающей точкой
+				BOOLEAN = 0x03, // Булевы значения
+				STRING  = 0x04  // Строки, значения выводятся без проверки
+			};
+			/**
+			 * @brief Структура состояния парсинга, сохраняемого между блоками данных
+			 *
+			 */
+			typedef struct State {
+				bool quote;          // Флаг нахождения внутри кавычек
+				bool escape;         // Флаг получения кавычки внутри кавычек (ожидается вторая кавычка или конец значения)
+				bool begin;          // Флаг начала ячейки
+				bool carriage;       // Флаг ожидающего возврата каретки
+				bool data;           // Флаг наличия данных в текущей строке
+				char delim;          // Разделитель текущей строки ('0' - ещё не определён)
+				size_t count;        // Количество заполненных ячеек текущей строки
+				string cell;         // Значение текущей ячейки
+				vector <string> row; // Список ячеек текущей строки (память ячеек используется повторно)
+				/**
+				 * @brief Метод добавления ячейки в текущую строку (память ячеек прошлых строк используется повторно)
+				 *
+				 * @param data   данные ячейки
+				 * @param length размер данных ячейки
+				 */
+				void store(const char * data, const size_t length){
+					// Если ячейка уже существует в списке
+					if(this->count < this->row.size())
+						// Выполняем замену значения ячейки
+						this->row[this->count].assign(data, length);
+					// Добавляем новую ячейку
+					else this->row.emplace_back(data, length);
+					// Увеличиваем количество заполненных ячеек
+					this->count++;
+				}
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				State() noexcept :
+				 quote(false), escape(false), begin(true),
+				 carriage(false), data(false), delim('0'), count(0) {}
+			} state_t;
 		private:
 			// Флаг разрешения использования заголовков
 			bool _header;
+		private:
+			// Режим хранения ячеек
+			storage_t _storage;
 		private:
 			// Объект работы с файловой системой
 			fs_t _fs;
 		private:
 			// Схема соответствий ключей расширения
 			vector <vector <string>> _mapping;
+		private:
+			// Единый буфер данных ячеек
+			string _arena;
+			// Смещения концов ячеек в буфере (первый элемент - начало буфера)
+			vector <size_t> _offsets;
+			// Номера первых ячеек строк (последний элемент - общее количество ячеек)
+			vector <size_t> _rows;
+		private:
+			// Копия ячеек в виде строк, собираемая методом get() в режиме ARENA
+			mutable vector <vector <string>> _cache;
+		private:
+			// Состояние потокового парсинга
+			state_t _state;
+		private:
+			// Функция обратного вызова для строк потокового парсинга
+			function <void (const vector <string> &)> _callback;
+		private:
+			// Пул рабочих потоков параллельного парсинга (потоки запускаются при первом использовании)
+			mutable workers_t _workers;
 		private:
 			// Объект фреймворка
 			const fmk_t * _fmk;
@@ -83,24 +174,130 @@ namespace anyks {
 			 * Максимальный размер буфера данных на чтение из файла
 			 */
 			static constexpr uintmax_t CSV_BUFFER_SIZE = 0x10000;
+			/**
+			 * Количество ячеек столбца для определения его типа
+			 */
+			static constexpr size_t CSV_SAMPLE_SIZE = 0x20;
+			/**
+			 * Размер участка текста для параллельного парсинга
+			 */
+			static constexpr size_t CSV_CHUNK_SIZE = 0x400000;
 		private:
 			/**
-			 * @brief Метод выполнения препарирования полученных данных строки
+			 * @brief Метод разбора данных по маскам кавычек, разделителей и переносов строк блоков из 64 байт
 			 *
-			 * @param buffer буфер данных для препарирования
-			 * @param size   размер буфера данных для препарирования
-			 * @param delim  используемый разделитель
+			 * @param buffer   буфер данных для разбора
+			 * @param size     размер буфера данных для разбора
+			 * @param delim    используемый разделитель ('0' - определяется автоматически для каждой строки)
+			 * @param state    состояние парсинга, сохраняемое между блоками данных
+			 * @param callback функция обратного вызова (если не установлена, строки сохраняются в контейнер)
 			 */
-			void prepare(const char * buffer, const size_t size, const char delim = ',') noexcept;
+			void tokenize(const char * buffer, const size_t size, const char delim, state_t & state, const function <void (const vector <string> &)> & callback) noexcept;
+		private:
 			/**
-			 * @brief Метод выполнения препарирования полученных данных строки
+			 * @brief Метод добавления строки в хранилище ячеек
 			 *
-			 * @param buffer   буфер данных для препарирования
-			 * @param size     размер буфера данных для препарирования
-			 * @param callback функция обратного вызова
-			 * @param delim    используемый разделитель
+			 * @param row список ячеек строки
+			 */
+			void push(vector <string> & row) noexcept;
+		private:
+			/**
+			 * @brief Метод добавления значения столбца в строку с экранированием
+			 *
+			 * @param col    значение столбца
+			 * @param result строка для добавления
+			 */
+			void column(const string_view col, string & result) const noexcept;
+		private:
+			/**
+			 * @brief Метод определения типа ячейки по строгому формату записи
+			 *
+			 * @param cell значение ячейки
+			 * @return     тип ячейки
+			 */
+			type_t type(const string_view cell) const noexcept;
+			/**
+			 * @brief Метод определения типа столбца по выборке ячеек
+			 *
+			 * @param col   индекс столбца
+			 * @param start индекс первой строки выборки
+			 * @return      тип столбца
+			 */
+			type_t infer(const size_t col, const size_t start) const noexcept;
+		private:
+			/**
+			 * @brief Метод быстрого преобразования ячейки в значение типа столбца
+			 *
+			 * @param cell   значение ячейки
+			 * @param type   тип столбца
+			 * @param result значение для установки
+			 * @return       результат преобразования (false - ячейка не соответствует типу столбца)
+			 */
+			bool convert(const string_view cell, const type_t type, Value & result) const noexcept;
+			/**
+			 * @brief Метод преобразования ячейки в значение JSON
+			 *
+			 * @param cell      значение ячейки
+			 * @param type      тип столбца
+			 * @param result    значение для установки
+			 * @param buffer    буфер для проверки значения ячейки
+			 * @param allocator аллокатор значений JSON
+			 */
+			void value(const string_view cell, const type_t type, Value & result, string & buffer, Document::AllocatorType & allocator) const noexcept;
+		private:
+			/**
+			 * @brief Метод потокового чтения файла блоками через feed/finish
+			 *
+			 * @param filename адрес файла контейнера CSV для чтения
+			 * @param delim    используемый разделитель ('0' - определяется автоматически для каждой строки)
+			 */
+			void stream(const string & filename, const char delim) noexcept;
+		private:
+			/**
+			 * @brief Метод разбиения текста на участки по переносам строк
+			 *
+			 * @param text  текст для разбиения
+			 * @param count желаемое количество участков
+			 * @return      список участков текста в исходном порядке
+			 */
+			vector <string_view> chunks(const string_view text, const size_t count) const noexcept;
+			/**
+			 * @brief Метод параллельного парсинга участков текста
+			 *
+			 * @param chunks  список участков текста
+			 * @param start   индекс первого участка
+			 * @param results контейнеры для результатов парсинга участков (по одному на поток)
+			 * @param delim   используемый разделитель
+			 * @return        количество разобранных участков
+			 */
+			size_t spread(const vector <string_view> & chunks, const size_t start, vector <std::unique_ptr <CSV>> & results, const char delim) const noexcept;
+			/**
+			 * @brief Метод проверки результатов параллельного парсинга участков
+			 *
+			 * @param chunks  список участков текста
+			 * @param start   индекс первого участка
+			 * @param count   количество разобранных участков
+			 * @param results контейнеры с результатами парсинга участков
+			 * @param delim   используемый разделитель
+			 * @return        количество участков, вошедших в результаты
+			 */
+			size_t settle(const vector <string_view> & chunks, const size_t start, const size_t count, vector <std::unique_ptr <CSV>> & results, const char delim) const noexcept;
+			/**
+			 * @brief Метод переноса строк другого контейнера в конец текущего
+			 *
+			 * @param csv контейнер со строками для переноса
+			 */
+			void append(CSV & csv) noexcept;
+		private:
+			/**
+			 * @brief Метод вывода разобранной строки
+			 *
+			 * @param state    состояние парсинга
+			 * @param data     данные последней ячейки строки
+			 * @param length   размер данных последней ячейки строки
+			 * @param callback функция обратного вызова (если не установлена, строка сохраняется в контейнер)
 			 */
-			void prepare(const char * buffer, const size_t size, function <void (const vector <string> &)> callback, const char delim = ',') noexcept;
+			void emit(state_t & state, const char * data, const size_t length, const function <void (const vector <string> &)> & callback) noexcept;
 		public:
 			/**
 			 * @brief Метод очистки данных
@@ -114,20 +311,80 @@ namespace anyks {
 			 * @param mode флаг использования заголовков
 			 */
 			void header(const bool mode) noexcept;
+		public:
+			/**
+			 * @brief Метод получения режима хранения ячеек
+			 *
+			 * @return режим хранения ячеек
+			 */
+			storage_t storage() const noexcept;
+			/**
+			 * @brief Метод установки режима хранения ячеек (собранные данные удаляются)
+			 *
+			 * @param storage режим хранения ячеек
+			 */
+			void storage(const storage_t storage) noexcept;
 		public:
 			/**
 			 * @brief Метод выполнения парсинга текста
 			 *
 			 * @param text текст для парсинга
 			 */
-			void parse(const string & text) noexcept;
+			void parse(const string_view text) noexcept;
 			/**
 			 * @brief Метод выполнения парсинга текста
 			 *
 			 * @param text  текст для парсинга
 			 * @param delim используемый разделитель
 			 */
-			void parse(const string & text, const char delim) noexcept;
+			void parse(const string_view text, const char delim) noexcept;
+			/**
+			 * @brief Метод выполнения парсинга текста без сохранения результата
+			 *
+			 * @param text     текст для парсинга
+			 * @param callback функция обратного вызова для каждой строки
+			 * @param delim    используемый разделитель ('0' - определяется автоматически)
+			 */
+			void parse(const string_view text, function <void (const vector <string> &)> callback, const char delim = '0') noexcept;
+		public:
+			/**
+			 * @brief Метод выполнения параллельного парсинга текста
+			 *
+			 * @param text    текст для парсинга
+			 * @param delim   используемый разделитель ('0' - определяется автоматически)
+			 * @param threads количество потоков парсинга
+			 */
+			void parse(const string_view text, const char delim, const size_t threads) noexcept;
+			/**
+			 * @brief Метод выполнения параллельного парсинга текста без сохранения результата
+			 *
+			 * @param text     текст для парсинга
+			 * @param callback функция обратного вызова для каждой строки (вызывается в исходном порядке строк)
+			 * @param delim    используемый разделитель ('0' - определяется автоматически)
+			 * @param threads  количество потоков парсинга
+			 */
+			void parse(const string_view text, function <void (const vector <string> &)> callback, const char delim, const size_t threads) noexcept;
+		public:
+			/**
+			 * @brief Метод установки функции обратного вызова для строк потокового парсинга
+			 *
+			 * @param callback функция обратного вызова (если не установлена, строки сохраняются в контейнер)
+			 */
+			void on(function <void (const vector <string> &)> callback) noexcept;
+		public:
+			/**
+			 * @brief Метод потокового парсинга очередного блока данных
+			 *
+			 * @param buffer буфер данных блока
+			 * @param size   размер буфера данных блока
+			 * @param delim  используемый разделитель ('0' - определяется автоматически для каждой строки)
+			 */
+			void feed(const char * buffer, const size_t size, const char delim = '0') noexcept;
+			/**
+			 * @brief Метод завершения потокового парсинга и вывода последней строки
+			 *
+			 */
+			void finish() noexcept;
 		public:
 			/**
 			 * @brief Метод получения количества столбцов
@@ -141,6 +398,22 @@ namespace anyks {
 			 * @return количество строк
 			 */
 			size_t rows() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества ячеек строки
+			 *
+			 * @param row индекс строки
+			 * @return    количество ячеек строки
+			 */
+			size_t cells(const size_t row) const noexcept;
+			/**
+			 * @brief Метод получения значения ячейки без копирования
+			 *
+			 * @param row индекс строки
+			 * @param col индекс столбца
+			 * @return    значение ячейки (действительно до изменения контейнера)
+			 */
+			string_view cell(const size_t row, const size_t col) const noexcept;
 		public:
 			/**
 			 * @brief Метод получения строки
@@ -150,6 +423,14 @@ namespace anyks {
 			 * @return      сформированная строка
 			 */
 			string row(const size_t index, const char delim = ';') noexcept;
+			/**
+			 * @brief Метод формирования строки из списка столбцов
+			 *
+			 * @param cols  список столбцов строки
+			 * @param delim используемый разделитель
+			 * @return      сформированная строка
+			 */
+			string row(const vector <string> & cols, const char delim = ';') const noexcept;
 		public:
 			/**
 			 * @brief Метод записи данных в файл
@@ -180,6 +461,24 @@ namespace anyks {
 			 * @param delim    используемый разделитель
 			 */
 			void read(const string & filename, function <void (const vector <string> &)> callback, const char delim = '0') noexcept;
+		public:
+			/**
+			 * @brief Метод параллельного чтения данных из файла
+			 *
+			 * @param filename адрес файла контейнера CSV для чтения
+			 * @param delim    используемый разделитель ('0' - определяется автоматически)
+			 * @param threads  количество потоков парсинга
+			 */
+			void read(const string & filename, const char delim, const size_t threads) noexcept;
+			/**
+			 * @brief Метод параллельного чтения данных из файла
+			 *
+			 * @param filename адрес файла контейнера CSV для чтения
+			 * @param callback функция обратного вызова для каждой строки (вызывается в исходном порядке строк)
+			 * @param delim    используемый разделитель ('0' - определяется автоматически)
+			 * @param threads  количество потоков парсинга
+			 */
+			void read(const string & filename, function <void (const vector <string> &)> callback, const char delim, const size_t threads) noexcept;
 		public:
 			/**
 			 * @brief Метод создания дампа данных
@@ -197,7 +496,7 @@ namespace anyks {
 			/**
 			 * @brief Метод извлечения данных контейнера
 			 *
-			 * @return собранные данные контейнера
+			 * @return собранные данные контейнера (в режиме ARENA собирается копия ячеек)
 			 */
 			const vector <vector <string>> & get() const noexcept;
 		public:
@@ -229,7 +528,9 @@ namespace anyks {
 			 * @param fmk объект фреймворка
 			 * @param log объект для работы с логами
 			 */
-			CSV(const fmk_t * fmk, const log_t * log) noexcept : _header(false), _fs(fmk, log), _fmk(fmk), _log(log) {}
+			CSV(const fmk_t * fmk, const log_t * log) noexcept :
+			 _header(false), _storage(storage_t::STRINGS), _fs(fmk, log),
+			 _callback(nullptr), _workers(fmk, log), _fmk(fmk), _log(log) {}
 			/**
 			 * @brief Деструктор
 			 *
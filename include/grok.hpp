@@ -23,14 +23,37 @@
 /**
  * Подключаем зависимые заголовки
  */
+#include <list>
 #include <mutex>
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <charconv>
 #include <iostream>
+#include <string_view>
 #include <unordered_map>
-#include <pcre2posix.h>
 #include <cityhash/city.h>
 
+/**
+ * Подключаем PCRE2 с размером символа 8 бит
+ */
+#ifndef PCRE2_CODE_UNIT_WIDTH
+	#define PCRE2_CODE_UNIT_WIDTH 8
+#endif
+#include <pcre2.h>
+
+/**
+ * Наши модули
+ */
+#include <mmap.hpp>
+#include <prefilter.hpp>
+
 /**
  * Модули AWH
  */
@@ -66,6 +89,107 @@ namespace anyks {
 	 *
 	 */
 	typedef class ACU_SHARED_EXPORT Grok {
+		public:
+			/**
+			 * Тип значения переменной (указывается в шаблоне как %{NUMBER:bytes:int})
+			 */
+			enum class type_t : uint8_t {
+				STRING = 0x00, // Строковое значение
+				INT    = 0x01, // Целое число (значение с дробной частью остаётся строкой)
+				FLOAT  = 0x02, // Число с плавающей точкой
+				BOOL   = 0x03, // Логическое значение
+				TS     = 0x04  // Метка времени Unix (целая или дробная, текстовые даты остаются строкой)
+			};
+			/**
+			 * @brief Структура значения захваченной переменной
+			 *
+			 */
+			typedef struct Capture {
+				// Тип сконвертированного значения
+				type_t type;
+				// Номер группы захвата, определяющей название переменной
+				uint32_t group;
+				// Смещение значения в разобранном тексте
+				size_t offset;
+				// Размер значения в разобранном тексте
+				size_t size;
+				/**
+				 * Сконвертированное значение
+				 */
+				union {
+					bool boolean;    // Логическое значение
+					double decimal;  // Число с плавающей точкой
+					int64_t integer; // Целое число
+				};
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Capture() noexcept : type(type_t::STRING), group(0), offset(0), size(0), integer(0) {}
+			} capture_t;
+			/**
+			 * @brief Структура счётчиков общего кэша собранных регулярных выражений
+			 *
+			 */
+			typedef struct Stat {
+				size_t size;        // Количество записей в кэше
+				size_t capacity;    // Максимальное количество записей в кэше
+				uint64_t hits;      // Количество попаданий в кэш
+				uint64_t misses;    // Количество промахов кэша
+				uint64_t evictions; // Количество вытесненных записей
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Stat() noexcept : size(0), capacity(0), hits(0), misses(0), evictions(0) {}
+			} stat_t;
+			/**
+			 * @brief Структура ограничений выполнения регулярных выражений (0 - ограничение не установлено)
+			 *
+			 */
+			typedef struct Limits {
+				uint32_t match;  // Максимальное количество шагов сопоставления (PCRE2 match limit)
+				uint32_t depth;  // Максимальная глубина возвратов (PCRE2 depth limit, JIT не использует)
+				size_t stack;    // Максимальный размер стека JIT в байтах
+				uint64_t budget; // Время сопоставления строки в микросекундах, проверяемое после каждого выражения набора (сопоставление не прерывается, строка с истёкшим временем пропускается, даже если выражение совпало)
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Limits() noexcept : match(0), depth(0), stack(0), budget(0) {}
+			} limits_t;
+			/**
+			 * @brief Структура профиля подшаблона регулярного выражения
+			 *
+			 */
+			typedef struct Profile {
+				uint32_t group;      // Номер группы захвата подшаблона (0 - всё выражение)
+				uint32_t parent;     // Номер группы захвата родительского подшаблона
+				uint64_t calls;      // Количество входов в подшаблон
+				uint64_t backtracks; // Количество возвратов внутри подшаблона
+				uint64_t time;       // Время выполнения подшаблона в наносекундах (с учётом вложенных)
+				string label;        // Подшаблон в исходном виде (%{PATTERN:name})
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Profile() noexcept : group(0), parent(0), calls(0), backtracks(0), time(0), label{""} {}
+			} profile_t;
+			/**
+			 * @brief Структура отчёта профилирования регулярного выражения
+			 *
+			 */
+			typedef struct Report {
+				size_t lines;             // Количество строк корпуса
+				size_t matched;           // Количество совпавших строк
+				size_t skipped;           // Количество строк с превышением ограничений
+				vector <profile_t> items; // Профили подшаблонов по номерам групп захвата
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Report() noexcept : lines(0), matched(0), skipped(0) {}
+			} report_t;
 		private:
 			/**
 			 * Статус определения разделителя
@@ -93,8 +217,11 @@ namespace anyks {
 					// Флаг инициализации регулярного выражения
 					bool mode;
 				public:
-					// Объект контекста регулярного выражения
-					regex_t reg;
+					// Количество групп захвата регулярного выражения
+					uint32_t groups;
+				public:
+					// Скомпилированное регулярное выражение
+					pcre2_code * reg;
 				public:
 					// Регулярное выражение в текстовом виде
 					string expression;
@@ -103,30 +230,137 @@ namespace anyks {
 					 * @brief Конструктор
 					 *
 					 */
-					Express() noexcept : mode(false) {}
+					Express() noexcept : mode(false), groups(0), reg(nullptr) {}
 					/**
 					 * @brief Деструктор
 					 *
 					 */
 					~Express() noexcept {
 						// Если регулярное выражение скомпилированно
-						if(this->mode)
+						if(this->reg != nullptr)
 							// Выполняем удаление скомпилированного регулярного выражения
-							::pcre2_regfree(&this->reg);
+							::pcre2_code_free(this->reg);
 					}
 			} express_t;
+			/**
+			 * @brief Класс блока результатов сопоставления потока
+			 *
+			 */
+			typedef class Match {
+				public:
+					// Количество пар смещений блока результатов
+					uint32_t size;
+				public:
+					// Блок результатов сопоставления
+					pcre2_match_data * data;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Match() noexcept : size(0), data(nullptr) {}
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Match() noexcept {
+						// Если блок результатов создан
+						if(this->data != nullptr)
+							// Выполняем удаление блока результатов
+							::pcre2_match_data_free(this->data);
+					}
+			} match_t;
+			/**
+			 * @brief Класс стека JIT потока
+			 *
+			 */
+			typedef class Stack {
+				public:
+					// Размер стека JIT в байтах
+					size_t size;
+				public:
+					// Стек JIT
+					pcre2_jit_stack * stack;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Stack() noexcept : size(0), stack(nullptr) {}
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Stack() noexcept {
+						// Если стек JIT создан
+						if(this->stack != nullptr)
+							// Выполняем удаление стека JIT
+							::pcre2_jit_stack_free(this->stack);
+					}
+			} stack_t;
+			/**
+			 * @brief Класс контекста сопоставления с ограничениями выполнения (после публикации не изменяется)
+			 *
+			 */
+			typedef class Context {
+				public:
+					// Ограничения выполнения регулярных выражений
+					limits_t limits;
+				public:
+					// Контекст сопоставления PCRE2
+					pcre2_match_context * context;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Context() noexcept : context(nullptr) {}
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Context() noexcept {
+						// Если контекст сопоставления создан
+						if(this->context != nullptr)
+							// Выполняем удаление контекста сопоставления
+							::pcre2_match_context_free(this->context);
+					}
+			} context_t;
+			/**
+			 * @brief Структура состояния профилирования (передаётся в функцию обратного вызова PCRE2)
+			 *
+			 */
+			typedef struct Probe {
+				// Позиция в выражении предыдущего обратного вызова
+				size_t position;
+				// Время предыдущего обратного вызова
+				std::chrono::steady_clock::time_point last;
+				// Позиции открывающих скобок групп захвата
+				vector <size_t> opens;
+				// Номера родительских групп захвата
+				vector <uint32_t> parents;
+				// Номера групп захвата, содержащих каждую позицию выражения
+				vector <uint32_t> owners;
+				// Профили подшаблонов по номерам групп захвата
+				vector <profile_t> * items;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Probe() noexcept : position(string::npos), items(nullptr) {}
+			} probe_t;
 		private:
 			/**
 			 * @brief структура рабочих мютексов
 			 *
 			 */
 			typedef struct Mutex {
-				// Мютекс контроля кэша
+				// Мютекс контроля кэша именованных групп
 				std::mutex cache;
-				// Мютекс контроля собранных соответствий
-				std::mutex mapping;
-				// Мютекс контроля собранных шаблонов
-				std::mutex patterns;
+				// Мютекс сборки регулярных выражений
+				std::mutex build;
+				// Мютекс контроля собранных шаблонов (повторно захватывается при добавлении именованных групп во время сборки)
+				std::recursive_mutex patterns;
 			} mtx_t;
 			/**
 			 * @brief Класс работы с блочными переменными
@@ -135,13 +369,32 @@ namespace anyks {
 			typedef struct Let {
 				size_t pos;   // Начальная позиция переменной
 				size_t size;  // Размер переменной
+				size_t type;  // Позиция разделителя типа переменной
 				size_t delim; // Позиция разделителя
 				/**
 				 * @brief Конструктор
 				 *
 				 */
-				Let() noexcept : pos(0), size(0), delim(0) {}
+				Let() noexcept : pos(0), size(0), type(0), delim(0) {}
 			} __attribute__((packed)) let_t;
+			/**
+			 * @brief Структура переменной, извлечённой из шаблона
+			 *
+			 */
+			typedef struct Var {
+				type_t type;  // Тип значения переменной
+				string name;  // Название переменной
+				string label; // Подшаблон, образовавший переменную (%{PATTERN:name})
+				/**
+				 * @brief Конструктор
+				 *
+				 * @param name  название переменной
+				 * @param type  тип значения переменной
+				 * @param label подшаблон, образовавший переменную
+				 */
+				Var(const string & name, const type_t type, const string & label) noexcept :
+				 type(type), name(name), label(label) {}
+			} var_t;
 			/**
 			 * @brief Класс работы с переменными
 			 *
@@ -154,13 +407,14 @@ namespace anyks {
 					 */
 					friend class Grok;
 				private:
-					// Мютекс для блокировки потока
-					std::mutex _mtx;
-				private:
-					// Список имён переменных
+					// Список имён переменных по номерам групп захвата
 					vector <string> _names;
-					// Список шаблонов переменных
-					std::unordered_multimap <string, regex_t> _patterns;
+					// Список типов переменных по номерам групп захвата
+					vector <type_t> _types;
+					// Список первых групп захвата с тем же названием переменной
+					vector <uint32_t> _fields;
+					// Список подшаблонов по номерам групп захвата
+					vector <string> _labels;
 				private:
 					// Объект работы с логами
 					const log_t * _log;
@@ -179,21 +433,46 @@ namespace anyks {
 					uint8_t count() const noexcept;
 				public:
 					/**
-					 * @brief Метод извлечения названия переменной которой соответствует текст
+					 * @brief Метод извлечения названия переменной по номеру группы захвата
+					 *
+					 * @param group номер группы захвата регулярного выражения
+					 * @return      название переменной или пустая строка для безымянной группы
+					 */
+					const string & get(const uint32_t group) const noexcept;
+					/**
+					 * @brief Метод извлечения типа переменной по номеру группы захвата
 					 *
-					 * @param text  для получения переменной передан
-					 * @param index индекс запрашиваемой переменной
-					 * @return      название переменной, которой соответствует текст
+					 * @param group номер группы захвата регулярного выражения
+					 * @return      тип переменной
 					 */
-					string get(const string & text, const uint8_t index) noexcept;
+					type_t type(const uint32_t group) const noexcept;
+					/**
+					 * @brief Метод извлечения первой группы захвата с тем же названием переменной
+					 *
+					 * @param group номер группы захвата регулярного выражения
+					 * @return      номер первой группы захвата переменной
+					 */
+					uint32_t field(const uint32_t group) const noexcept;
+					/**
+					 * @brief Метод извлечения подшаблона по номеру группы захвата
+					 *
+					 * @param group номер группы захвата регулярного выражения
+					 * @return      подшаблон или пустая строка, если он неизвестен
+					 */
+					const string & label(const uint32_t group) const noexcept;
 				public:
 					/**
-					 * @brief Метод добавления переменной
+					 * @brief Метод построения списка первых групп захвата для повторяющихся переменных
 					 *
-					 * @param name    название переменной
-					 * @param pattern шаблон регулярного выражения переменной
 					 */
-					void push(const string & name, const string & pattern) noexcept;
+					void index() noexcept;
+					/**
+					 * @brief Метод сопоставления переменных с группами захвата скомпилированного регулярного выражения
+					 *
+					 * @param reg  скомпилированное регулярное выражение
+					 * @param vars список переменных в порядке следования групп захвата
+					 */
+					void push(const pcre2_code * reg, const vector <var_t> & vars) noexcept;
 				public:
 					/**
 					 * @brief конструктор
@@ -205,11 +484,11 @@ namespace anyks {
 					 * @brief деструктор
 					 *
 					 */
-					~Variables() noexcept;
+					~Variables() noexcept {}
 			} vars_t;
 		private:
 			/**
-			 * @brief Структура кэша
+			 * @brief Структура собранного регулярного выражения (после публикации в кэше не изменяется)
 			 *
 			 */
 			typedef struct Cache {
@@ -217,8 +496,6 @@ namespace anyks {
 				vars_t vars;
 				// Регулярные выражения
 				express_t express;
-				// Схема соответствий ключей
-				std::unordered_map <string, string> mapping;
 				/**
 				 * @brief конструктор
 				 *
@@ -226,9 +503,184 @@ namespace anyks {
 				 */
 				Cache(const log_t * log) noexcept : vars(log) {}
 			} cache_t;
+			/**
+			 * @brief Структура набора альтернативных регулярных выражений
+			 *
+			 */
+			typedef struct Multi {
+				// Идентификаторы записей кэша выражений в порядке перебора
+				vector <uint64_t> cids;
+				// Собранные регулярные выражения в порядке перебора
+				vector <std::shared_ptr <const cache_t>> caches;
+				// Идентификаторы обязательных литералов каждого выражения
+				vector <vector <uint32_t>> required;
+				// Количество совпадений каждого выражения
+				vector <std::atomic <size_t>> hits;
+				// Количество превышений ограничений каждого выражения
+				vector <std::atomic <size_t>> timeouts;
+				// Количество строк, пропущенных из-за превышения ограничений
+				std::atomic <size_t> skipped;
+				// Объект поиска обязательных литералов
+				prefilter_t prefilter;
+				/**
+				 * @brief конструктор
+				 *
+				 * @param log объект для работы с логами
+				 */
+				Multi(const log_t * log) noexcept : skipped(0), prefilter(log) {}
+			} multi_t;
+			/**
+			 * @brief Класс общего для процесса кэша собранных регулярных выражений с вытеснением давно не используемых записей
+			 *
+			 */
+			typedef class Shared {
+				private:
+					// Мютекс контроля кэша
+					std::mutex _mtx;
+				private:
+					// Счётчики кэша
+					stat_t _stat;
+				private:
+					// Записи кэша в порядке использования (в начале последние использованные)
+					std::list <std::pair <uint64_t, std::shared_ptr <const cache_t>>> _items;
+					// Индекс записей кэша по ключу
+					std::unordered_map <uint64_t, std::list <std::pair <uint64_t, std::shared_ptr <const cache_t>>>::iterator> _index;
+				private:
+					/**
+					 * @brief Метод вытеснения записей, не помещающихся в кэш
+					 *
+					 */
+					void shrink() noexcept;
+				public:
+					/**
+					 * @brief Метод получения счётчиков кэша
+					 *
+					 * @return счётчики кэша
+					 */
+					stat_t stat() noexcept;
+				public:
+					/**
+					 * @brief Метод установки максимального количества записей кэша
+					 *
+					 * @param capacity максимальное количество записей (0 отключает кэш)
+					 * @param log      объект для работы с логами
+					 */
+					void capacity(const size_t capacity, const log_t * log) noexcept;
+				public:
+					/**
+					 * @brief Метод получения записи кэша
+					 *
+					 * @param key ключ записи кэша
+					 * @return    собранное регулярное выражение или nullptr
+					 */
+					std::shared_ptr <const cache_t> get(const uint64_t key) noexcept;
+					/**
+					 * @brief Метод добавления записи в кэш
+					 *
+					 * @param key  ключ записи кэша
+					 * @param item собранное регулярное выражение
+					 * @param log  объект для работы с логами
+					 */
+					void set(const uint64_t key, const std::shared_ptr <const cache_t> & item, const log_t * log) noexcept;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Shared() noexcept {
+						// Устанавливаем максимальное количество записей кэша
+						this->_stat.capacity = GROK_CACHE_SIZE;
+					}
+			} shared_t;
+		private:
+			/**
+			 * Список собранных регулярных выражений
+			 */
+			typedef std::map <uint64_t, std::shared_ptr <const cache_t>> caches_t;
+			/**
+			 * Список наборов альтернативных регулярных выражений
+			 */
+			typedef std::map <uint64_t, std::shared_ptr <multi_t>> multis_t;
+		public:
+			/**
+			 * @brief Класс результата сопоставления текста (значения хранятся смещениями в разобранном тексте)
+			 *
+			 */
+			typedef class ACU_SHARED_EXPORT Mapping {
+				private:
+					/**
+					 * @brief Устанавливаем дружбу с родительским модулем
+					 *
+					 */
+					friend class Grok;
+				private:
+					// Разобранный текст (буфер принадлежит вызывающей стороне)
+					string_view _text;
+				private:
+					// Список захваченных переменных
+					vector <capture_t> _captures;
+				private:
+					// Собранное регулярное выражение, содержащее названия переменных
+					std::shared_ptr <const cache_t> _cache;
+				public:
+					/**
+					 * @brief Метод очистки результата (выделенная память сохраняется для следующего сопоставления)
+					 *
+					 */
+					void clear() noexcept;
+				public:
+					/**
+					 * @brief Метод проверки на пустоту результата
+					 *
+					 * @return результат проверки
+					 */
+					bool empty() const noexcept;
+					/**
+					 * @brief Метод получения количества захваченных переменных
+					 *
+					 * @return количество захваченных переменных
+					 */
+					size_t size() const noexcept;
+				public:
+					/**
+					 * @brief Метод получения списка захваченных переменных
+					 *
+					 * @return список захваченных переменных
+					 */
+					const vector <capture_t> & captures() const noexcept;
+				public:
+					/**
+					 * @brief Метод получения названия захваченной переменной
+					 *
+					 * @param capture захваченная переменная
+					 * @return        название переменной
+					 */
+					string_view name(const capture_t & capture) const noexcept;
+					/**
+					 * @brief Метод получения текста захваченной переменной
+					 *
+					 * @param capture захваченная переменная
+					 * @return        текст значения переменной в разобранном тексте
+					 */
+					string_view value(const capture_t & capture) const noexcept;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Mapping() noexcept {}
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Mapping() noexcept {}
+			} mapping_t;
 		private:
 			// Мютекс для блокировки потока
 			mtx_t _mtx;
+		private:
+			// Флаг однократного добавления базовых шаблонов
+			std::once_flag _once;
 		private:
 			// Список именованных групп
 			std::map <uint64_t, string> _nameGroups;
@@ -238,8 +690,35 @@ namespace anyks {
 			// Список внешних шаблонов для работы
 			std::unordered_map <string, string> _patternsExternal;
 		private:
-			// Объект кэша работы модуля
-			std::map <uint64_t, std::unique_ptr <cache_t>> _cache;
+			// Снимок кэша собранных регулярных выражений (читается без блокировки, заменяется целиком)
+			std::shared_ptr <const caches_t> _cache;
+			// Идентификаторы записей снимка кэша в порядке добавления (для вытеснения старых записей)
+			std::list <uint64_t> _order;
+			// Снимок наборов альтернативных регулярных выражений (читается без блокировки, заменяется целиком)
+			std::shared_ptr <const multis_t> _multi;
+			// Снимок контекста сопоставления с ограничениями выполнения (читается без блокировки, заменяется целиком)
+			std::shared_ptr <const context_t> _context;
+		private:
+			/**
+			 * Минимальный размер литерала, используемого для предварительного отбора выражений
+			 */
+			static constexpr size_t GROK_LITERAL_SIZE = 0x03;
+			/**
+			 * Максимальное количество записей общего кэша собранных регулярных выражений по умолчанию
+			 */
+			static constexpr size_t GROK_CACHE_SIZE = 0x400;
+			/**
+			 * Максимальное количество записей снимка кэша экземпляра модуля (вытесненные записи запрашиваются из общего кэша)
+			 */
+			static constexpr size_t GROK_FRONT_SIZE = 0x100;
+			/**
+			 * Версия формата пакета предварительно собранных шаблонов
+			 */
+			static constexpr uint32_t GROK_BUNDLE_VERSION = 0x02;
+			/**
+			 * Сигнатура файла пакета предварительно собранных шаблонов
+			 */
+			static constexpr const char GROK_BUNDLE_MAGIC[8] = {'A', 'C', 'U', 'G', 'R', 'O', 'K', '\0'};
 		private:
 			// Объект фреймворка
 			const fmk_t * _fmk;
@@ -251,12 +730,6 @@ namespace anyks {
 			 *
 			 */
 			void clear() noexcept;
-			/**
-			 * @brief Метод сброса собранных данных
-			 *
-			 * @param cid идентификатор записи в кэше
-			 */
-			void reset(const uint64_t cid) noexcept;
 		public:
 			/**
 			 * @brief Метод очистки списка добавленных шаблонов
@@ -270,6 +743,103 @@ namespace anyks {
 			 * @param name название шаблона для удаления
 			 */
 			void removePattern(const string & name) noexcept;
+		private:
+			/**
+			 * @brief Метод добавления базовых шаблонов
+			 *
+			 */
+			void init() noexcept;
+			/**
+			 * @brief Метод однократного добавления базовых шаблонов перед первым использованием
+			 *
+			 */
+			void ready() const noexcept;
+		private:
+			/**
+			 * @brief Метод компиляции регулярного выражения с JIT-оптимизацией
+			 *
+			 * @param pattern регулярное выражение для компиляции
+			 * @param error   текст ошибки компиляции
+			 * @return        скомпилированное регулярное выражение или nullptr
+			 */
+			static pcre2_code * compile(const string & pattern, string & error) noexcept;
+			/**
+			 * @brief Метод получения блока результатов сопоставления текущего потока
+			 *
+			 * @param groups количество групп захвата регулярного выражения
+			 * @return       блок результатов сопоставления
+			 */
+			static pcre2_match_data * match(const uint32_t groups) noexcept;
+			/**
+			 * @brief Метод получения стека JIT текущего потока
+			 *
+			 * @param data размер стека JIT в байтах
+			 * @return     стек JIT текущего потока
+			 */
+			static pcre2_jit_stack * stack(void * data) noexcept;
+			/**
+			 * @brief Метод обратного вызова PCRE2 при профилировании выражения
+			 *
+			 * @param block параметры обратного вызова
+			 * @param data  состояние профилирования
+			 * @return      результат продолжения сопоставления (0 - продолжить)
+			 */
+			static int32_t callout(pcre2_callout_block * block, void * data) noexcept;
+		private:
+			/**
+			 * @brief Метод получения общего для процесса кэша собранных регулярных выражений
+			 *
+			 * @return общий кэш собранных регулярных выражений
+			 */
+			static shared_t & shared() noexcept;
+		private:
+			/**
+			 * @brief Метод получения отпечатка внешних шаблонов
+			 *
+			 * @return отпечаток внешних шаблонов
+			 */
+			uint64_t fingerprint() const noexcept;
+		private:
+			/**
+			 * @brief Метод получения ключа записи общего кэша
+			 *
+			 * @param cid идентификатор записи в кэше
+			 * @return    ключ записи общего кэша (выражение и внешние шаблоны)
+			 */
+			uint64_t key(const uint64_t cid) const noexcept;
+		private:
+			/**
+			 * @brief Метод добавления собранного регулярного выражения в снимок кэша (вызывается под блокировкой сборки)
+			 *
+			 * @param cid  идентификатор записи в кэше
+			 * @param item собранное регулярное выражение
+			 */
+			void admit(const uint64_t cid, const std::shared_ptr <const cache_t> & item) const noexcept;
+			/**
+			 * @brief Метод получения собранного регулярного выражения по идентификатору
+			 *
+			 * @param cid идентификатор записи в кэше
+			 * @return    собранное регулярное выражение или nullptr
+			 */
+			std::shared_ptr <const cache_t> lookup(const uint64_t cid) const noexcept;
+		private:
+			/**
+			 * @brief Метод определения типа переменной по его названию
+			 *
+			 * @param name название типа (int, float, bool, ts)
+			 * @return     тип переменной
+			 */
+			static type_t type(const string & name) noexcept;
+			/**
+			 * @brief Метод конвертации захваченного значения в тип переменной
+			 *
+			 * Значение, которое не удалось сконвертировать без потерь, остаётся строкой
+			 *
+			 * @param value   захваченное значение
+			 * @param type    тип переменной
+			 * @param capture значение захваченной переменной
+			 */
+			static void convert(const string_view value, const type_t type, capture_t & capture) noexcept;
 		private:
 			/**
 			 * @brief Метод извлечения именованных групп
@@ -318,7 +888,25 @@ namespace anyks {
 			 * @param lets разрешить обработку блочных переменных
 			 * @return     список извлечённых переменных
 			 */
-			vector <std::pair <string, string>> prepare(string & text, const bool lets = true) const noexcept;
+			vector <var_t> prepare(string & text, const bool lets = true) const noexcept;
+		private:
+			/**
+			 * @brief Метод построения карты групп захвата собранного регулярного выражения
+			 *
+			 * @param express собранное регулярное выражение
+			 * @param groups  количество групп захвата регулярного выражения
+			 * @param probe   состояние профилирования для заполнения
+			 * @return        результат построения карты
+			 */
+			bool outline(const string & express, const uint32_t groups, probe_t & probe) const noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения литералов, обязательных для совпадения регулярного выражения
+			 *
+			 * @param express собранное регулярное выражение
+			 * @return        список обязательных литералов
+			 */
+			vector <string> literals(const string & express) const noexcept;
 		public:
 			/**
 			 * @brief Метод добавления списка поддерживаемых шаблонов
@@ -351,6 +939,31 @@ namespace anyks {
 			 * @return    сгенерированный шаблон
 			 */
 			string generatePattern(const string & key, const string & val) noexcept;
+		public:
+			/**
+			 * @brief Метод загрузки пакета предварительно собранных шаблонов
+			 *
+			 * @param filename адрес файла пакета шаблонов
+			 * @param stamp    отметка исходных шаблонов, для которых собран пакет
+			 * @return         результат загрузки пакета
+			 */
+			bool loadPatterns(const string & filename, const uint64_t stamp) noexcept;
+			/**
+			 * @brief Метод сохранения пакета предварительно собранных шаблонов
+			 *
+			 * @param filename адрес файла пакета шаблонов
+			 * @param stamp    отметка исходных шаблонов, для которых собран пакет
+			 * @return         результат сохранения пакета
+			 */
+			bool savePatterns(const string & filename, const uint64_t stamp) const noexcept;
+		public:
+			/**
+			 * @brief Метод использования шаблонов и собранных регулярных выражений другого модуля без повторной загрузки
+			 *
+			 * @param grok модуль GROK с загруженными шаблонами
+			 * @return     результат установки шаблонов
+			 */
+			bool share(const Grok & grok) noexcept;
 		public:
 			/**
 			 * @brief Метод сборки регулярного выражения
@@ -359,32 +972,122 @@ namespace anyks {
 			 * @return     идентификатор записи в кэше
 			 */
 			uint64_t build(string & text) const noexcept;
+			/**
+			 * @brief Метод сборки набора альтернативных регулярных выражений
+			 *
+			 * @param texts список регулярных выражений в порядке перебора
+			 * @return      идентификатор набора
+			 */
+			uint64_t build(const vector <string> & texts) const noexcept;
 		public:
 			/**
 			 * @brief Метод выполнения парсинга текста
 			 *
-			 * @param text текст для парсинга
-			 * @param cid  идентификатор записи в кэше
-			 * @return     результат выполнения регулярного выражения
+			 * @param text    текст для парсинга (должен существовать, пока используется результат)
+			 * @param cid     идентификатор записи в кэше
+			 * @param mapping результат сопоставления текста
+			 * @return        результат выполнения регулярного выражения
+			 */
+			bool parse(const string_view text, const uint64_t cid, mapping_t & mapping) const noexcept;
+			/**
+			 * @brief Метод поиска первого совпавшего выражения набора
+			 *
+			 * @param text    текст для парсинга (должен существовать, пока используется результат)
+			 * @param mid     идентификатор набора альтернативных регулярных выражений
+			 * @param mapping результат сопоставления текста
+			 * @return        идентификатор записи в кэше совпавшего выражения или 0
+			 */
+			uint64_t find(const string_view text, const uint64_t mid, mapping_t & mapping) const noexcept;
+		private:
+			/**
+			 * @brief Метод проверки превышения ограничений выполнения регулярного выражения
+			 *
+			 * @param code код результата сопоставления PCRE2
+			 * @return     результат проверки
+			 */
+			static bool exceeded(const int32_t code) noexcept;
+			/**
+			 * @brief Метод выполнения парсинга текста собранным регулярным выражением
+			 *
+			 * @param text    текст для парсинга
+			 * @param cache   собранное регулярное выражение
+			 * @param context контекст сопоставления с ограничениями выполнения
+			 * @param mapping результат сопоставления текста
+			 * @return        код результата сопоставления PCRE2 (больше нуля при совпадении)
+			 */
+			int32_t parse(const string_view text, const std::shared_ptr <const cache_t> & cache, const context_t * context, mapping_t & mapping) const noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества совпадений каждого выражения набора
+			 *
+			 * @param mid идентификатор набора альтернативных регулярных выражений
+			 * @return    количество совпадений в порядке выражений набора
+			 */
+			vector <size_t> hits(const uint64_t mid) const noexcept;
+			/**
+			 * @brief Метод получения количества превышений ограничений каждого выражения набора
+			 *
+			 * @param mid идентификатор набора альтернативных регулярных выражений
+			 * @return    количество превышений ограничений в порядке выражений набора
 			 */
-			bool parse(const string & text, const uint64_t cid) noexcept;
+			vector <size_t> timeouts(const uint64_t mid) const noexcept;
+			/**
+			 * @brief Метод получения количества строк, пропущенных из-за превышения ограничений
+			 *
+			 * @param mid идентификатор набора альтернативных регулярных выражений
+			 * @return    количество пропущенных строк
+			 */
+			size_t skipped(const uint64_t mid) const noexcept;
+		public:
+			/**
+			 * @brief Метод профилирования регулярного выражения на корпусе строк
+			 *
+			 * @param text   регулярное выражение в формате GROK
+			 * @param corpus текст корпуса (каждая строка является отдельной записью)
+			 * @return       отчёт профилирования по подшаблонам выражения
+			 */
+			report_t profile(const string & text, const string_view corpus) const noexcept;
+		public:
+			/**
+			 * @brief Метод установки ограничений выполнения регулярных выражений
+			 *
+			 * @param limits ограничения выполнения регулярных выражений
+			 */
+			void limits(const limits_t & limits) noexcept;
+		public:
+			/**
+			 * @brief Метод получения счётчиков общего кэша собранных регулярных выражений
+			 *
+			 * @return счётчики общего кэша
+			 */
+			static stat_t stat() noexcept;
+			/**
+			 * @brief Метод установки максимального количества записей общего кэша собранных регулярных выражений
+			 *
+			 * Экземпляр модуля хранит не более GROK_FRONT_SIZE последних выражений, вытесненные из него выражения
+			 * запрашиваются из общего кэша, поэтому при отключённом кэше их нужно собирать заново
+			 *
+			 * @param capacity максимальное количество записей (0 отключает кэш)
+			 * @param log      объект для работы с логами
+			 */
+			static void capacity(const size_t capacity, const log_t * log) noexcept;
 		public:
 			/**
 			 * @brief Метод извлечения данных в виде JSON
 			 *
-			 * @param cid идентификатор записи в кэше
-			 * @return    json объект дампа данных
+			 * @param mapping результат сопоставления текста
+			 * @return        json объект дампа данных
 			 */
-			json dump(const uint64_t cid) const noexcept;
+			json dump(const mapping_t & mapping) const noexcept;
 		public:
 			/**
 			 * @brief Метод извлечения записи по ключу
 			 *
-			 * @param key ключ записи для извлечения
-			 * @param cid идентификатор записи в кэше
-			 * @return    значение записи ключа
+			 * @param key     ключ записи для извлечения
+			 * @param mapping результат сопоставления текста
+			 * @return        значение записи ключа
 			 */
-			string get(const string & key, const uint64_t cid) const noexcept;
+			string get(const string & key, const mapping_t & mapping) const noexcept;
 		public:
 			/**
 			 * @brief Конструктор
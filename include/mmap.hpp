@@ -0,0 +1,159 @@
+/**
+ * @file: mmap.hpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __ANYKS_ACU_MMAP__
+#define __ANYKS_ACU_MMAP__
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include <global.hpp>
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <string>
+#include <string_view>
+
+/**
+ * Для операционной системы MS Windows
+ */
+#if defined(_WIN32) || defined(_WIN64)
+	#include <windows.h>
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+/**
+ * Модули AWH
+ */
+#include <awh/sys/fmk.hpp>
+#include <awh/sys/log.hpp>
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace anyks {
+	/**
+	 * Подписываемся на пространство имён awh
+	 */
+	using namespace awh;
+	/**
+	 * @brief Класс отображения файла в память только для чтения
+	 *
+	 */
+	typedef class ACU_SHARED_EXPORT MMap {
+		private:
+			// Размер отображённого файла
+			size_t _size;
+		private:
+			// Адрес отображённых данных
+			const char * _data;
+		private:
+			/**
+			 * Для операционной системы MS Windows
+			 */
+			#if defined(_WIN32) || defined(_WIN64)
+				// Дескриптор открытого файла
+				HANDLE _file;
+				// Дескриптор отображения файла
+				HANDLE _mapping;
+			/**
+			 * Для операционной системы не являющейся MS Windows
+			 */
+			#else
+				// Файловый дескриптор открытого файла
+				int32_t _fd;
+			#endif
+		private:
+			// Объект фреймворка
+			const fmk_t * _fmk;
+			// Объект работы с логами
+			const log_t * _log;
+		public:
+			/**
+			 * @brief Метод закрытия отображения файла
+			 *
+			 */
+			void close() noexcept;
+		public:
+			/**
+			 * @brief Метод открытия файла и отображения его в память
+			 *
+			 * @param filename адрес файла для отображения
+			 * @return         результат отображения файла
+			 */
+			bool open(const string & filename) noexcept;
+		public:
+			/**
+			 * @brief Метод проверки пустоты отображения
+			 *
+			 * @return результат проверки
+			 */
+			bool empty() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения размера отображённых данных
+			 *
+			 * @return размер отображённых данных
+			 */
+			size_t size() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения адреса отображённых данных
+			 *
+			 * @return адрес отображённых данных
+			 */
+			const char * data() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения отображённых данных в виде строки без копирования
+			 *
+			 * @return отображённые данные
+			 */
+			string_view view() const noexcept;
+		public:
+			/**
+			 * @brief Конструктор копирования запрещён, объект владеет дескриптором файла и отображением
+			 *
+			 */
+			MMap(const MMap &) = delete;
+			/**
+			 * @brief Оператор копирования запрещён, объект владеет дескриптором файла и отображением
+			 *
+			 */
+			MMap & operator = (const MMap &) = delete;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param fmk объект фреймворка
+			 * @param log объект для работы с логами
+			 */
+			MMap(const fmk_t * fmk, const log_t * log) noexcept;
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~MMap() noexcept;
+	} mmap_t;
+};
+
+#endif // __ANYKS_ACU_MMAP__
@@ -0,0 +1,220 @@
+/**
+ * @file: multiline.hpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __ANYKS_ACU_MULTILINE__
+#define __ANYKS_ACU_MULTILINE__
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include <global.hpp>
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <functional>
+
+/**
+ * Подключаем PCRE2 с размером символа 8 бит
+ */
+#ifndef PCRE2_CODE_UNIT_WIDTH
+	#define PCRE2_CODE_UNIT_WIDTH 8
+#endif
+#include <pcre2.h>
+
+/**
+ * Модули AWH
+ */
+#include <awh/sys/fmk.hpp>
+#include <awh/sys/log.hpp>
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace anyks {
+	/**
+	 * Подписываемся на пространство имён awh
+	 */
+	using namespace awh;
+	/**
+	 * @brief Класс сборки многострочных событий из отдельных строк
+	 *
+	 */
+	typedef class ACU_SHARED_EXPORT Multiline {
+		public:
+			/**
+			 * Правило определения начала события
+			 */
+			enum class mode_t : uint8_t {
+				INDENT = 0x00, // Строки, начинающиеся с пробела или табуляции, продолжают предыдущее событие
+				START  = 0x01  // Строка, совпавшая с регулярным выражением, начинает новое событие
+			};
+		private:
+			// Правило определения начала события
+			mode_t _mode;
+		private:
+			// Максимальное количество строк события
+			size_t _lines;
+			// Максимальный размер события в байтах
+			size_t _bytes;
+			// Количество строк текущего события
+			size_t _count;
+		private:
+			// Время ожидания продолжения события в миллисекундах
+			time_t _timeout;
+		private:
+			// Время получения последней строки события
+			std::chrono::steady_clock::time_point _last;
+		private:
+			// Регулярное выражение начала события
+			pcre2_code * _reg;
+			// Блок результатов сопоставления
+			pcre2_match_data * _data;
+		private:
+			// Буфер текущего события
+			vector <char> _buffer;
+		private:
+			// Функция обратного вызова при получении события
+			function <void (const char *, const size_t)> _callback;
+		private:
+			// Объект фреймворка
+			const fmk_t * _fmk;
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * Максимальное количество строк события по умолчанию
+			 */
+			static constexpr size_t MULTILINE_LINES = 0x1F4;
+			/**
+			 * Максимальный размер события по умолчанию
+			 */
+			static constexpr size_t MULTILINE_BYTES = 0x100000;
+		private:
+			/**
+			 * @brief Метод проверки, начинает ли строка новое событие
+			 *
+			 * @param buffer буфер данных строки
+			 * @param size   размер буфера данных строки
+			 * @return       результат проверки
+			 */
+			bool start(const char * buffer, const size_t size) const noexcept;
+		private:
+			/**
+			 * @brief Метод вывода накопленного события
+			 *
+			 */
+			void emit() noexcept;
+		public:
+			/**
+			 * @brief Метод очистки данных
+			 *
+			 */
+			void clear() noexcept;
+		public:
+			/**
+			 * @brief Метод добавления очередной строки (пустая строка продолжает событие, а при правиле отступов завершает его)
+			 *
+			 * @param buffer буфер данных строки
+			 * @param size   размер буфера данных строки
+			 */
+			void push(const char * buffer, const size_t size) noexcept;
+		public:
+			/**
+			 * @brief Метод вывода ожидающего события, если время ожидания продолжения истекло
+			 *
+			 * @return результат вывода события
+			 */
+			bool idle() noexcept;
+		public:
+			/**
+			 * @brief Метод завершения потока и вывода последнего события
+			 *
+			 */
+			void finish() noexcept;
+		public:
+			/**
+			 * @brief Метод получения времени ожидания продолжения события
+			 *
+			 * @return время ожидания в миллисекундах (0 - без ограничения)
+			 */
+			time_t timeout() const noexcept;
+			/**
+			 * @brief Метод установки времени ожидания продолжения события
+			 *
+			 * @param timeout время ожидания в миллисекундах (0 - без ограничения)
+			 */
+			void timeout(const time_t timeout) noexcept;
+		public:
+			/**
+			 * @brief Метод установки ограничений размера события
+			 *
+			 * @param lines максимальное количество строк события
+			 * @param bytes максимальный размер события в байтах
+			 */
+			void max(const size_t lines, const size_t bytes) noexcept;
+		public:
+			/**
+			 * @brief Метод установки правила определения начала события по отступам
+			 *
+			 */
+			void indent() noexcept;
+			/**
+			 * @brief Метод установки регулярного выражения начала события
+			 *
+			 * @param pattern регулярное выражение начала события
+			 * @return        результат компиляции регулярного выражения
+			 */
+			bool pattern(const string & pattern) noexcept;
+		public:
+			/**
+			 * @brief Метод установки функции обратного вызова при получении события
+			 *
+			 * @param callback функция обратного вызова
+			 */
+			void on(function <void (const char *, const size_t)> callback) noexcept;
+		public:
+			/**
+			 * @brief Конструктор копирования запрещён, объект владеет регулярным выражением PCRE2
+			 *
+			 */
+			Multiline(const Multiline &) = delete;
+			/**
+			 * @brief Оператор копирования запрещён, объект владеет регулярным выражением PCRE2
+			 *
+			 */
+			Multiline & operator = (const Multiline &) = delete;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param fmk объект фреймворка
+			 * @param log объект для работы с логами
+			 */
+			Multiline(const fmk_t * fmk, const log_t * log) noexcept :
+			 _mode(mode_t::INDENT), _lines(MULTILINE_LINES), _bytes(MULTILINE_BYTES),
+			 _count(0), _timeout(0), _reg(nullptr), _data(nullptr), _callback(nullptr), _fmk(fmk), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Multiline() noexcept;
+	} multiline_t;
+};
+
+#endif // __ANYKS_ACU_MULTILINE__
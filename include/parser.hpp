@@ -33,7 +33,27 @@
  * Подключаем зависимые заголовки
  */
 #include <mutex>
+#include <climits>
+#include <vector>
+#include <memory>
 #include <string>
+#include <istream>
+#include <streambuf>
+#include <functional>
+#include <unordered_map>
+#include <string_view>
+
+/**
+ * Для операционной системы MS Windows
+ */
+#if defined(_WIN32) || defined(_WIN64)
+	#include <io.h>
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#else
+	#include <unistd.h>
+#endif
 
 /**
  * Подключаем INI
@@ -50,12 +70,16 @@
 */
 #include <libxml/parser.h>
 #include <libxml/xmlmemory.h>
+#include <libxml/xmlreader.h>
 
 /**
  * Подключаем заголовочные файлы JSON
  */
+#include <rapidjson/reader.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
@@ -85,23 +109,350 @@ namespace anyks {
 	 *
 	 */
 	typedef class ACU_SHARED_EXPORT Parser {
+		public:
+			/**
+			 * Форматы прямого конвертирования без построения объекта JSON
+			 */
+			enum class format_t : uint8_t {
+				NONE = 0x00, // Формат не поддерживается
+				CSV  = 0x01, // Формат CSV (без заголовков на входе, из массива записей JSON на выходе)
+				JSON = 0x02, // Формат JSON
+				YAML = 0x03  // Формат YAML
+			};
+		private:
+			/**
+			 * @brief Класс писателя событий разбора в формат YAML
+			 *
+			 */
+			typedef class Emitter {
+				private:
+					/**
+					 * @brief Структура уровня вложенности
+					 *
+					 */
+					typedef struct Level {
+						bool map;   // Флаг объекта (иначе массив)
+						bool begin; // Флаг начала вывода уровня
+						/**
+						 * @brief Конструктор
+						 *
+						 * @param map флаг объекта
+						 */
+						Level(const bool map) noexcept : map(map), begin(false) {}
+					} level_t;
+				private:
+					// Ключ ожидающий значения
+					string _key;
+					// Флаг наличия ключа ожидающего значения
+					bool _pending;
+				private:
+					// Стек уровней вложенности
+					vector <level_t> _levels;
+				private:
+					// Объект генератора YAML
+					YAML::Emitter _emitter;
+				private:
+					/**
+					 * @brief Метод подготовки вывода очередного значения
+					 *
+					 */
+					void value() noexcept;
+				public:
+					/**
+					 * @brief Метод получения результата
+					 *
+					 * @return текст в формате YAML
+					 */
+					string get() const noexcept;
+				public:
+					/**
+					 * Методы обработки событий разбора
+					 */
+					bool Null() noexcept;
+					bool Bool(const bool value) noexcept;
+					bool Int(const int32_t value) noexcept;
+					bool Uint(const uint32_t value) noexcept;
+					bool Int64(const int64_t value) noexcept;
+					bool Uint64(const uint64_t value) noexcept;
+					bool Double(const double value) noexcept;
+					bool RawNumber(const char * str, const SizeType length, const bool copy) noexcept;
+					bool String(const char * str, const SizeType length, const bool copy) noexcept;
+					bool StartObject() noexcept;
+					bool Key(const char * str, const SizeType length, const bool copy) noexcept;
+					bool EndObject(const SizeType count) noexcept;
+					bool StartArray() noexcept;
+					bool EndArray(const SizeType count) noexcept;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Emitter() noexcept : _key{""}, _pending(false) {}
+			} emitter_t;
+		private:
+			/**
+			 * @brief Класс писателя событий разбора массива записей в формат CSV
+			 *
+			 */
+			typedef class Tabulator {
+				private:
+					/**
+					 * @brief Структура записи массива
+					 *
+					 */
+					typedef struct Record {
+						bool map;                                 // Флаг записи-объекта (иначе массив)
+						vector <std::pair <string, string>> cols; // Список ключей и значений записи
+						/**
+						 * @brief Конструктор
+						 *
+						 */
+						Record() noexcept : map(false) {}
+					} record_t;
+				private:
+					// Флаг формирования заголовков
+					bool _header;
+					// Флаг определения списка заголовков
+					bool _ready;
+				private:
+					// Используемый разделитель
+					char _delim;
+				private:
+					// Текущий уровень вложенности
+					size_t _depth;
+					// Количество записей для определения заголовков
+					size_t _sample;
+				private:
+					// Количество выведенных строк
+					size_t _rows;
+					// Количество пропущенных значений, ключей которых нет в заголовках
+					size_t _dropped;
+				private:
+					// Текущий ключ записи
+					string _key;
+				private:
+					// Текущая запись массива
+					record_t _record;
+				private:
+					// Список заголовков
+					vector <string> _keys;
+					// Буфер записей для определения заголовков
+					vector <record_t> _buffer;
+				private:
+					// Индексы столбцов заголовков
+					std::unordered_map <string, size_t> _index;
+				private:
+					// Функция обратного вызова при получении строки CSV
+					function <void (const string &)> _callback;
+				private:
+					// Объект модуля CSV для формирования строк
+					csv_t _csv;
+				private:
+					// Объект фреймворка
+					const fmk_t * _fmk;
+				private:
+					/**
+					 * @brief Метод вывода строки CSV
+					 *
+					 * @param cols список столбцов строки
+					 */
+					void emit(const vector <string> & cols) noexcept;
+				private:
+					/**
+					 * @brief Метод вывода записи массива
+					 *
+					 * @param record запись для вывода
+					 */
+					void write(const record_t & record) noexcept;
+				private:
+					/**
+					 * @brief Метод определения заголовков и вывода накопленных записей
+					 *
+					 */
+					void prepare() noexcept;
+				private:
+					/**
+					 * @brief Метод завершения текущей записи
+					 *
+					 */
+					void commit() noexcept;
+				private:
+					/**
+					 * @brief Метод добавления значения в текущую запись
+					 *
+					 * @param value значение для добавления
+					 * @return      результат добавления
+					 */
+					bool add(const string & value) noexcept;
+				public:
+					/**
+					 * @brief Метод получения количества выведенных строк
+					 *
+					 * @return количество выведенных строк
+					 */
+					size_t rows() const noexcept;
+					/**
+					 * @brief Метод получения количества пропущенных значений
+					 *
+					 * @return количество значений, ключей которых нет в заголовках
+					 */
+					size_t dropped() const noexcept;
+				public:
+					/**
+					 * Методы обработки событий разбора
+					 */
+					bool Null() noexcept;
+					bool Bool(const bool value) noexcept;
+					bool Int(const int32_t value) noexcept;
+					bool Uint(const uint32_t value) noexcept;
+					bool Int64(const int64_t value) noexcept;
+					bool Uint64(const uint64_t value) noexcept;
+					bool Double(const double value) noexcept;
+					bool RawNumber(const char * str, const SizeType length, const bool copy) noexcept;
+					bool String(const char * str, const SizeType length, const bool copy) noexcept;
+					bool StartObject() noexcept;
+					bool Key(const char * str, const SizeType length, const bool copy) noexcept;
+					bool EndObject(const SizeType count) noexcept;
+					bool StartArray() noexcept;
+					bool EndArray(const SizeType count) noexcept;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 * @param header   флаг формирования заголовков
+					 * @param delim    используемый разделитель
+					 * @param sample   количество записей для определения заголовков
+					 * @param callback функция обратного вызова при получении строки CSV
+					 * @param fmk      объект фреймворка
+					 * @param log      объект для работы с логами
+					 */
+					Tabulator(const bool header, const char delim, const size_t sample, function <void (const string &)> callback, const fmk_t * fmk, const log_t * log) noexcept :
+					 _header(header), _ready(false), _delim(delim), _depth(0),
+					 _sample(sample > 0 ? sample : 1), _rows(0), _dropped(0), _key{""},
+					 _callback(callback), _csv(fmk, log), _fmk(fmk) {}
+			} tabulator_t;
+		private:
+			/**
+			 * @brief Буфер потока для чтения данных из памяти без копирования
+			 *
+			 */
+			typedef struct Memory : public std::streambuf {
+				/**
+				 * @brief Конструктор
+				 *
+				 * @param buffer буфер данных для чтения
+				 * @param size   размер буфера данных для чтения
+				 */
+				Memory(const char * buffer, const size_t size) noexcept {
+					// Получаем адрес буфера данных (данные только читаются)
+					char * data = const_cast <char *> (buffer);
+					// Устанавливаем границы области чтения
+					this->setg(data, data, data + size);
+				}
+			} memory_t;
+		private:
+			/**
+			 * Шаблон пула объектов модулей
+			 */
+			template <typename T>
+			/**
+			 * @brief Класс пула объектов модулей, создание которых требует больших затрат
+			 *
+			 */
+			class Pool {
+				private:
+					// Мютекс для блокировки пула
+					std::mutex _mtx;
+				private:
+					// Список свободных объектов
+					vector <std::unique_ptr <T>> _items;
+				private:
+					// Объект фреймворка
+					const fmk_t * _fmk;
+					// Объект работы с логами
+					const log_t * _log;
+				public:
+					/**
+					 * @brief Метод получения свободного объекта из пула
+					 *
+					 * @return свободный объект модуля
+					 */
+					std::unique_ptr <T> get() {
+						{
+							// Выполняем блокировку пула
+							const lock_guard <std::mutex> lock(this->_mtx);
+							// Если в пуле есть свободные объекты
+							if(!this->_items.empty()){
+								// Получаем последний свободный объект
+								std::unique_ptr <T> result = std::move(this->_items.back());
+								// Удаляем объект из пула
+								this->_items.pop_back();
+								// Выводим полученный объект
+								return result;
+							}
+						}
+						// Создаём новый объект модуля
+						return std::unique_ptr <T> (new T(this->_fmk, this->_log));
+					}
+				public:
+					/**
+					 * @brief Метод возврата объекта в пул
+					 *
+					 * @param item объект модуля для возврата
+					 */
+					void put(std::unique_ptr <T> & item) noexcept {
+						// Если объект передан
+						if(item != nullptr){
+							/**
+							 * Выполняем отлов ошибок
+							 */
+							try {
+								// Выполняем блокировку пула
+								const lock_guard <std::mutex> lock(this->_mtx);
+								// Возвращаем объект в пул
+								this->_items.push_back(std::move(item));
+							/**
+							 * Если возникает ошибка
+							 */
+							} catch(const exception &) {
+								// Удаляем объект модуля
+								item.reset(nullptr);
+							}
+						}
+					}
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 * @param fmk объект фреймворка
+					 * @param log объект для работы с логами
+					 */
+					Pool(const fmk_t * fmk, const log_t * log) noexcept : _fmk(fmk), _log(log) {}
+			};
+		private:
+			// Пул объектов модуля CEF
+			Pool <cef_t> _cef;
+			// Пул объектов модуля SysLog
+			Pool <syslog_t> _syslog;
 		private:
-			// Объект модуля CEF
-			cef_t _cef;
-			// Объект модуля CSV
-			csv_t _csv;
 			// Объект модуля GROK
 			grok_t _grok;
-			// Объект модуля SysLog
-			syslog_t _syslog;
 		private:
-			// Мютекс для блокировки потока
-			std::recursive_mutex _mtx;
+			// Мютекс для блокировки модуля GROK
+			std::mutex _mtx;
+		private:
+			// Количество потоков парсинга больших текстов CSV
+			size_t _threads;
 		private:
 			// Объект фреймворка
 			const fmk_t * _fmk;
 			// Объект работы с логами
 			const log_t * _log;
+		private:
+			/**
+			 * Количество первых записей массива JSON, по которым определяются заголовки CSV
+			 */
+			static constexpr size_t CSV_HEADER_SAMPLE = 0x40;
 		public:
 			/**
 			 * @brief Метод сброса списка добавленных шаблонов GROK
@@ -122,6 +473,31 @@ namespace anyks {
 			 * @param val регуляреное выражение соответствующее переменной
 			 */
 			void pattern(const string & key, const string & val) noexcept;
+		public:
+			/**
+			 * @brief Метод загрузки пакета предварительно собранных шаблонов GROK
+			 *
+			 * @param filename адрес файла пакета шаблонов
+			 * @param stamp    отметка исходных шаблонов, для которых собран пакет
+			 * @return         результат загрузки пакета
+			 */
+			bool loadPatterns(const string & filename, const uint64_t stamp) noexcept;
+			/**
+			 * @brief Метод использования шаблонов GROK и собранных регулярных выражений другого парсера без повторной загрузки
+			 *
+			 * @param parser парсер с загруженными шаблонами GROK
+			 * @return       результат установки шаблонов
+			 */
+			bool share(const Parser & parser) noexcept;
+			/**
+			 * @brief Метод сохранения пакета предварительно собранных шаблонов GROK
+			 *
+			 * @param filename адрес файла пакета шаблонов
+			 * @param patterns список регулярных выражений в формате GROK, собираемых в пакет
+			 * @param stamp    отметка исходных шаблонов, для которых собран пакет
+			 * @return         результат сохранения пакета
+			 */
+			bool savePatterns(const string & filename, const vector <string> & patterns, const uint64_t stamp) noexcept;
 		public:
 			/**
 			 * @brief Метод конвертации текста в формате YAML в объект JSON
@@ -129,7 +505,7 @@ namespace anyks {
 			 * @param text текст для конвертации
 			 * @return     объект в формате JSON
 			 */
-			Document yaml(const string & text) noexcept;
+			Document yaml(const string_view text) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате YAML
 			 *
@@ -144,7 +520,7 @@ namespace anyks {
 			 * @param text текст для конвертации
 			 * @return     объект в формате JSON
 			 */
-			Document ini(const string & text) noexcept;
+			Document ini(const string_view text) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате INI
 			 *
@@ -159,7 +535,7 @@ namespace anyks {
 			 * @param text текст для конвертации
 			 * @return     объект в формате JSON
 			 */
-			Document syslog(const string & text) noexcept;
+			Document syslog(const string_view text) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате SysLog
 			 *
@@ -175,7 +551,77 @@ namespace anyks {
 			 * @param pattern регулярное выражение в формате GROK
 			 * @return        объект в формате JSON
 			 */
-			Document grok(const string & text, const string & pattern) noexcept;
+			Document grok(const string_view text, const string & pattern) noexcept;
+			/**
+			 * @brief Метод построчной конвертации текста в формате GROK с однократной сборкой регулярного выражения
+			 *
+			 * @param text     текст для конвертации (каждая строка является отдельной записью)
+			 * @param pattern  регулярное выражение в формате GROK
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество совпавших и не совпавших строк
+			 */
+			std::pair <size_t, size_t> grok(const string_view text, const string & pattern, function <void (const Document &)> callback) noexcept;
+			/**
+			 * @brief Метод конвертации текста в формате GROK первым совпавшим выражением из списка
+			 *
+			 * @param text     текст для конвертации
+			 * @param patterns список регулярных выражений в формате GROK в порядке перебора
+			 * @return         объект в формате JSON
+			 */
+			Document grok(const string_view text, const vector <string> & patterns) noexcept;
+			/**
+			 * @brief Метод построчной конвертации текста в формате GROK первым совпавшим выражением из списка
+			 *
+			 * @param text     текст для конвертации (каждая строка является отдельной записью)
+			 * @param patterns список регулярных выражений в формате GROK в порядке перебора
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество совпавших и не совпавших строк
+			 */
+			std::pair <size_t, size_t> grok(const string_view text, const vector <string> & patterns, function <void (const Document &)> callback) noexcept;
+			/**
+			 * @brief Метод получения количества совпадений каждого выражения списка GROK
+			 *
+			 * @param patterns список регулярных выражений в формате GROK
+			 * @return         количество совпадений в порядке выражений списка
+			 */
+			vector <size_t> hits(const vector <string> & patterns) noexcept;
+			/**
+			 * @brief Метод получения количества превышений ограничений каждого выражения списка GROK
+			 *
+			 * @param patterns список регулярных выражений в формате GROK
+			 * @return         количество превышений ограничений в порядке выражений списка
+			 */
+			vector <size_t> timeouts(const vector <string> & patterns) noexcept;
+			/**
+			 * @brief Метод получения количества строк, пропущенных из-за превышения ограничений GROK
+			 *
+			 * @param patterns список регулярных выражений в формате GROK
+			 * @return         количество пропущенных строк
+			 */
+			size_t skipped(const vector <string> & patterns) noexcept;
+		public:
+			/**
+			 * @brief Метод профилирования регулярного выражения GROK на корпусе строк
+			 *
+			 * @param text    текст корпуса (каждая строка является отдельной записью)
+			 * @param pattern регулярное выражение в формате GROK
+			 * @return        отчёт профилирования по подшаблонам выражения
+			 */
+			grok_t::report_t profile(const string_view text, const string & pattern) noexcept;
+		public:
+			/**
+			 * @brief Метод установки ограничений выполнения регулярных выражений GROK
+			 *
+			 * @param limits ограничения выполнения регулярных выражений
+			 */
+			void limits(const grok_t::limits_t & limits) noexcept;
+		public:
+			/**
+			 * @brief Метод установки количества потоков парсинга больших текстов CSV
+			 *
+			 * @param threads количество потоков парсинга
+			 */
+			void threads(const size_t threads) noexcept;
 		public:
 			/**
 			 * @brief Метод конвертации текста в формате CSV в объект JSON
@@ -184,7 +630,7 @@ namespace anyks {
 			 * @param header флаг формирования заголовков
 			 * @return       объект в формате JSON
 			 */
-			Document csv(const string & text, const bool header = true) noexcept;
+			Document csv(const string_view text, const bool header = true) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате CSV
 			 *
@@ -194,6 +640,34 @@ namespace anyks {
 			 * @return       текст после конвертации
 			 */
 			string csv(const Document & data, const bool header = true, const char delim = ';') noexcept;
+			/**
+			 * @brief Метод потоковой конвертации массива записей в формате JSON в текст в формате CSV
+			 *
+			 * @param text     текст массива записей в формате JSON
+			 * @param header   флаг формирования заголовков
+			 * @param delim    используемый разделитель
+			 * @param callback функция обратного вызова при получении строки CSV
+			 * @return         количество выведенных строк
+			 */
+			size_t csv(const string_view text, const bool header, const char delim, function <void (const string &)> callback) noexcept;
+			/**
+			 * @brief Метод потоковой конвертации текста в формате CSV по отдельным строкам
+			 *
+			 * @param text     текст для конвертации
+			 * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t csv(const string_view text, const bool header, function <void (const Document &)> callback) noexcept;
+			/**
+			 * @brief Метод потоковой конвертации данных в формате CSV из файлового дескриптора по отдельным строкам
+			 *
+			 * @param fd       файловый дескриптор для чтения данных
+			 * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t csv(const int32_t fd, const bool header, function <void (const Document &)> callback) noexcept;
 		public:
 			/**
 			 * @brief Метод конвертации текста в формате XML в объект JSON
@@ -201,7 +675,25 @@ namespace anyks {
 			 * @param text текст для конвертации
 			 * @return     объект в формате JSON
 			 */
-			Document xml(const string & text) noexcept;
+			Document xml(const string_view text) noexcept;
+			/**
+			 * @brief Метод потоковой конвертации текста в формате XML по отдельным записям
+			 *
+			 * @param text     текст для конвертации
+			 * @param record   название повторяющегося элемента записи
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t xml(const string_view text, const string & record, function <void (const Document &)> callback) noexcept;
+			/**
+			 * @brief Метод потоковой конвертации данных в формате XML из файлового дескриптора по отдельным записям
+			 *
+			 * @param fd       файловый дескриптор для чтения данных
+			 * @param record   название повторяющегося элемента записи
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t xml(const int32_t fd, const string & record, function <void (const Document &)> callback) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате XML
 			 *
@@ -217,7 +709,7 @@ namespace anyks {
 			 * @param text текст для конвертации
 			 * @return     объект в формате JSON
 			 */
-			Document json(const string & text) noexcept;
+			Document json(const string_view text) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате JSON
 			 *
@@ -234,7 +726,7 @@ namespace anyks {
 			 * @param mode режим парсинга
 			 * @return     объект в формате JSON
 			 */
-			Document cef(const string & text, const cef_t::mode_t mode = cef_t::mode_t::STRONG) noexcept;
+			Document cef(const string_view text, const cef_t::mode_t mode = cef_t::mode_t::STRONG) noexcept;
 			/**
 			 * @brief Метод конвертации объекта JSON в текст в формате CEF
 			 *
@@ -243,6 +735,89 @@ namespace anyks {
 			 * @return     текст после конвертации
 			 */
 			string cef(const Document & data, const cef_t::mode_t mode = cef_t::mode_t::STRONG) noexcept;
+		private:
+			/**
+			 * @brief Метод конвертации ноды XML в объект JSON
+			 *
+			 * @param node   нода XML для конвертации
+			 * @param result объект JSON для записи результата
+			 */
+			void xml(xmlNodePtr node, Document & result) noexcept;
+			/**
+			 * @brief Метод чтения записей XML из потокового читателя
+			 *
+			 * @param reader   потоковый читатель XML
+			 * @param record   название повторяющегося элемента записи
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t xml(xmlTextReaderPtr reader, const string & record, function <void (const Document &)> callback) noexcept;
+		private:
+			/**
+			 * @brief Метод конвертации строки CSV в запись JSON
+			 *
+			 * @param row    список ячеек строки
+			 * @param header список заголовков (если пустой, запись формируется массивом)
+			 * @param result объект JSON для записи результата
+			 */
+			void csv(const vector <string> & row, const vector <string> & header, Document & result) noexcept;
+			/**
+			 * @brief Метод потоковой конвертации данных в формате CSV по отдельным строкам
+			 *
+			 * @param source   функция передачи блоков данных в объект модуля CSV
+			 * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+			 * @param callback функция обратного вызова при получении записи
+			 * @return         количество полученных записей
+			 */
+			size_t csv(function <void (csv_t &)> source, const bool header, function <void (const Document &)> callback) noexcept;
+		private:
+			/**
+			 * Шаблон обработчика событий разбора
+			 */
+			template <typename Handler>
+			/**
+			 * @brief Метод разбора текста с передачей событий обработчику без построения объекта JSON
+			 *
+			 * @param text    текст для разбора
+			 * @param from    формат текста для разбора
+			 * @param handler обработчик событий разбора
+			 * @return        результат разбора
+			 */
+			bool read(const string_view text, const format_t from, Handler & handler) noexcept;
+		public:
+			/**
+			 * @brief Метод проверки возможности прямого конвертирования без построения объекта JSON
+			 *
+			 * @param from формат исходных данных
+			 * @param to   формат данных для конвертации
+			 * @return     результат проверки
+			 */
+			bool transcodable(const format_t from, const format_t to) const noexcept;
+			/**
+			 * @brief Метод прямого конвертирования текста без построения объекта JSON
+			 *
+			 * @param text     текст для конвертации
+			 * @param from     формат исходных данных
+			 * @param to       формат данных для конвертации
+			 * @param prettify флаг генерации читаемого формата
+			 * @param header   флаг формирования заголовков для формата CSV
+			 * @param delim    разделитель используемый для формата CSV
+			 * @return         текст после конвертации или пустая строка, если прямое конвертирование невозможно
+			 */
+			string transcode(const string_view text, const format_t from, const format_t to, const bool prettify = false, const bool header = true, const char delim = ';') noexcept;
+			/**
+			 * @brief Метод прямого конвертирования текста без построения объекта JSON с выводом результата по частям
+			 *
+			 * @param text     текст для конвертации
+			 * @param from     формат исходных данных
+			 * @param to       формат данных для конвертации
+			 * @param prettify флаг генерации читаемого формата
+			 * @param header   флаг формирования заголовков для формата CSV
+			 * @param delim    разделитель используемый для формата CSV
+			 * @param callback функция обратного вызова при получении части результата (для формата CSV - каждой строки)
+			 * @return         количество выведенных частей результата или 0, если прямое конвертирование невозможно
+			 */
+			size_t transcode(const string_view text, const format_t from, const format_t to, const bool prettify, const bool header, const char delim, function <void (const string &)> callback) noexcept;
 		public:
 			/**
 			 * @brief Конструктор
@@ -251,8 +826,11 @@ namespace anyks {
 			 * @param log объект для работы с логами
 			 */
 			Parser(const fmk_t * fmk, const log_t * log) noexcept :
-			 _cef(fmk, log), _csv(fmk, log), _grok(fmk, log),
-			 _syslog(fmk, log), _fmk(fmk), _log(log) {}
+			 _cef(fmk, log), _syslog(fmk, log),
+			 _grok(fmk, log), _threads(1), _fmk(fmk), _log(log) {
+				// Выполняем инициализацию глобальных параметров парсера XML
+				xmlInitParser();
+			}
 			/**
 			 * @brief Деструктор
 			 *
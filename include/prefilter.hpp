@@ -0,0 +1,133 @@
+/**
+ * @file: prefilter.hpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __ANYKS_ACU_PREFILTER__
+#define __ANYKS_ACU_PREFILTER__
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include <global.hpp>
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Модули AWH
+ */
+#include <awh/sys/log.hpp>
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace anyks {
+	/**
+	 * Подписываемся на пространство имён awh
+	 */
+	using namespace awh;
+	/**
+	 * @brief Класс одновременного поиска множества литералов (автомат Ахо-Корасик) без учёта регистра ASCII
+	 *
+	 */
+	typedef class ACU_SHARED_EXPORT Prefilter {
+		private:
+			/**
+			 * @brief Структура состояния автомата
+			 *
+			 */
+			typedef struct State {
+				// Состояние перехода по ошибке
+				uint32_t fail;
+				// Список переходов по каждому байту
+				std::array <uint32_t, 256> next;
+				// Список идентификаторов литералов, завершающихся в состоянии
+				vector <uint32_t> out;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				State() noexcept : fail(0) {
+					// Заполняем переходы корневым состоянием
+					this->next.fill(0);
+				}
+			} state_t;
+		private:
+			// Флаг готовности автомата к поиску
+			bool _ready;
+		private:
+			// Список состояний автомата
+			vector <state_t> _states;
+			// Список идентификаторов добавленных литералов
+			std::unordered_map <string, uint32_t> _literals;
+		private:
+			// Объект работы с логами
+			const log_t * _log;
+		public:
+			/**
+			 * @brief Метод очистки данных
+			 *
+			 */
+			void clear() noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества добавленных литералов
+			 *
+			 * @return количество литералов
+			 */
+			size_t count() const noexcept;
+		public:
+			/**
+			 * @brief Метод добавления литерала для поиска
+			 *
+			 * @param literal литерал для поиска
+			 * @return        идентификатор литерала
+			 */
+			uint32_t add(const string & literal) noexcept;
+		public:
+			/**
+			 * @brief Метод построения переходов автомата после добавления всех литералов
+			 *
+			 */
+			void compile() noexcept;
+		public:
+			/**
+			 * @brief Метод поиска литералов в тексте за один проход
+			 *
+			 * @param text  текст для поиска
+			 * @param marks список отметок найденных литералов (индекс - идентификатор литерала)
+			 * @param stamp значение отметки текущего поиска
+			 */
+			void scan(const string_view text, vector <uint32_t> & marks, const uint32_t stamp) const noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param log объект для работы с логами
+			 */
+			Prefilter(const log_t * log) noexcept : _ready(false), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Prefilter() noexcept {}
+	} prefilter_t;
+};
+
+#endif // __ANYKS_ACU_PREFILTER__
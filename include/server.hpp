@@ -121,6 +121,16 @@ namespace anyks {
 			string _origin;
 			// Адрес хранения favicon.ico
 			string _favicon;
+			// Адрес пакета предварительно собранных шаблонов GROK
+			string _bundle;
+		private:
+			// Флаг загрузки пакета шаблонов GROK
+			bool _bundled;
+			// Парсер с загруженным пакетом шаблонов GROK (шаблоны разделяются между запросами)
+			parser_t _patterns;
+		private:
+			// Ограничения выполнения регулярных выражений GROK
+			grok_t::limits_t _limits;
 		private:
 			// Объект работы с датой и временем
 			chrono_t _chrono;
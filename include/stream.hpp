@@ -0,0 +1,187 @@
+/**
+ * @file: stream.hpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __ANYKS_ACU_STREAM__
+#define __ANYKS_ACU_STREAM__
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include <global.hpp>
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <vector>
+#include <string>
+#include <cstring>
+#include <functional>
+
+/**
+ * Модули AWH
+ */
+#include <awh/sys/fmk.hpp>
+#include <awh/sys/log.hpp>
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace anyks {
+	/**
+	 * Подписываемся на пространство имён awh
+	 */
+	using namespace awh;
+	/**
+	 * @brief Класс разбора потока данных на отдельные записи
+	 *
+	 */
+	typedef class ACU_SHARED_EXPORT Stream {
+		public:
+			/**
+			 * Режим разделения записей
+			 */
+			enum class framing_t : uint8_t {
+				LINE = 0x00, // Записи разделены переводом строки
+				AUTO = 0x01  // Записи с префиксом длины (RFC 6587 octet-counting) или разделённые переводом строки
+			};
+		private:
+			// Режим разделения записей
+			framing_t _framing;
+		private:
+			// Флаг вывода пустых записей
+			bool _blank;
+			// Флаг пропуска переводов строк после записи с префиксом длины
+			bool _skip;
+		private:
+			// Максимальный размер одной записи
+			size_t _max;
+		private:
+			// Буфер незавершённой записи
+			vector <char> _buffer;
+		private:
+			// Функция обратного вызова при получении записи
+			function <void (const char *, const size_t)> _callback;
+		private:
+			// Объект фреймворка
+			const fmk_t * _fmk;
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * Максимальный размер одной записи по умолчанию
+			 */
+			static constexpr size_t STREAM_RECORD_SIZE = 0x4000000;
+		private:
+			/**
+			 * @brief Метод извлечения заголовка записи с префиксом длины
+			 *
+			 * @param buffer буфер данных для проверки
+			 * @param size   размер буфера данных для проверки
+			 * @param length размер записи указанный в заголовке
+			 * @return       размер заголовка, 0 если запись без префикса длины или string::npos если заголовок не получен полностью
+			 */
+			size_t header(const char * buffer, const size_t size, size_t & length) const noexcept;
+		private:
+			/**
+			 * @brief Метод определения количества байт, необходимых для завершения записи в буфере
+			 *
+			 * @param buffer буфер входящих данных
+			 * @param size   размер буфера входящих данных
+			 * @return       количество байт или string::npos если запись в этих данных не завершается
+			 */
+			size_t need(const char * buffer, const size_t size) const noexcept;
+		private:
+			/**
+			 * @brief Метод вывода полученной записи
+			 *
+			 * @param buffer буфер данных записи
+			 * @param size   размер буфера данных записи
+			 */
+			void emit(const char * buffer, const size_t size) const noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения всех завершённых записей из буфера
+			 *
+			 * @param buffer буфер данных для разбора
+			 * @param size   размер буфера данных для разбора
+			 * @return       количество обработанных байт
+			 */
+			size_t frame(const char * buffer, const size_t size) noexcept;
+		public:
+			/**
+			 * @brief Метод очистки данных
+			 *
+			 */
+			void clear() noexcept;
+		public:
+			/**
+			 * @brief Метод добавления очередной порции данных
+			 *
+			 * @param buffer буфер данных для добавления
+			 * @param size   размер буфера данных для добавления
+			 */
+			void push(const char * buffer, const size_t size) noexcept;
+		public:
+			/**
+			 * @brief Метод завершения потока и вывода последней записи
+			 *
+			 */
+			void finish() noexcept;
+		public:
+			/**
+			 * @brief Метод установки максимального размера одной записи
+			 *
+			 * @param size максимальный размер записи
+			 */
+			void max(const size_t size) noexcept;
+		public:
+			/**
+			 * @brief Метод установки режима разделения записей
+			 *
+			 * @param framing режим разделения записей
+			 */
+			void framing(const framing_t framing) noexcept;
+		public:
+			/**
+			 * @brief Метод разрешения вывода пустых записей
+			 *
+			 * @param mode флаг вывода пустых записей
+			 */
+			void blank(const bool mode) noexcept;
+		public:
+			/**
+			 * @brief Метод установки функции обратного вызова при получении записи
+			 *
+			 * @param callback функция обратного вызова
+			 */
+			void on(function <void (const char *, const size_t)> callback) noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param fmk объект фреймворка
+			 * @param log объект для работы с логами
+			 */
+			Stream(const fmk_t * fmk, const log_t * log) noexcept :
+			 _framing(framing_t::LINE), _blank(false), _skip(false), _max(STREAM_RECORD_SIZE),
+			 _callback(nullptr), _fmk(fmk), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Stream() noexcept {}
+	} stream_t;
+};
+
+#endif // __ANYKS_ACU_STREAM__
@@ -0,0 +1,143 @@
+/**
+ * @file: workers.hpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __ANYKS_ACU_WORKERS__
+#define __ANYKS_ACU_WORKERS__
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include <global.hpp>
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+/**
+ * Модули AWH
+ */
+#include <awh/sys/fmk.hpp>
+#include <awh/sys/log.hpp>
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace anyks {
+	/**
+	 * Подписываемся на пространство имён awh
+	 */
+	using namespace awh;
+	/**
+	 * @brief Класс пула постоянных рабочих потоков, получающих задачи из очереди
+	 *
+	 */
+	typedef class ACU_SHARED_EXPORT Workers {
+		private:
+			// Флаг остановки рабочих потоков
+			bool _stop;
+		private:
+			// Количество выполняемых задач
+			size_t _active;
+		private:
+			// Мютекс для блокировки очереди задач
+			std::mutex _mtx;
+		private:
+			// Условная переменная появления задачи в очереди
+			condition_variable _task;
+			// Условная переменная завершения всех задач
+			condition_variable _done;
+		private:
+			// Очередь задач
+			queue <function <void (void)>> _tasks;
+		private:
+			// Список рабочих потоков
+			vector <std::thread> _threads;
+		private:
+			// Объект фреймворка
+			const fmk_t * _fmk;
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод обработки очереди задач рабочим потоком
+			 *
+			 */
+			void process() noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества запущенных рабочих потоков
+			 *
+			 * @return количество рабочих потоков
+			 */
+			size_t count() const noexcept;
+		public:
+			/**
+			 * @brief Метод запуска рабочих потоков (уже запущенные потоки продолжают работу)
+			 *
+			 * @param count необходимое количество рабочих потоков
+			 */
+			void start(const size_t count) noexcept;
+		public:
+			/**
+			 * @brief Метод остановки рабочих потоков после выполнения оставшихся задач
+			 *
+			 */
+			void stop() noexcept;
+		public:
+			/**
+			 * @brief Метод добавления задачи в очередь (без рабочих потоков задача выполняется сразу)
+			 *
+			 * @param task задача для выполнения
+			 */
+			void push(function <void (void)> task) noexcept;
+		public:
+			/**
+			 * @brief Метод ожидания выполнения всех задач очереди
+			 *
+			 */
+			void wait() noexcept;
+		public:
+			/**
+			 * @brief Конструктор копирования запрещён, объект владеет рабочими потоками
+			 *
+			 */
+			Workers(const Workers &) = delete;
+			/**
+			 * @brief Оператор копирования запрещён, объект владеет рабочими потоками
+			 *
+			 */
+			Workers & operator = (const Workers &) = delete;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param fmk объект фреймворка
+			 * @param log объект для работы с логами
+			 */
+			Workers(const fmk_t * fmk, const log_t * log) noexcept;
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Workers() noexcept;
+	} workers_t;
+};
+
+#endif // __ANYKS_ACU_WORKERS__
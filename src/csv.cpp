@@ -16,6 +16,15 @@
  */
 #include <csv.hpp>
 
+/**
+ * Подключаем SIMD-инструкции для архитектуры x86
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+#endif
+
 /**
  * Подписываемся на пространство имён awh
  */
@@ -26,107 +35,1236 @@ using namespace awh;
 using namespace rapidjson;
 
 /**
- * @brief Метод выполнения препарирования полученных данных строки
+ * Функция построения масок кавычек, разделителей и переносов строк блока из 64 байт
+ */
+typedef void (* masks_t)(const char *, const char, uint64_t &, uint64_t &, uint64_t &);
+/**
+ * @brief Функция получения номера младшего установленного бита маски
+ *
+ * @param mask маска для проверки (не должна быть нулевой)
+ * @return     номер младшего установленного бита
+ */
+static inline uint8_t trailing(const uint64_t mask) noexcept {
+	/**
+	 * Если используется компилятор GCC или Clang
+	 */
+	#if defined(__GNUC__)
+		// Выводим номер младшего бита
+		return static_cast <uint8_t> (__builtin_ctzll(mask));
+	/**
+	 * Для остальных компиляторов
+	 */
+	#else
+		// Номер младшего бита
+		uint8_t result = 0;
+		// Выполняем поиск младшего установленного бита
+		while(((mask >> result) & 1) == 0)
+			// Переходим к следующему биту
+			result++;
+		// Выводим номер младшего бита
+		return result;
+	#endif
+}
+/**
+ * Если инструкции SSE2 недоступны
+ */
+#if !defined(__SSE2__) && !defined(_M_X64)
+/**
+ * @brief Функция построения масок кавычек, разделителей и переносов строк блока из 64 байт без SIMD-инструкций
+ *
+ * @param block  блок данных из 64 байт
+ * @param delim  используемый разделитель ('0' - любой из символов ',', ';', '|')
+ * @param quotes маска позиций кавычек
+ * @param delims маска позиций разделителей
+ * @param breaks маска позиций переносов строк и возвратов каретки
+ */
+static void scalar(const char * block, const char delim, uint64_t & quotes, uint64_t & delims, uint64_t & breaks) noexcept {
+	// Сбрасываем маски блока
+	quotes = delims = breaks = 0;
+	// Переходим по всем символам блока
+	for(uint8_t i = 0; i < 64; i++){
+		// Получаем текущий символ
+		const char letter = block[i];
+		// Отмечаем позицию кавычек
+		quotes |= (static_cast <uint64_t> (letter == '"') << i);
+		// Отмечаем позицию разделителя
+		delims |= (static_cast <uint64_t> ((delim == '0') ? ((letter == ',') || (letter == ';') || (letter == '|')) : (letter == delim)) << i);
+		// Отмечаем позицию переноса строки или возврата каретки
+		breaks |= (static_cast <uint64_t> ((letter == '\n') || (letter == '\r')) << i);
+	}
+}
+#endif
+/**
+ * Если доступны инструкции SSE2
+ */
+#if defined(__SSE2__) || defined(_M_X64)
+/**
+ * @brief Функция построения масок кавычек, разделителей и переносов строк блока из 64 байт инструкциями SSE2
+ *
+ * @param block  блок данных из 64 байт
+ * @param delim  используемый разделитель ('0' - любой из символов ',', ';', '|')
+ * @param quotes маска позиций кавычек
+ * @param delims маска позиций разделителей
+ * @param breaks маска позиций переносов строк и возвратов каретки
+ */
+static void sse2(const char * block, const char delim, uint64_t & quotes, uint64_t & delims, uint64_t & breaks) noexcept {
+	// Сбрасываем маски блока
+	quotes = delims = breaks = 0;
+	// Переходим по всем частям блока по 16 байт
+	for(uint8_t i = 0; i < 4; i++){
+		// Загружаем часть блока
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast <const __m128i *> (block + (i * 16)));
+		// Отмечаем позиции кавычек
+		quotes |= (static_cast <uint64_t> (static_cast <uint16_t> (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"'))))) << (i * 16));
+		// Отмечаем позиции разделителя или любого из допустимых разделителей
+		const __m128i found = (delim != '0' ? _mm_cmpeq_epi8(chunk, _mm_set1_epi8(delim)) : _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(',')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(';'))),
+			_mm_cmpeq_epi8(chunk, _mm_set1_epi8('|'))
+		));
+		// Добавляем позиции разделителей в маску
+		delims |= (static_cast <uint64_t> (static_cast <uint16_t> (_mm_movemask_epi8(found))) << (i * 16));
+		// Отмечаем позиции переносов строк и возвратов каретки
+		breaks |= (static_cast <uint64_t> (static_cast <uint16_t> (_mm_movemask_epi8(_mm_or_si128(
+			_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))
+		)))) << (i * 16));
+	}
+}
+#endif
+/**
+ * Если компилятор позволяет собрать функцию AVX2 отдельно от остального кода
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/**
+ * @brief Функция построения масок кавычек, разделителей и переносов строк блока из 64 байт инструкциями AVX2
+ *
+ * @param block  блок данных из 64 байт
+ * @param delim  используемый разделитель ('0' - любой из символов ',', ';', '|')
+ * @param quotes маска позиций кавычек
+ * @param delims маска позиций разделителей
+ * @param breaks маска позиций переносов строк и возвратов каретки
+ */
+__attribute__((target("avx2"))) static void avx2(const char * block, const char delim, uint64_t & quotes, uint64_t & delims, uint64_t & breaks) noexcept {
+	// Сбрасываем маски блока
+	quotes = delims = breaks = 0;
+	// Переходим по всем частям блока по 32 байта
+	for(uint8_t i = 0; i < 2; i++){
+		// Загружаем часть блока
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast <const __m256i *> (block + (i * 32)));
+		// Отмечаем позиции кавычек
+		quotes |= (static_cast <uint64_t> (static_cast <uint32_t> (_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"'))))) << (i * 32));
+		// Отмечаем позиции разделителя или любого из допустимых разделителей
+		const __m256i found = (delim != '0' ? _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(delim)) : _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(',')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(';'))),
+			_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('|'))
+		));
+		// Добавляем позиции разделителей в маску
+		delims |= (static_cast <uint64_t> (static_cast <uint32_t> (_mm256_movemask_epi8(found))) << (i * 32));
+		// Отмечаем позиции переносов строк и возвратов каретки
+		breaks |= (static_cast <uint64_t> (static_cast <uint32_t> (_mm256_movemask_epi8(_mm256_or_si256(
+			_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'))
+		)))) << (i * 32));
+	}
+}
+#endif
+/**
+ * @brief Функция выбора построения масок для текущего процессора
+ *
+ * @return функция построения масок блока
+ */
+static masks_t masks() noexcept {
+	// Функция построения масок выбирается один раз по инструкциям, поддерживаемым процессором
+	static const masks_t result = []() noexcept -> masks_t {
+		/**
+		 * Если компилятор позволяет определить инструкции процессора
+		 */
+		#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+			// Если процессор поддерживает AVX2
+			if(__builtin_cpu_supports("avx2"))
+				// Выводим функцию AVX2
+				return &avx2;
+		#endif
+		/**
+		 * Если доступны инструкции SSE2
+		 */
+		#if defined(__SSE2__) || defined(_M_X64)
+			// Выводим функцию SSE2
+			return &sse2;
+		/**
+		 * Если SIMD-инструкции недоступны
+		 */
+		#else
+			// Выводим функцию без SIMD-инструкций
+			return &scalar;
+		#endif
+	}();
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод разбора данных по маскам кавычек, разделителей и переносов строк блоков из 64 байт
+ *
+ * @param buffer   буфер данных для разбора
+ * @param size     размер буфера данных для разбора
+ * @param delim    используемый разделитель ('0' - определяется автоматически для каждой строки)
+ * @param state    состояние парсинга, сохраняемое между блоками данных
+ * @param callback функция обратного вызова (если не установлена, строки сохраняются в контейнер)
+ */
+void anyks::CSV::tokenize(const char * buffer, const size_t size, const char delim, state_t & state, const function <void (const vector <string> &)> & callback) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Блок последних байт данных, дополненный нулями
+		char tail[64];
+		// Маски кавычек, разделителей и переносов строк текущего блока
+		uint64_t quotes = 0, delims = 0, breaks = 0;
+		// Позиция текущего символа, начало ещё не скопированного участка значения и начало блока, для которого построены маски
+		size_t pos = 0, start = 0, base = string::npos;
+		// Получаем функцию построения масок для текущего процессора
+		const masks_t build = masks();
+		/**
+		 * runFn Функция добавления участка обычных символов в значение ячейки
+		 * @param stop позиция конца участка
+		 */
+		auto runFn = [&](const size_t stop) -> void {
+			// Если участок не пустой
+			if(stop > start){
+				// Добавляем участок в значение ячейки целиком
+				state.cell.append(buffer + start, stop - start);
+				// Если участок находится вне кавычек
+				if(!state.quote){
+					// Снимаем флаг начала ячейки
+					state.begin = false;
+					// Устанавливаем флаг наличия данных
+					state.data = true;
+				}
+			}
+		};
+		// Переходим по всем символам данных
+		while(pos < size){
+			// Если предыдущим символом была кавычка внутри значения (в том числе в конце прошлого блока данных)
+			if(state.escape){
+				// Снимаем флаг получения кавычки
+				state.escape = false;
+				// Если кавычка удвоена
+				if(buffer[pos] == '"'){
+					// Добавляем кавычку в значение
+					state.cell.append(1, '"');
+					// Переходим к следующему символу
+					start = ++pos;
+					// Продолжаем разбор
+					continue;
+				}
+				// Одиночная кавычка закрывает значение, текущий символ разбирается вне кавычек
+				state.quote = false;
+			}
+			// Если ожидается возврат каретки
+			if(state.carriage){
+				// Снимаем флаг ожидающего возврата каретки
+				state.carriage = false;
+				// Если возврат каретки не завершает строку
+				if(buffer[pos] != '\n'){
+					// Добавляем возврат каретки в значение
+					state.cell.append(1, '\r');
+					// Снимаем флаг начала ячейки
+					state.begin = false;
+					// Устанавливаем флаг наличия данных
+					state.data = true;
+				}
+			}
+			// Если текущий символ находится за пределами блока, для которого построены маски
+			if((base == string::npos) || ((pos - base) >= 64)){
+				// Получаем начало блока текущего символа
+				base = (pos & ~static_cast <size_t> (63));
+				// Если блок полный, маски строятся прямо по данным
+				if((size - base) >= 64)
+					// Выполняем построение масок блока
+					build(buffer + base, delim, quotes, delims, breaks);
+				// Если блок последний и неполный
+				else {
+					// Выполняем заполнение блока нулями
+					::memset(tail, 0, sizeof(tail));
+					// Копируем последние байты данных
+					::memcpy(tail, buffer + base, size - base);
+					// Выполняем построение масок дополненного блока
+					build(tail, delim, quotes, delims, breaks);
+					// Оставляем только позиции данных (нулевые байты дополнения совпадают лишь с нулевым разделителем)
+					delims &= ((static_cast <uint64_t> (1) << (size - base)) - 1);
+				}
+			}
+			// Получаем маску значимых символов начиная с текущей позиции (внутри кавычек значимы только кавычки)
+			const uint64_t events = ((state.quote ? quotes : (quotes | delims | breaks)) & (~static_cast <uint64_t> (0) << (pos - base)));
+			// Если значимых символов в блоке не осталось, участок значения продолжается в следующем блоке
+			if(events == 0){
+				// Переходим к следующему блоку
+				pos = std::min(base + 64, size);
+				// Продолжаем разбор
+				continue;
+			}
+			// Получаем позицию значимого символа
+			const size_t index = (base + trailing(events));
+			// Получаем значимый символ
+			const char letter = buffer[index];
+			// Смещаем позицию за значимый символ
+			pos = (index + 1);
+			// Если значение находится внутри кавычек, найденный символ является кавычкой
+			if(state.quote){
+				// Добавляем участок значения до кавычки
+				runFn(index);
+				// Устанавливаем флаг получения кавычки (удвоенная или закрывающая кавычка определяется следующим символом)
+				state.escape = true;
+			// Если значение находится вне кавычек
+			} else {
+				// Получаем разделитель текущей строки
+				const char separator = (state.delim != '0' ? state.delim : delim);
+				// Определяем тип значимого символа
+				switch(letter){
+					// Если получен перенос строки
+					case '\n': {
+						// Если значение ячейки состоит из одного участка
+						if(state.cell.empty()){
+							// Если участок не пустой
+							if(index > start)
+								// Устанавливаем флаг наличия данных
+								state.data = true;
+							// Выводим полученную строку с последней ячейкой прямо из данных
+							this->emit(state, buffer + start, index - start, callback);
+						// Если значение ячейки собрано из нескольких участков
+						} else {
+							// Добавляем последний участок в значение ячейки
+							runFn(index);
+							// Выводим полученную строку
+							this->emit(state, state.cell.data(), state.cell.size(), callback);
+						}
+					} break;
+					// Если получен возврат каретки, он откладывается до следующего символа
+					case '\r': {
+						// Добавляем участок до возврата каретки
+						runFn(index);
+						// Устанавливаем флаг ожидающего возврата каретки
+						state.carriage = true;
+					} break;
+					// Если получена кавычка
+					case '"': {
+						// Добавляем участок до кавычки
+						runFn(index);
+						// Если кавычка открывает значение ячейки
+						if(state.begin)
+							// Устанавливаем флаг нахождения внутри кавычек
+							state.quote = true;
+						// Кавычка внутри значения без кавычек добавляется как есть
+						else state.cell.append(1, letter);
+						// Снимаем флаг начала ячейки
+						state.begin = false;
+						// Устанавливаем флаг наличия данных
+						state.data = true;
+					} break;
+					// Если получен разделитель ячеек
+					default: {
+						// Если строка уже разделяется другим символом, он остаётся в участке значения
+						if((separator != '0') && (letter != separator))
+							// Продолжаем разбор
+							continue;
+						// Если разделитель строки ещё не определён
+						if(separator == '0')
+							// Запоминаем разделитель строки
+							state.delim = letter;
+						// Если значение ячейки состоит из одного участка, оно копируется в ячейку напрямую
+						if(state.cell.empty())
+							// Добавляем ячейку в строку
+							state.store(buffer + start, index - start);
+						// Если значение ячейки собрано из нескольких участков
+						else {
+							// Добавляем последний участок в значение ячейки
+							runFn(index);
+							// Добавляем ячейку в строку
+							state.store(state.cell.data(), state.cell.size());
+							// Выполняем очистку значения ячейки
+							state.cell.clear();
+						}
+						// Устанавливаем флаг начала ячейки
+						state.begin = true;
+						// Устанавливаем флаг наличия данных
+						state.data = true;
+					}
+				}
+			}
+			// Следующий участок значения начинается за значимым символом
+			start = pos;
+		}
+		// Добавляем оставшийся участок значения (строка продолжится в следующем блоке данных)
+		runFn(size);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(size, delim), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод добавления строки в хранилище ячеек
+ *
+ * @param row список ячеек строки
+ */
+void anyks::CSV::push(vector <string> & row) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Определяем режим хранения ячеек
+		switch(static_cast <uint8_t> (this->_storage)){
+			// Если ячейки хранятся отдельными строками
+			case static_cast <uint8_t> (storage_t::STRINGS):
+				// Переносим строку в схему соответствий
+				this->_mapping.push_back(::move(row));
+			break;
+			// Если ячейки хранятся в едином буфере
+			case static_cast <uint8_t> (storage_t::ARENA): {
+				// Если хранилище ещё пустое
+				if(this->_rows.empty()){
+					// Устанавливаем начало первой строки
+					this->_rows.push_back(0);
+					// Устанавливаем начало буфера ячеек
+					this->_offsets.push_back(0);
+				}
+				// Переходим по всем ячейкам строки
+				for(auto & cell : row){
+					// Добавляем данные ячейки в буфер
+					this->_arena.append(cell);
+					// Запоминаем конец ячейки в буфере
+					this->_offsets.push_back(this->_arena.size());
+				}
+				// Запоминаем начало следующей строки
+				this->_rows.push_back(this->_offsets.size() - 1);
+				// Если копия ячеек была собрана, она больше не актуальна
+				if(!this->_cache.empty())
+					// Выполняем очистку копии ячеек
+					this->_cache.clear();
+			} break;
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(row.size()), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод добавления значения столбца в строку с экранированием
+ *
+ * @param col    значение столбца
+ * @param result строка для добавления
+ */
+void anyks::CSV::column(const string_view col, string & result) const noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Символ для сравнения
+		char letter = 0;
+		// Флаг проверки на требование экранирования
+		bool shielding = false;
+		// Выполняем перебор всех символов столбца
+		for(size_t i = 0; !shielding && (i < col.size()); i++){
+			// Получаем символ для проверки
+			letter = col[i];
+			// Если найдены символы требующие экранирования
+			shielding = (
+				(letter == ';') || (letter == ',') || (letter == '|') || ::isspace(letter) ||
+				(letter == 32) || (letter == ' ') || (letter == '\t') || (letter == '\n') ||
+				(letter == '\r') || (letter == '\f') || (letter == '\v')
+			);
+		}
+		// Если требуется экранирование
+		if(shielding)
+			// Добавляем экранирование
+			result.append(1, '"');
+		// Позиция начала добавляемого участка
+		size_t start = 0;
+		// Переходим по всем найденным кавычкам
+		for(size_t stop = col.find('"'); stop != string_view::npos; stop = col.find('"', start)){
+			// Добавляем участок столбца вместе с кавычкой
+			result.append(col.data() + start, (stop - start) + 1);
+			// Добавляем ещё одну кавычку
+			result.append(1, '"');
+			// Смещаем начало участка за найденную кавычку
+			start = (stop + 1);
+		}
+		// Добавляем оставшийся участок столбца
+		result.append(col.data() + start, col.size() - start);
+		// Если требуется экранирование
+		if(shielding)
+			// Добавляем экранирование
+			result.append(1, '"');
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(col)), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод определения типа ячейки по строгому формату записи
+ *
+ * @param cell значение ячейки
+ * @return     тип ячейки
+ */
+anyks::CSV::type_t anyks::CSV::type(const string_view cell) const noexcept {
+	// Если ячейка является булевым значением
+	if((cell == "true") || (cell == "false"))
+		// Выводим тип ячейки
+		return type_t::BOOLEAN;
+	// Позиция первой цифры
+	const size_t start = (!cell.empty() && (cell.front() == '-') ? 1 : 0);
+	// Если цифры в ячейке отсутствуют
+	if(start >= cell.size())
+		// Сообщаем, что тип не определён
+		return type_t::NONE;
+	// Позиция десятичной точки
+	size_t point = 0;
+	// Переходим по всем символам ячейки
+	for(size_t i = start; i < cell.size(); i++){
+		// Если найдена десятичная точка
+		if(cell[i] == '.'){
+			// Если точка повторяется, стоит первой или последней
+			if((point > 0) || (i == start) || (i == (cell.size() - 1)))
+				// Сообщаем, что тип не определён
+				return type_t::NONE;
+			// Запоминаем позицию десятичной точки
+			point = i;
+		// Если найдена не цифра
+		} else if((cell[i] < '0') || (cell[i] > '9'))
+			// Сообщаем, что тип не определён
+			return type_t::NONE;
+	}
+	// Выводим тип ячейки
+	return (point > 0 ? type_t::DECIMAL : type_t::NUMBER);
+}
+/**
+ * @brief Метод определения типа столбца по выборке ячеек
+ *
+ * @param col   индекс столбца
+ * @param start индекс первой строки выборки
+ * @return      тип столбца
+ */
+anyks::CSV::type_t anyks::CSV::infer(const size_t col, const size_t start) const noexcept {
+	// Результат работы функции
+	type_t result = type_t::NONE;
+	// Получаем количество собранных строк
+	const size_t rows = this->rows();
+	// Количество проверенных ячеек
+	size_t count = 0;
+	// Переходим по строкам выборки
+	for(size_t i = start; (i < rows) && (count < CSV_SAMPLE_SIZE); i++){
+		// Получаем значение ячейки
+		const string_view cell = this->cell(i, col);
+		// Если ячейка пустая, она не влияет на тип столбца
+		if(cell.empty())
+			// Пропускаем ячейку
+			continue;
+		// Получаем тип ячейки
+		const type_t type = this->type(cell);
+		// Если ячейка не соответствует ни одному типу
+		if(type == type_t::NONE)
+			// Сообщаем, что столбец содержит строки
+			return type_t::STRING;
+		// Если тип столбца уже отличается (например, целые и дробные числа), значения проверяются по отдельности
+		if((count > 0) && (type != result))
+			// Сообщаем, что тип столбца не определён
+			result = type_t::NONE;
+		// Запоминаем тип столбца
+		else result = type;
+		// Увеличиваем количество проверенных ячеек
+		count++;
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод быстрого преобразования ячейки в значение типа столбца
+ *
+ * @param cell   значение ячейки
+ * @param type   тип столбца
+ * @param result значение для установки
+ * @return       результат преобразования (false - ячейка не соответствует типу столбца)
+ */
+bool anyks::CSV::convert(const string_view cell, const type_t type, Value & result) const noexcept {
+	// Если тип столбца определён и ячейка ему соответствует
+	if((type != type_t::NONE) && (this->type(cell) == type)){
+		// Получаем начало значения ячейки
+		const char * begin = cell.data();
+		// Получаем конец значения ячейки
+		const char * end = (cell.data() + cell.size());
+		// Определяем тип столбца
+		switch(static_cast <uint8_t> (type)){
+			// Если столбец содержит целые числа
+			case static_cast <uint8_t> (type_t::NUMBER): {
+				// Если число отрицательное
+				if(cell.front() == '-'){
+					// Значение отрицательного числа
+					int64_t number = 0;
+					// Выполняем преобразование числа
+					const auto status = std::from_chars(begin, end, number);
+					// Если число не поместилось в диапазон, ячейка проверяется по отдельности
+					if((status.ec != std::errc()) || (status.ptr != end))
+						// Сообщаем, что преобразование не выполнено
+						return false;
+					// Устанавливаем значение
+					result.SetInt64(number);
+				// Если число положительное
+				} else {
+					// Значение положительного числа
+					uint64_t number = 0;
+					// Выполняем преобразование числа
+					const auto status = std::from_chars(begin, end, number);
+					// Если число не поместилось в диапазон, ячейка проверяется по отдельности
+					if((status.ec != std::errc()) || (status.ptr != end))
+						// Сообщаем, что преобразование не выполнено
+						return false;
+					// Устанавливаем значение
+					result.SetUint64(number);
+				}
+				// Сообщаем, что преобразование выполнено
+				return true;
+			}
+			// Если столбец содержит числа с плавающей точкой
+			case static_cast <uint8_t> (type_t::DECIMAL): {
+				// Буфер значения с завершающим нулём для strtod (from_chars для double есть не во всех стандартных библиотеках)
+				char buffer[64];
+				// Если значение длиннее буфера, ячейка проверяется по отдельности
+				if(cell.size() >= sizeof(buffer))
+					// Сообщаем, что преобразование не выполнено
+					return false;
+				// Копируем значение ячейки
+				::memcpy(buffer, begin, cell.size());
+				// Устанавливаем завершающий ноль
+				buffer[cell.size()] = '\0';
+				// Конец преобразованной части значения
+				char * stop = nullptr;
+				// Выполняем преобразование числа
+				const double number = ::strtod(buffer, &stop);
+				// Если число не преобразовано целиком
+				if(stop != (buffer + cell.size()))
+					// Сообщаем, что преобразование не выполнено
+					return false;
+				// Если число вышло за пределы нормального диапазона, ячейка проверяется по отдельности
+				if(!std::isnormal(number) && ((number != 0.) || (cell.find_first_of("123456789") != string_view::npos)))
+					// Сообщаем, что преобразование не выполнено
+					return false;
+				// Устанавливаем значение
+				result.SetDouble(number);
+				// Сообщаем, что преобразование выполнено
+				return true;
+			}
+			// Если столбец содержит булевы значения
+			case static_cast <uint8_t> (type_t::BOOLEAN):
+				// Устанавливаем значение
+				result.SetBool(cell.front() == 't');
+			// Сообщаем, что преобразование выполнено
+			return true;
+		}
+	}
+	// Сообщаем, что преобразование не выполнено
+	return false;
+}
+/**
+ * @brief Метод преобразования ячейки в значение JSON
+ *
+ * @param cell      значение ячейки
+ * @param type      тип столбца
+ * @param result    значение для установки
+ * @param buffer    буфер для проверки значения ячейки
+ * @param allocator аллокатор значений JSON
+ */
+void anyks::CSV::value(const string_view cell, const type_t type, Value & result, string & buffer, Document::AllocatorType & allocator) const noexcept {
+	// Если столбец содержит строки
+	if(type == type_t::STRING){
+		// Устанавливаем значение без проверки
+		result.SetString(cell.data(), cell.size(), allocator);
+		// Выходим из функции
+		return;
+	}
+	// Если ячейка соответствует типу столбца, значение уже установлено
+	if(this->convert(cell, type, result))
+		// Выходим из функции
+		return;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем запись для проверки
+		buffer.assign(cell);
+		// Если запись является числом
+		if(this->_fmk->is(buffer, fmk_t::check_t::NUMBER)){
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Если число положительное
+				if(buffer.front() != '-')
+					// Устанавливаем полученное значение
+					result.SetUint64(static_cast <uint64_t> (::stoull(buffer)));
+				// Устанавливаем полученное значение
+				else result.SetInt64(static_cast <int64_t> (::stoll(buffer)));
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const exception &) {
+				// Устанавливаем полученное значение
+				result.SetString(cell.data(), cell.size(), allocator);
+			}
+		// Если запись является числом с плавающей точкой
+		} else if(this->_fmk->is(buffer, fmk_t::check_t::DECIMAL)) {
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Устанавливаем полученное значение
+				result.SetDouble(::stod(buffer));
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const exception &) {
+				// Устанавливаем полученное значение
+				result.SetString(cell.data(), cell.size(), allocator);
+			}
+		// Если число является булевым истинным значением
+		} else if(this->_fmk->compare("true", buffer))
+			// Устанавливаем полученное значение
+			result.SetBool(true);
+		// Если число является булевым ложным значением
+		else if(this->_fmk->compare("false", buffer))
+			// Устанавливаем полученное значение
+			result.SetBool(false);
+		// Устанавливаем полученное значение
+		else result.SetString(cell.data(), cell.size(), allocator);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(cell)), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод потокового чтения файла блоками через feed/finish
+ *
+ * @param filename адрес файла контейнера CSV для чтения
+ * @param delim    используемый разделитель ('0' - определяется автоматически для каждой строки)
+ */
+void anyks::CSV::stream(const string & filename, const char delim) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Создаём объект отображения файла в память
+		mmap_t mapping(this->_fmk, this->_log);
+		// Если файл отображён в память
+		if(mapping.open(filename)){
+			// Получаем данные файла
+			const char * data = mapping.data();
+			// Получаем размер данных файла
+			const size_t size = mapping.size();
+			// Выполняем перебор данных файла блоками
+			for(size_t offset = 0; offset < size; offset += static_cast <size_t> (CSV_BUFFER_SIZE))
+				// Выполняем потоковый парсинг очередного блока
+				this->feed(data + offset, std::min(size - offset, static_cast <size_t> (CSV_BUFFER_SIZE)), delim);
+		// Если файл не удалось отобразить в память
+		} else {
+			// Выполняем построчное чтение файла
+			this->_fs.readFile3(filename, [delim, this](const string & text) noexcept -> void {
+				// Выполняем потоковый парсинг полученной строки
+				this->feed(text.data(), text.size(), delim);
+				// Возвращаем перенос строки, отброшенный при чтении
+				this->feed("\n", 1, delim);
+			});
+		}
+		// Завершаем потоковый парсинг
+		this->finish();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(filename, delim), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод разбиения текста на участки по переносам строк
+ *
+ * Кавычки при разбиении не учитываются: перенос строки внутри значения в кавычках
+ * обнаруживается после парсинга по состоянию предыдущего участка (см. settle)
+ *
+ * @param text  текст для разбиения
+ * @param count желаемое количество участков
+ * @return      список участков текста в исходном порядке
+ */
+vector <string_view> anyks::CSV::chunks(const string_view text, const size_t count) const noexcept {
+	// Результат работы функции
+	vector <string_view> result;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Начало текущего участка
+		size_t start = 0;
+		// Получаем размер текста
+		const size_t size = text.size();
+		// Выделяем память для всех участков
+		result.reserve(count);
+		// Переходим по всем границам участков
+		for(size_t i = 1; (i < count) && (start < size); i++){
+			// Получаем желаемую позицию границы участка
+			const size_t target = std::max(start + 1, (size / count) * i);
+			// Если граница выходит за пределы текста
+			if(target >= size)
+				// Выходим из цикла
+				break;
+			// Выполняем поиск переноса строки от желаемой позиции
+			const char * found = reinterpret_cast <const char *> (::memchr(text.data() + target, '\n', size - target));
+			// Если перенос строки не найден, оставшийся текст образует последний участок
+			if(found == nullptr)
+				// Выходим из цикла
+				break;
+			// Получаем начало следующей строки
+			const size_t stop = (static_cast <size_t> (found - text.data()) + 1);
+			// Если после переноса строки текст закончился, последний участок не выделяется
+			if(stop >= size)
+				// Выходим из цикла
+				break;
+			// Добавляем участок текста
+			result.push_back(text.substr(start, stop - start));
+			// Смещаем начало текущего участка
+			start = stop;
+		}
+		// Если текст ещё остался
+		if(start < size)
+			// Добавляем последний участок текста
+			result.push_back(text.substr(start));
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text.size(), count), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+		// Выполняем очистку списка участков
+		result.clear();
+		// Выполняем разбор текста одним участком
+		result.push_back(text);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод параллельного парсинга участков текста
+ *
+ * @param chunks  список участков текста
+ * @param start   индекс первого участка
+ * @param results контейнеры для результатов парсинга участков (по одному на поток)
+ * @param delim   используемый разделитель
+ * @return        количество разобранных участков
+ */
+size_t anyks::CSV::spread(const vector <string_view> & chunks, const size_t start, vector <std::unique_ptr <CSV>> & results, const char delim) const noexcept {
+	// Если участки для парсинга остались
+	if((start < chunks.size()) && !results.empty()){
+		// Получаем количество участков текущего прохода
+		const size_t count = std::min(results.size(), chunks.size() - start);
+		// Запускаем недостающие рабочие потоки (потоки пула сохраняются между проходами и вызовами)
+		this->_workers.start(count - 1);
+		// Переходим по всем участкам кроме первого
+		for(size_t i = 1; i < count; i++){
+			// Получаем контейнер для результатов парсинга участка
+			CSV * csv = results[i].get();
+			// Получаем участок текста
+			const string_view chunk = chunks[start + i];
+			// Выполняем парсинг участка в рабочем потоке
+			this->_workers.push([csv, chunk, delim]() noexcept -> void {
+				// Выполняем парсинг участка текста с начала строки (последняя строка участка не выводится)
+				csv->feed(chunk.data(), chunk.size(), delim);
+			});
+		}
+		// Выполняем парсинг первого участка в текущем потоке
+		results.front()->feed(chunks[start].data(), chunks[start].size(), delim);
+		// Выполняем ожидание завершения парсинга остальных участков
+		this->_workers.wait();
+		// Выводим количество разобранных участков
+		return count;
+	}
+	// Сообщаем, что участки не разобраны
+	return 0;
+}
+/**
+ * @brief Метод проверки результатов параллельного парсинга участков
+ *
+ * Участок разбирается с начала строки, что верно, только если предыдущий участок
+ * завершился вне кавычек (перенос строки вне кавычек полностью сбрасывает состояние).
+ * Иначе результат участка отбрасывается и участок дочитывается последовательно
+ * в контейнер предыдущего участка с его состоянием
+ *
+ * @param chunks  список участков текста
+ * @param start   индекс первого участка
+ * @param count   количество разобранных участков
+ * @param results контейнеры с результатами парсинга участков
+ * @param delim   используемый разделитель
+ * @return        количество участков, вошедших в результаты (больше разобранных, если кавычки не закрыты в конце прохода)
+ */
+size_t anyks::CSV::settle(const vector <string_view> & chunks, const size_t start, const size_t count, vector <std::unique_ptr <CSV>> & results, const char delim) const noexcept {
+	// Результат работы функции
+	size_t result = count;
+	// Если участки разобраны
+	if(count > 0){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем контейнер, состояние которого соответствует последовательному парсингу текста
+			CSV * tail = results.front().get();
+			// Переходим по всем участкам кроме первого
+			for(size_t i = 1; i < count; i++){
+				// Если предыдущий участок завершился вне кавычек, участок разобран верно
+				if(!tail->_state.quote && !tail->_state.escape)
+					// Запоминаем контейнер участка
+					tail = results[i].get();
+				// Если участок начинается внутри значения в кавычках
+				else {
+					// Выполняем очистку неверного результата участка
+					results[i]->clear();
+					// Выполняем парсинг участка с состоянием предыдущего участка
+					tail->feed(chunks[start + i].data(), chunks[start + i].size(), delim);
+				}
+			}
+			// Если последний участок прохода завершился внутри кавычек, дочитываем следующие участки
+			while((tail->_state.quote || tail->_state.escape) && ((start + result) < chunks.size())){
+				// Выполняем парсинг следующего участка с состоянием предыдущего участка
+				tail->feed(chunks[start + result].data(), chunks[start + result].size(), delim);
+				// Увеличиваем количество участков, вошедших в результаты
+				result++;
+			}
+			// Если разобраны все участки текста
+			if((start + result) >= chunks.size())
+				// Добавляем последнюю строку текста
+				tail->emit(tail->_state, tail->_state.cell.data(), tail->_state.cell.size(), nullptr);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(start, count, delim), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод переноса строк другого контейнера в конец текущего
+ *
+ * @param csv контейнер со строками для переноса
+ */
+void anyks::CSV::append(CSV & csv) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Определяем режим хранения ячеек
+		switch(static_cast <uint8_t> (this->_storage)){
+			// Если ячейки хранятся отдельными строками
+			case static_cast <uint8_t> (storage_t::STRINGS): {
+				// Если текущий контейнер пустой
+				if(this->_mapping.empty())
+					// Забираем строки контейнера целиком
+					this->_mapping.swap(csv._mapping);
+				// Выполняем перенос строк в конец текущего контейнера
+				else this->_mapping.insert(this->_mapping.end(), std::make_move_iterator(csv._mapping.begin()), std::make_move_iterator(csv._mapping.end()));
+			} break;
+			// Если ячейки хранятся в едином буфере
+			case static_cast <uint8_t> (storage_t::ARENA): {
+				// Если текущий контейнер пустой
+				if(this->_rows.empty()){
+					// Забираем буфер ячеек целиком
+					this->_arena.swap(csv._arena);
+					// Забираем смещения ячеек целиком
+					this->_offsets.swap(csv._offsets);
+					// Забираем границы строк целиком
+					this->_rows.swap(csv._rows);
+				// Если контейнер со строками не пустой
+				} else if(!csv._rows.empty()) {
+					// Получаем смещение буфера ячеек
+					const size_t offset = this->_arena.size();
+					// Получаем количество уже собранных ячеек
+					const size_t cells = (this->_offsets.size() - 1);
+					// Добавляем данные ячеек в буфер
+					this->_arena.append(csv._arena);
+					// Переходим по всем смещениям ячеек кроме начала буфера
+					for(size_t i = 1; i < csv._offsets.size(); i++)
+						// Добавляем смещение конца ячейки
+						this->_offsets.push_back(offset + csv._offsets[i]);
+					// Переходим по всем границам строк кроме первой
+					for(size_t i = 1; i < csv._rows.size(); i++)
+						// Добавляем начало следующей строки
+						this->_rows.push_back(cells + csv._rows[i]);
+				}
+				// Выполняем очистку копии ячеек
+				this->_cache.clear();
+			} break;
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выполняем очистку перенесённого контейнера
+	csv.clear();
+}
+/**
+ * @brief Метод вывода разобранной строки
+ *
+ * @param state    состояние парсинга
+ * @param data     данные последней ячейки строки
+ * @param length   размер данных последней ячейки строки
+ * @param callback функция обратного вызова (если не установлена, строка сохраняется в контейнер)
+ */
+void anyks::CSV::emit(state_t & state, const char * data, const size_t length, const function <void (const vector <string> &)> & callback) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Если строка содержит данные (пустые строки пропускаются)
+		if(state.data){
+			// Добавляем последнюю ячейку строки
+			state.store(data, length);
+			// Удаляем ячейки, оставшиеся от предыдущих строк
+			state.row.resize(state.count);
+			// Если функция обратного вызова установлена
+			if(callback != nullptr)
+				// Выводим полученную строку
+				callback(state.row);
+			// Добавляем строку в хранилище ячеек
+			else this->push(state.row);
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Сбрасываем количество заполненных ячеек (память ячеек сохраняется для следующей строки)
+	state.count = 0;
+	// Выполняем очистку значения ячейки
+	state.cell.clear();
+	// Снимаем флаг нахождения внутри кавычек
+	state.quote = false;
+	// Снимаем флаг получения кавычки внутри кавычек
+	state.escape = false;
+	// Снимаем флаг ожидающего возврата каретки
+	state.carriage = false;
+	// Снимаем флаг наличия данных в строке
+	state.data = false;
+	// Устанавливаем флаг начала ячейки
+	state.begin = true;
+	// Сбрасываем разделитель строки
+	state.delim = '0';
+}
+/**
+ * @brief Метод очистки данных
+ *
+ */
+void anyks::CSV::clear() noexcept {
+	// Выполняем очистку собранных данных
+	this->_mapping.clear();
+	// Выполняем очистку буфера ячеек
+	this->_arena.clear();
+	// Выполняем очистку смещений ячеек
+	this->_offsets.clear();
+	// Выполняем очистку границ строк
+	this->_rows.clear();
+	// Выполняем очистку копии ячеек
+	this->_cache.clear();
+	// Выполняем сброс состояния потокового парсинга
+	this->_state = state_t();
+}
+/**
+ * @brief Метод установки флага использования заголовков
+ *
+ * @param mode флаг использования заголовков
+ */
+void anyks::CSV::header(const bool mode) noexcept {
+	// Устанавливаем флаг использования заголовков
+	this->_header = mode;
+}
+/**
+ * @brief Метод получения режима хранения ячеек
+ *
+ * @return режим хранения ячеек
+ */
+anyks::CSV::storage_t anyks::CSV::storage() const noexcept {
+	// Выводим режим хранения ячеек
+	return this->_storage;
+}
+/**
+ * @brief Метод установки режима хранения ячеек (собранные данные удаляются)
+ *
+ * @param storage режим хранения ячеек
+ */
+void anyks::CSV::storage(const storage_t storage) noexcept {
+	// Если режим хранения изменился
+	if(this->_storage != storage){
+		// Выполняем очистку собранных данных
+		this->clear();
+		// Устанавливаем режим хранения ячеек
+		this->_storage = storage;
+	}
+}
+/**
+ * @brief Метод выполнения парсинга текста
+ *
+ * @param text текст для парсинга
+ */
+void anyks::CSV::parse(const string_view text) noexcept {
+	// Если текст передан
+	if(!text.empty())
+		// Выполняем парсинг переданной строки
+		this->parse(text, '0');
+	// Выводим сообщение об ошибке
+	else {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
+		#endif
+	}
+}
+/**
+ * @brief Метод выполнения парсинга текста
  *
- * @param buffer буфер данных для препарирования
- * @param size   размер буфера данных для препарирования
- * @param delim  используемый разделитель
+ * @param text  текст для парсинга
+ * @param delim используемый разделитель
  */
-void anyks::CSV::prepare(const char * buffer, const size_t size, const char delim) noexcept {
-	// Если данные переданы
-	if((buffer != nullptr) && (size > 0)){
+void anyks::CSV::parse(const string_view text, const char delim) noexcept {
+	// Если текст передан
+	if(!text.empty()){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Результирующая строка
-			string text = "";
-			// Статус получения кавычек
-			bool quote = false;
-			// Список собранных результатов
-			vector <string> result;
-			// Выполняем перебор всех полученных символов
-			for(size_t i = 0; i < size; i++){
-				// Выполняем проверку, является ли символ кавычками
-				if(buffer[i] == '"'){
-					// Если кавычки ещё не установлены
-					if(!quote){
-						// Устанавливаем флаг кавычек
-						quote = !quote;
-						// Если следующий символ тоже кавычки
-						if(buffer[i + 1] == '"'){
-							// Если и следующий символ тоже кавычки
-							if(buffer[i + 2] == '"'){
-								// Добавляем символ в строку
-								text.append(1, buffer[i]);
-								// Выполняем смещение на два символа
-								i += 2;
-							// Если следующий символ является разделителем
-							} else if((buffer[i + 2] == delim) || ((delim == '0') && ((buffer[i + 2] == ',') || (buffer[i + 2] == ';') || (buffer[i + 2] == '|')))) {
-								// Снимаем флаг кавычек
-								quote = !quote;
-								// Добавляем пустой разделитель
-								result.push_back("");
-								// Выполняем смещение на два символа
-								i += 2;
-							// Если мы получили какой-то другой символ
-							} else {
-								// Добавляем символ в строку
-								text.append(1, buffer[i]);
-								// Выполняем смещение на один символ
-								i++;
-							}
-						}
-					// Если кавычки уже установлены
-					} else {
-						// Если следующий символ тоже кавычки
-						if(buffer[i + 1] == '"'){
-							// Добавляем символ в строку
-							text.append(1, buffer[i]);
-							// Если и следующий символ тоже кавычки
-							if(buffer[i + 2] == '"'){
-								// Выполняем смещение на два символа
-								i += 2;
-								// Снимаем флаг кавычек
-								quote = !quote;
-							// Выполняем смещение на один символ
-							} else i++;
-						// Снимаем флаг кавычек
-						} else quote = !quote;
-					}
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Выполняем сборку результатов
-						result.push_back(::move(text));
-				// Если символ не является кавычками, но является разделителем или концом строки
-				} else if(!quote && (((delim != '0') && (buffer[i] == delim)) || ((i + 1) == size))) {
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Добавляем символ в строку
-						text.append(1, buffer[i]);
-					// Выполняем сборку результатов
-					result.push_back(::move(text));
-					// Очищаем результирующую строку
-					text.clear();
-				// Если символ не является кавычками, но является произвольным разделителем или концом строки
-				} else if(!quote && (((delim == '0') && ((buffer[i] == ',') || (buffer[i] == ';') || (buffer[i] == '|'))) || ((i + 1) == size))) {
-					// Выполняем установку разделителя
-					(* const_cast <char *> (&delim)) = buffer[i];
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Добавляем символ в строку
-						text.append(1, buffer[i]);
-					// Выполняем сборку результатов
-					result.push_back(::move(text));
-					// Очищаем результирующую строку
-					text.clear();
-				// Добавляем символ как он есть
-				} else text.append(1, buffer[i]);
-			}
-			// Если результат получен
-			if(!result.empty())
-				// Формируем итоговый результат
-				this->_mapping.push_back(::move(result));
+			// Состояние парсинга текста
+			state_t state;
+			// Выполняем разбор всего текста по маскам блоков (строки выделяются вместе с ячейками)
+			this->tokenize(text.data(), text.size(), delim, state, nullptr);
+			// Добавляем последнюю строку в хранилище ячеек
+			this->emit(state, state.cell.data(), state.cell.size(), nullptr);
 		/**
 		 * Если возникает ошибка
 		 */
@@ -136,7 +1274,7 @@ void anyks::CSV::prepare(const char * buffer, const size_t size, const char deli
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, delim), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -152,119 +1290,36 @@ void anyks::CSV::prepare(const char * buffer, const size_t size, const char deli
 		 */
 		#if DEBUG_MODE
 			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, delim), log_t::flag_t::CRITICAL, "Data for preparing received corrupted");
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		/**
 		* Если режим отладки не включён
 		*/
 		#else
 			// Выводим сообщение об ошибке
-			this->_log->print("%s", log_t::flag_t::CRITICAL, "Data for preparing received corrupted");
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		#endif
 	}
 }
 /**
- * @brief Метод выполнения препарирования полученных данных строки
+ * @brief Метод выполнения парсинга текста без сохранения результата
  *
- * @param buffer   буфер данных для препарирования
- * @param size     размер буфера данных для препарирования
- * @param callback функция обратного вызова
- * @param delim    используемый разделитель
+ * @param text     текст для парсинга
+ * @param callback функция обратного вызова для каждой строки
+ * @param delim    используемый разделитель ('0' - определяется автоматически)
  */
-void anyks::CSV::prepare(const char * buffer, const size_t size, function <void (const vector <string> &)> callback, const char delim) noexcept {
-	// Если данные переданы
-	if((buffer != nullptr) && (size > 0) && (callback != nullptr)){
+void anyks::CSV::parse(const string_view text, function <void (const vector <string> &)> callback, const char delim) noexcept {
+	// Если текст и функция обратного вызова переданы
+	if(!text.empty() && (callback != nullptr)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Результирующая строка
-			string text = "";
-			// Статус получения кавычек
-			bool quote = false;
-			// Список собранных результатов
-			vector <string> result;
-			// Выполняем перебор всех полученных символов
-			for(size_t i = 0; i < size; i++){
-				// Выполняем проверку, является ли символ кавычками
-				if(buffer[i] == '"'){
-					// Если кавычки ещё не установлены
-					if(!quote){
-						// Устанавливаем флаг кавычек
-						quote = !quote;
-						// Если следующий символ тоже кавычки
-						if(buffer[i + 1] == '"'){
-							// Если и следующий символ тоже кавычки
-							if(buffer[i + 2] == '"'){
-								// Добавляем символ в строку
-								text.append(1, buffer[i]);
-								// Выполняем смещение на два символа
-								i += 2;
-							// Если следующий символ является разделителем
-							} else if((buffer[i + 2] == delim) || ((delim == '0') && ((buffer[i + 2] == ',') || (buffer[i + 2] == ';') || (buffer[i + 2] == '|')))) {
-								// Снимаем флаг кавычек
-								quote = !quote;
-								// Добавляем пустой разделитель
-								result.push_back("");
-								// Выполняем смещение на два символа
-								i += 2;
-							// Если мы получили какой-то другой символ
-							} else {
-								// Добавляем символ в строку
-								text.append(1, buffer[i]);
-								// Выполняем смещение на один символ
-								i++;
-							}
-						}
-					// Если кавычки уже установлены
-					} else {
-						// Если следующий символ тоже кавычки
-						if(buffer[i + 1] == '"'){
-							// Добавляем символ в строку
-							text.append(1, buffer[i]);
-							// Если и следующий символ тоже кавычки
-							if(buffer[i + 2] == '"'){
-								// Выполняем смещение на два символа
-								i += 2;
-								// Снимаем флаг кавычек
-								quote = !quote;
-							// Выполняем смещение на один символ
-							} else i++;
-						// Снимаем флаг кавычек
-						} else quote = !quote;
-					}
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Выполняем сборку результатов
-						result.push_back(::move(text));
-				// Если символ не является кавычками, но является разделителем или концом строки
-				} else if(!quote && (((delim != '0') && (buffer[i] == delim)) || ((i + 1) == size))) {
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Добавляем символ в строку
-						text.append(1, buffer[i]);
-					// Выполняем сборку результатов
-					result.push_back(::move(text));
-					// Очищаем результирующую строку
-					text.clear();
-				// Если символ не является кавычками, но является произвольным разделителем или концом строки
-				} else if(!quote && (((delim == '0') && ((buffer[i] == ',') || (buffer[i] == ';') || (buffer[i] == '|'))) || ((i + 1) == size))) {
-					// Выполняем установку разделителя
-					(* const_cast <char *> (&delim)) = buffer[i];
-					// Если мы достигли конца строки
-					if((i + 1) == size)
-						// Добавляем символ в строку
-						text.append(1, buffer[i]);
-					// Выполняем сборку результатов
-					result.push_back(::move(text));
-					// Очищаем результирующую строку
-					text.clear();
-				// Добавляем символ как он есть
-				} else text.append(1, buffer[i]);
-			}
-			// Если результат получен
-			if(!result.empty())
-				// Формируем итоговый результат
-				callback(::move(result));
+			// Состояние парсинга текста
+			state_t state;
+			// Выполняем разбор всего текста по маскам блоков (строки выделяются вместе с ячейками)
+			this->tokenize(text.data(), text.size(), delim, state, callback);
+			// Выводим последнюю строку
+			this->emit(state, state.cell.data(), state.cell.size(), callback);
 		/**
 		 * Если возникает ошибка
 		 */
@@ -274,7 +1329,7 @@ void anyks::CSV::prepare(const char * buffer, const size_t size, function <void
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, delim), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -290,51 +1345,82 @@ void anyks::CSV::prepare(const char * buffer, const size_t size, function <void
 		 */
 		#if DEBUG_MODE
 			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, delim), log_t::flag_t::CRITICAL, "Data for preparing received corrupted");
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		/**
 		* Если режим отладки не включён
 		*/
 		#else
 			// Выводим сообщение об ошибке
-			this->_log->print("%s", log_t::flag_t::CRITICAL, "Data for preparing received corrupted");
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		#endif
 	}
 }
 /**
- * @brief Метод очистки данных
- *
- */
-void anyks::CSV::clear() noexcept {
-	// Выполняем очистку собранных данных
-	this->_mapping.clear();
-}
-/**
- * @brief Метод установки флага использования заголовков
- *
- * @param mode флаг использования заголовков
- */
-void anyks::CSV::header(const bool mode) noexcept {
-	// Устанавливаем флаг использования заголовков
-	this->_header = mode;
-}
-/**
- * @brief Метод выполнения парсинга текста
+ * @brief Метод выполнения параллельного парсинга текста
  *
- * @param text текст для парсинга
+ * @param text    текст для парсинга
+ * @param delim   используемый разделитель ('0' - определяется автоматически)
+ * @param threads количество потоков парсинга
  */
-void anyks::CSV::parse(const string & text) noexcept {
+void anyks::CSV::parse(const string_view text, const char delim, const size_t threads) noexcept {
 	// Если текст передан
-	if(!text.empty())
-		// Выполняем парсинг переданной строки
-		this->parse(text, '0');
+	if(!text.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем количество участков (участок не меньше минимального размера)
+			const size_t count = std::min(std::max(threads, static_cast <size_t> (1)), (text.size() / CSV_CHUNK_SIZE) + 1);
+			// Если разбивать текст на участки не требуется
+			if(count < 2)
+				// Выполняем парсинг текста в текущем потоке
+				this->parse(text, delim);
+			// Если текст разбирается параллельно
+			else {
+				// Выполняем разбиение текста на участки по переносам строк
+				const auto chunks = this->chunks(text, count);
+				// Контейнеры для результатов парсинга участков
+				vector <std::unique_ptr <CSV>> results;
+				// Переходим по всем участкам текста
+				for(size_t i = 0; i < chunks.size(); i++){
+					// Создаём контейнер для результатов парсинга участка
+					results.push_back(std::unique_ptr <CSV> (new CSV(this->_fmk, this->_log)));
+					// Устанавливаем режим хранения ячеек текущего контейнера
+					results.back()->storage(this->_storage);
+				}
+				// Выполняем параллельный парсинг всех участков и проверку их границ
+				this->settle(chunks, 0, this->spread(chunks, 0, results, delim), results, delim);
+				// Переходим по всем результатам в исходном порядке участков
+				for(auto & csv : results)
+					// Выполняем перенос строк участка
+					this->append(* csv);
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text.size(), delim, threads), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
 	// Выводим сообщение об ошибке
-	else {
+	} else {
 		/**
 		 * Если включён режим отладки
 		 */
 		#if DEBUG_MODE
 			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim, threads), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		/**
 		* Если режим отладки не включён
 		*/
@@ -345,52 +1431,62 @@ void anyks::CSV::parse(const string & text) noexcept {
 	}
 }
 /**
- * @brief Метод выполнения парсинга текста
+ * @brief Метод выполнения параллельного парсинга текста без сохранения результата
  *
- * @param text  текст для парсинга
- * @param delim используемый разделитель
+ * @param text     текст для парсинга
+ * @param callback функция обратного вызова для каждой строки (вызывается в исходном порядке строк)
+ * @param delim    используемый разделитель ('0' - определяется автоматически)
+ * @param threads  количество потоков парсинга
  */
-void anyks::CSV::parse(const string & text, const char delim) noexcept {
-	// Если текст передан
-	if(!text.empty()){
+void anyks::CSV::parse(const string_view text, function <void (const vector <string> &)> callback, const char delim, const size_t threads) noexcept {
+	// Если текст и функция обратного вызова переданы
+	if(!text.empty() && (callback != nullptr)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Значение текущей и предыдущей буквы
-			char letter = 0, old = 0;
-			// Смещение в буфере и длина полученной строки
-			size_t offset = 0, length = 0;
-			// Получаем размер файла
-			const uintmax_t size = text.size();
-			// Переходим по всему буферу
-			for(uintmax_t i = 0; i < size; i++){
-				// Получаем значение текущей буквы
-				letter = text.at(i);
-				// Если текущая буква является переносом строк
-				if((i > 0) && ((letter == '\n') || (i == (size - 1)))){
-					// Если предыдущая буква была возвратом каретки, уменьшаем длину строки
-					length = ((old == '\r' ? i - 1 : i) - offset);
-					// Если это конец файла, корректируем размер последнего байта
-					if(length == 0)
-						// Выполняем кооректировку размера
-						length = 1;
-					// Если мы получили последний символ и он не является переносом строки
-					if((i == (size - 1)) && (letter != '\n'))
-						// Выполняем компенсацию размера строки
-						length++;
-					// Если длина слова получена, выводим полученную строку
-					this->prepare(text.data() + offset, length, delim);
-					// Выполняем смещение
-					offset = (i + 1);
+			// Получаем количество участков минимального размера
+			const size_t count = ((text.size() / CSV_CHUNK_SIZE) + 1);
+			// Если разбивать текст на участки не требуется
+			if((threads < 2) || (count < 2))
+				// Выполняем парсинг текста в текущем потоке
+				this->parse(text, callback, delim);
+			// Если текст разбирается параллельно
+			else {
+				// Выполняем разбиение текста на участки по переносам строк
+				const auto chunks = this->chunks(text, count);
+				// Контейнеры для результатов парсинга участков (по одному на поток)
+				vector <std::unique_ptr <CSV>> results;
+				// Создаём контейнеры для каждого потока
+				for(size_t i = 0; i < std::min(threads, chunks.size()); i++)
+					// Создаём контейнер для результатов парсинга участка
+					results.push_back(std::unique_ptr <CSV> (new CSV(this->_fmk, this->_log)));
+				/**
+				 * Участки разбираются проходами по количеству потоков, поэтому
+				 * в памяти одновременно находятся строки не более чем одного прохода
+				 */
+				for(size_t start = 0; start < chunks.size();){
+					// Выполняем параллельный парсинг участков текущего прохода
+					const size_t parsed = this->spread(chunks, start, results, delim);
+					// Если участки не разобраны
+					if(parsed == 0)
+						// Выходим из цикла
+						break;
+					// Выполняем проверку границ участков (участки, начатые внутри кавычек, дочитываются последовательно)
+					const size_t settled = this->settle(chunks, start, parsed, results, delim);
+					// Переходим по всем результатам в исходном порядке участков
+					for(size_t i = 0; i < parsed; i++){
+						// Переходим по всем строкам участка
+						for(auto & row : results[i]->get())
+							// Выводим полученную строку
+							callback(row);
+						// Выполняем очистку результатов участка
+						results[i]->clear();
+					}
+					// Смещаем индекс первого участка следующего прохода
+					start += settled;
 				}
-				// Запоминаем предыдущую букву
-				old = letter;
 			}
-			// Если данные не все прочитаны, выводим как есть
-			if((offset == 0) && (size > 0))
-				// Выводим полученную строку
-				this->prepare(text.data(), size, delim);
 		/**
 		 * Если возникает ошибка
 		 */
@@ -400,7 +1496,7 @@ void anyks::CSV::parse(const string & text, const char delim) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, delim), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text.size(), delim, threads), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -416,7 +1512,7 @@ void anyks::CSV::parse(const string & text, const char delim) noexcept {
 		 */
 		#if DEBUG_MODE
 			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, delim), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), delim, threads), log_t::flag_t::CRITICAL, "Data for parsing received corrupted");
 		/**
 		* Если режим отладки не включён
 		*/
@@ -426,18 +1522,60 @@ void anyks::CSV::parse(const string & text, const char delim) noexcept {
 		#endif
 	}
 }
+/**
+ * @brief Метод установки функции обратного вызова для строк потокового парсинга
+ *
+ * @param callback функция обратного вызова (если не установлена, строки сохраняются в контейнер)
+ */
+void anyks::CSV::on(function <void (const vector <string> &)> callback) noexcept {
+	// Устанавливаем функцию обратного вызова
+	this->_callback = callback;
+}
+/**
+ * @brief Метод потокового парсинга очередного блока данных
+ *
+ * @param buffer буфер данных блока
+ * @param size   размер буфера данных блока
+ * @param delim  используемый разделитель ('0' - определяется автоматически для каждой строки)
+ */
+void anyks::CSV::feed(const char * buffer, const size_t size, const char delim) noexcept {
+	// Если данные переданы
+	if((buffer != nullptr) && (size > 0))
+		// Выполняем разбор блока по маскам с сохранением состояния для следующего блока
+		this->tokenize(buffer, size, delim, this->_state, this->_callback);
+}
+/**
+ * @brief Метод завершения потокового парсинга и вывода последней строки
+ *
+ */
+void anyks::CSV::finish() noexcept {
+	// Если поток завершился внутри незакрытых кавычек
+	if(this->_state.quote && !this->_state.escape){
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::WARNING, "Data ended inside a quoted value");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::WARNING, "Data ended inside a quoted value");
+		#endif
+	}
+	// Выводим последнюю строку (завершающий возврат каретки отбрасывается)
+	this->emit(this->_state, this->_state.cell.data(), this->_state.cell.size(), this->_callback);
+}
 /**
  * @brief Метод получения количества столбцов
  *
  * @return количество столбцов
  */
 size_t anyks::CSV::cols() const noexcept {
-	// Если карта данных заполнена
-	if(!this->_mapping.empty())
-		// Выводим количество столбцов
-		return this->_mapping.front().size();
-	// Сообщаем, что количество столбцов не определено
-	return 0;
+	// Выводим количество столбцов первой строки (если данных нет, количество столбцов не определено)
+	return this->cells(0);
 }
 /**
  * @brief Метод получения количества строк
@@ -445,9 +1583,56 @@ size_t anyks::CSV::cols() const noexcept {
  * @return количество строк
  */
 size_t anyks::CSV::rows() const noexcept {
+	// Если ячейки хранятся в едином буфере
+	if(this->_storage == storage_t::ARENA)
+		// Выводим количество строк по границам строк
+		return (this->_rows.empty() ? 0 : this->_rows.size() - 1);
 	// Выводим количество строк
 	return this->_mapping.size();
 }
+/**
+ * @brief Метод получения количества ячеек строки
+ *
+ * @param row индекс строки
+ * @return    количество ячеек строки
+ */
+size_t anyks::CSV::cells(const size_t row) const noexcept {
+	// Если ячейки хранятся в едином буфере
+	if(this->_storage == storage_t::ARENA){
+		// Если строка существует
+		if((row + 1) < this->_rows.size())
+			// Выводим количество ячеек строки
+			return (this->_rows[row + 1] - this->_rows[row]);
+	// Если строка существует
+	} else if(row < this->_mapping.size())
+		// Выводим количество ячеек строки
+		return this->_mapping[row].size();
+	// Сообщаем, что строка не найдена
+	return 0;
+}
+/**
+ * @brief Метод получения значения ячейки без копирования
+ *
+ * @param row индекс строки
+ * @param col индекс столбца
+ * @return    значение ячейки (действительно до изменения контейнера)
+ */
+string_view anyks::CSV::cell(const size_t row, const size_t col) const noexcept {
+	// Если ячейка существует
+	if(col < this->cells(row)){
+		// Если ячейки хранятся в едином буфере
+		if(this->_storage == storage_t::ARENA){
+			// Получаем номер ячейки в буфере
+			const size_t index = (this->_rows[row] + col);
+			// Выводим значение ячейки
+			return string_view(this->_arena.data() + this->_offsets[index], this->_offsets[index + 1] - this->_offsets[index]);
+		}
+		// Выводим значение ячейки
+		return this->_mapping[row][col];
+	}
+	// Сообщаем, что ячейка не найдена
+	return string_view();
+}
 /**
  * @brief Метод получения строки
  *
@@ -459,73 +1644,17 @@ string anyks::CSV::row(const size_t index, const char delim) noexcept {
 	// Результат работы функции
 	string result = "";
 	// Если переданный индекс меньше количества записей
-	if(index < this->_mapping.size()){
-		/**
-		 * Выполняем отлов ошибок
-		 */
-		try {
-			// Символ для сравнения
-			char letter = 0;
-			// Флаг проверки на требование экранирования
-			bool shielding = false;
-			// Выполняем перебор всех столбцов
-			for(auto & item : this->_mapping.at(index)){
-				// Получаем значение столбца
-				string col = item;
-				// Выполняем сброс флага экранирования
-				shielding = false;
-				// Выполняем перебор всех символов столбца
-				for(size_t i = 0; i < col.size(); i++){
-					// Получаем символ для проверки
-					letter = col.at(i);
-					// Если флаг ещё не установлен
-					if(!shielding)
-						// Если найдены символы требующие экранирования
-						shielding = (
-							(letter == ';') || (letter == ',') || (letter == '|') || ::isspace(letter) ||
-							(letter == 32) || (letter == ' ') || (letter == '\t') || (letter == '\n') ||
-							(letter == '\r') || (letter == '\f') || (letter == '\v')
-						);
-					// Если найдена кавычка
-					if(letter == '"'){
-						// Добавляем ещё одну кавычку
-						col.insert(col.begin() + i, 1, '"');
-						// увеличиваем значение индекса
-						i++;
-					}
-				}
-				// Если результат уже собран
-				if(!result.empty())
-					// Выполняем добавление разделителя
-					result.append(1, delim);
-				// Если требуется экранирование
-				if(shielding)
-					// Добавляем экранирование
-					result.append(1, '"');
-				// Добавляем запись
-				result.append(col);
-				// Если требуется экранирование
-				if(shielding)
-					// Добавляем экранирование
-					result.append(1, '"');
-			}
-		/**
-		 * Если возникает ошибка
-		 */
-		} catch(const exception & error) {
-			/**
-			 * Если включён режим отладки
-			 */
-			#if DEBUG_MODE
-				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(index, delim), log_t::flag_t::CRITICAL, error.what());
-			/**
-			* Если режим отладки не включён
-			*/
-			#else
-				// Выводим сообщение об ошибке
-				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
-			#endif
+	if(index < this->rows()){
+		// Получаем количество ячеек строки
+		const size_t count = this->cells(index);
+		// Переходим по всем ячейкам строки
+		for(size_t i = 0; i < count; i++){
+			// Если столбец не первый (пустые столбцы тоже отделяются разделителем)
+			if(i > 0)
+				// Выполняем добавление разделителя
+				result.append(1, delim);
+			// Добавляем значение столбца
+			this->column(this->cell(index, i), result);
 		}
 	// Выводим сообщение об ошибке
 	} else {
@@ -546,6 +1675,54 @@ string anyks::CSV::row(const size_t index, const char delim) noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод формирования строки из списка столбцов
+ *
+ * @param cols  список столбцов строки
+ * @param delim используемый разделитель
+ * @return      сформированная строка
+ */
+string anyks::CSV::row(const vector <string> & cols, const char delim) const noexcept {
+	// Результат работы функции
+	string result = "";
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Флаг вывода первого столбца
+		bool first = true;
+		// Выполняем перебор всех столбцов
+		for(auto & col : cols){
+			// Если столбец не первый (пустые столбцы тоже отделяются разделителем)
+			if(!first)
+				// Выполняем добавление разделителя
+				result.append(1, delim);
+			// Снимаем флаг вывода первого столбца
+			first = false;
+			// Добавляем значение столбца
+			this->column(col, result);
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(delim), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод записи данных в файл
  *
@@ -665,11 +1842,14 @@ void anyks::CSV::read(const string & filename) noexcept {
 void anyks::CSV::read(const string & filename, const char delim) noexcept {
 	// Если файл для чтения передан
 	if(!filename.empty()){
-		// Выполняем чтение файла
-		this->_fs.readFile3(filename, [delim, this](const string & text) noexcept -> void {
-			// Выводим полученную строку
-			this->prepare(text.data(), text.size(), delim);
-		});
+		// Запоминаем установленную функцию обратного вызова
+		auto callback = std::move(this->_callback);
+		// Снимаем функцию обратного вызова для сохранения строк в контейнер
+		this->_callback = nullptr;
+		// Выполняем потоковое чтение файла
+		this->stream(filename, delim);
+		// Восстанавливаем функцию обратного вызова
+		this->_callback = std::move(callback);
 	// Выводим сообщение об ошибке
 	} else {
 		/**
@@ -697,13 +1877,17 @@ void anyks::CSV::read(const string & filename, const char delim) noexcept {
 void anyks::CSV::read(const string & filename, function <void (const vector <string> &)> callback, const char delim) noexcept {
 	// Если файл для чтения передан
 	if(!filename.empty()){
-		// Выполняем чтение файла
-		this->_fs.readFile3(filename, [delim, callback, this](const string & text) noexcept -> void {
-			// Если функция обратного вызова передана
-			if(callback != nullptr)
-				// Выводим полученную строку
-				this->prepare(text.data(), text.size(), callback, delim);
-		});
+		// Если функция обратного вызова передана
+		if(callback != nullptr){
+			// Запоминаем установленную функцию обратного вызова
+			auto active = std::move(this->_callback);
+			// Устанавливаем функцию обратного вызова для строк файла
+			this->_callback = std::move(callback);
+			// Выполняем потоковое чтение файла
+			this->stream(filename, delim);
+			// Восстанавливаем функцию обратного вызова
+			this->_callback = std::move(active);
+		}
 	// Выводим сообщение об ошибке
 	} else {
 		/**
@@ -721,6 +1905,77 @@ void anyks::CSV::read(const string & filename, function <void (const vector <str
 		#endif
 	}
 }
+/**
+ * @brief Метод параллельного чтения данных из файла
+ *
+ * @param filename адрес файла контейнера CSV для чтения
+ * @param delim    используемый разделитель ('0' - определяется автоматически)
+ * @param threads  количество потоков парсинга
+ */
+void anyks::CSV::read(const string & filename, const char delim, const size_t threads) noexcept {
+	// Если файл для чтения передан
+	if(!filename.empty()){
+		// Создаём объект отображения файла в память
+		mmap_t mapping(this->_fmk, this->_log);
+		// Если файл отображён в память
+		if(mapping.open(filename) && !mapping.empty())
+			// Выполняем параллельный парсинг данных файла
+			this->parse(mapping.view(), delim, threads);
+		// Если файл не удалось отобразить в память, читаем его последовательно
+		else this->read(filename, delim);
+	// Выводим сообщение об ошибке
+	} else {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(filename, delim, threads), log_t::flag_t::CRITICAL, "File address for reading was not set");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "File address for reading was not set");
+		#endif
+	}
+}
+/**
+ * @brief Метод параллельного чтения данных из файла
+ *
+ * @param filename адрес файла контейнера CSV для чтения
+ * @param callback функция обратного вызова для каждой строки (вызывается в исходном порядке строк)
+ * @param delim    используемый разделитель ('0' - определяется автоматически)
+ * @param threads  количество потоков парсинга
+ */
+void anyks::CSV::read(const string & filename, function <void (const vector <string> &)> callback, const char delim, const size_t threads) noexcept {
+	// Если файл для чтения передан
+	if(!filename.empty()){
+		// Создаём объект отображения файла в память
+		mmap_t mapping(this->_fmk, this->_log);
+		// Если файл отображён в память
+		if(mapping.open(filename) && !mapping.empty())
+			// Выполняем параллельный парсинг данных файла
+			this->parse(mapping.view(), callback, delim, threads);
+		// Если файл не удалось отобразить в память, читаем его последовательно
+		else this->read(filename, callback, delim);
+	// Выводим сообщение об ошибке
+	} else {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(filename, delim, threads), log_t::flag_t::CRITICAL, "File address for reading was not set");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "File address for reading was not set");
+		#endif
+	}
+}
 /**
  * @brief Метод создания дампа данных
  *
@@ -729,146 +1984,80 @@ void anyks::CSV::read(const string & filename, function <void (const vector <str
 anyks::json anyks::CSV::dump() const noexcept {
 	// Результат работы функции
 	json result;
+	// Получаем количество собранных строк
+	const size_t rows = this->rows();
 	// Если данные реально собранны
-	if(!this->_mapping.empty()){
+	if(rows > 0){
 		/**
 		 * Выполняем перехват ошибок
 		 */
 		try {
+			// Буфер для проверки значений ячеек
+			string buffer = "";
+			// Получаем аллокатор значений JSON
+			auto & allocator = result.GetAllocator();
 			// Если нужно сформировать заголовки
 			if(this->_header){
-				// Текущее значение индекса
-				size_t index = 0;
 				// Устанавливаем тип JSON как объект
 				result.SetObject();
+				// Получаем количество ключей
+				const size_t cols = this->cols();
 				// Переходим по всему списку ключей
-				for(auto & key : this->_mapping.front()){
-					// Создаём объект массива
-					result.AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(kArrayType).Move(), result.GetAllocator());
-					// Переходим по всем остальным ключам
-					for(size_t i = 1; i < this->_mapping.size(); i++){
+				for(size_t index = 0; index < cols; index++){
+					// Получаем название ключа
+					const string_view key = this->cell(0, index);
+					// Определяем тип столбца по первым записям
+					const type_t type = this->infer(index, 1);
+					// Создаём массив значений столбца
+					Value column(kArrayType);
+					// Выделяем память для всех записей столбца
+					column.Reserve(static_cast <SizeType> (rows - 1), allocator);
+					// Переходим по всем остальным строкам
+					for(size_t i = 1; i < rows; i++){
 						// Если индекс соответствует номеру записи
-						if(index < this->_mapping.at(i).size()){
-							// Получаем запись для проверки
-							const string item = this->_mapping.at(i).at(index);
-							// Выполняем приведение строки к нижнему регистру
-							this->_fmk->transform(item, fmk_t::transform_t::LOWER);
-							// Если запись является числом
-							if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
-								/**
-								 * Выполняем отлов ошибок
-								 */
-								try {
-									// Если число положительное
-									if(item.front() != '-')
-										// Добавляем полученное значение в массив
-										result[key.c_str()].PushBack(Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
-									// Добавляем полученное значение в массив
-									else result[key.c_str()].PushBack(Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Добавляем полученное значение в массив
-									result[key.c_str()].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-								}
-							// Если запись является числом с плавающей точкой
-							} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
-								/**
-								 * Выполняем отлов ошибок
-								 */
-								try {
-									// Добавляем полученное значение в массив
-									result[key.c_str()].PushBack(Value(::stod(item)).Move(), result.GetAllocator());
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Добавляем полученное значение в массив
-									result[key.c_str()].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-								}
-							// Если число является булевым истинным значением
-							} else if(this->_fmk->compare("true", item))
-								// Добавляем полученное значение в массив
-								result[key.c_str()].PushBack(Value(true).Move(), result.GetAllocator());
-							// Если число является булевым ложным значением
-							else if(this->_fmk->compare("false", item))
-								// Добавляем полученное значение в массив
-								result[key.c_str()].PushBack(Value(false).Move(), result.GetAllocator());
+						if(index < this->cells(i)){
+							// Значение записи
+							Value item;
+							// Выполняем преобразование записи
+							this->value(this->cell(i, index), type, item, buffer, allocator);
 							// Добавляем полученное значение в массив
-							else {
-								// Получаем строку для добавления в массив
-								const string & item = this->_mapping.at(i).at(index);
-								// Добавляем полученное значение в массив
-								result[key.c_str()].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-							}
+							column.PushBack(item, allocator);
 						}
 					}
-					// Выполняем смещение индекса
-					index++;
+					// Добавляем собранный столбец в объект
+					result.AddMember(Value(key.data(), key.length(), allocator).Move(), column.Move(), allocator);
 				}
 			// Если формировать заголовок не требуется
 			} else {
+				// Типы столбцов
+				vector <type_t> types;
 				// Устанавливаем тип JSON как массив
 				result.SetArray();
+				// Выделяем память для всех строк
+				result.Reserve(static_cast <SizeType> (rows), allocator);
 				// Выполняем перебор всего списка собранной карты
-				for(size_t i = 0; i < this->_mapping.size(); i++){
-					// Выполняем добавление нового массива
-					result.PushBack(Value(kArrayType).Move(), result.GetAllocator());
-					// Выполняем перебор всего списка строк
-					for(auto j = 0; j < this->_mapping.at(i).size(); j++){
-						// Получаем строку значения
-						const string & item = this->_mapping.at(i).at(j);
-						// Если запись является числом
-						if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
-							/**
-							 * Выполняем отлов ошибок
-							 */
-							try {
-								// Если число положительное
-								if(item.front() != '-')
-									// Добавляем полученное значение в массив
-									result[i].PushBack(Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
-								// Добавляем полученное значение в массив
-								else result[i].PushBack(Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
-							/**
-							 * Если возникает ошибка
-							 */
-							} catch(const exception &) {
-								// Добавляем полученное значение в массив
-								result[i].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-							}
-						// Если запись является числом с плавающей точкой
-						} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
-							/**
-							 * Выполняем отлов ошибок
-							 */
-							try {
-								// Добавляем полученное значение в массив
-								result[i].PushBack(Value(static_cast <uint64_t> (::stod(item))).Move(), result.GetAllocator());
-							/**
-							 * Если возникает ошибка
-							 */
-							} catch(const exception &) {
-								// Добавляем полученное значение в массив
-								result[i].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-							}
-						// Если число является булевым истинным значением
-						} else if(this->_fmk->compare("true", item))
-							// Добавляем полученное значение в массив
-							result[i].PushBack(Value(true).Move(), result.GetAllocator());
-						// Если число является булевым ложным значением
-						else if(this->_fmk->compare("false", item))
-							// Добавляем полученное значение в массив
-							result[i].PushBack(Value(false).Move(), result.GetAllocator());
+				for(size_t i = 0; i < rows; i++){
+					// Получаем количество ячеек строки
+					const size_t count = this->cells(i);
+					// Создаём массив значений строки
+					Value row(kArrayType);
+					// Выделяем память для всех ячеек строки
+					row.Reserve(static_cast <SizeType> (count), allocator);
+					// Выполняем перебор всего списка ячеек
+					for(size_t j = 0; j < count; j++){
+						// Если тип столбца ещё не определён
+						if(j >= types.size())
+							// Определяем тип столбца по записям начиная с текущей строки
+							types.push_back(this->infer(j, i));
+						// Значение записи
+						Value item;
+						// Выполняем преобразование записи
+						this->value(this->cell(i, j), types[j], item, buffer, allocator);
 						// Добавляем полученное значение в массив
-						else {
-							// Получаем строку для добавления в массив
-							const string & item = this->_mapping.at(i).at(j);
-							// Добавляем полученное значение в массив
-							result[i].PushBack(Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-						}
+						row.PushBack(item, allocator);
 					}
+					// Добавляем собранную строку в массив
+					result.PushBack(row, allocator);
 				}
 			}
 		/**
@@ -905,76 +2094,84 @@ void anyks::CSV::dump(const json & dump) noexcept {
 	try {
 		// Если дамп данных передан и является объектом
 		if((this->_header = (dump.IsObject() && !dump.ObjectEmpty()))){
-			// Выполняем очистку схему соответствий ключей расширения
-			this->_mapping.clear();
+			// Выполняем очистку собранных данных
+			this->clear();
+			// Схема соответствий ключей расширения
+			vector <vector <string>> mapping;
 			// Выполняем добавляем новый список ключей
-			this->_mapping.push_back(vector <string> ());
+			mapping.push_back(vector <string> ());
 			// Выполняем перебор переданного дампа данных
 			for(auto & m : dump.GetObj()){
 				// Если данные получены верные
 				if(m.value.IsArray()){
 					// Добавляем заголовочные записи
-					this->_mapping.front().push_back(m.name.GetString());
+					mapping.front().push_back(m.name.GetString());
 					// Переходим по всем элементам массива
 					for(size_t i = 0; i < m.value.Size(); i++){
 						// Если индекс нулевой
-						if((i + 1) == this->_mapping.size())
+						if((i + 1) == mapping.size())
 							// Выполняем добавляем новый список ключей
-							this->_mapping.push_back(vector <string> ());
+							mapping.push_back(vector <string> ());
 						// Получаем значение записи
 						const auto & item = m.value[i];
 						// Если запись является строкой
 						if(item.IsString())
 							// Выполняем добавление всех записей
-							this->_mapping.at(i + 1).push_back(item.GetString());
+							mapping.at(i + 1).push_back(item.GetString());
 						// Если запись является числом отрицательным
 						else if(item.IsInt64())
 							// Добавляем полученное значение
-							this->_mapping.at(i + 1).push_back(std::to_string(item.GetInt64()));
+							mapping.at(i + 1).push_back(std::to_string(item.GetInt64()));
 						// Если запись является числом положительным
 						else if(item.IsUint64())
 							// Добавляем полученное значение
-							this->_mapping.at(i + 1).push_back(std::to_string(item.GetUint64()));
+							mapping.at(i + 1).push_back(std::to_string(item.GetUint64()));
 						// Если запись является числом с плавающей точкой
 						else if(item.IsNumber())
 							// Добавляем полученное значение
-							this->_mapping.at(i + 1).push_back(this->_fmk->noexp(item.GetDouble(), true));
+							mapping.at(i + 1).push_back(this->_fmk->noexp(item.GetDouble(), true));
 						// Если запись является булевым значением
 						else if(item.IsBool())
 							// Выполняем добавление всех записей
-							this->_mapping.at(i + 1).push_back(item.GetBool() ? "true" : "false");
+							mapping.at(i + 1).push_back(item.GetBool() ? "true" : "false");
 					}
 				}
 			}
+			// Переходим по всем собранным строкам
+			for(auto & row : mapping)
+				// Добавляем строку в хранилище ячеек
+				this->push(row);
 		// Если дамп данных передан и является массивом
 		} else if(dump.IsArray() && !dump.Empty()) {
 			// Выполняем перебор всего списка массива
 			for(auto & v : dump.GetArray()){
-				// Выполняем добавляем новый список ключей
-				this->_mapping.push_back(vector <string> ());
+				// Список ячеек строки
+				vector <string> row;
 				// Выполняем перебор всего списка дочерних элементов
 				for(auto & item : v.GetArray()){
 					// Если запись является строкой
 					if(item.IsString())
 						// Выполняем добавление всех записей
-						this->_mapping.back().push_back(item.GetString());
+						row.push_back(item.GetString());
 					// Если запись является числом отрицательным
 					else if(item.IsInt64())
 						// Добавляем полученное значение
-						this->_mapping.back().push_back(std::to_string(item.GetInt64()));
+						row.push_back(std::to_string(item.GetInt64()));
 					// Если запись является числом положительным
 					else if(item.IsUint64())
 						// Добавляем полученное значение
-						this->_mapping.back().push_back(std::to_string(item.GetUint64()));
+						row.push_back(std::to_string(item.GetUint64()));
 					// Если запись является числом
 					else if(item.IsNumber())
 						// Добавляем полученное значение
-						this->_mapping.back().push_back(this->_fmk->noexp(item.GetDouble(), true));
+						row.push_back(this->_fmk->noexp(item.GetDouble(), true));
 					// Если запись является булевым значением
 					else if(item.IsBool())
 						// Выполняем добавление всех записей
-						this->_mapping.back().push_back(item.GetBool() ? "true" : "false");
+						row.push_back(item.GetBool() ? "true" : "false");
 				}
+				// Добавляем строку в хранилище ячеек
+				this->push(row);
 			}
 		}
 	/**
@@ -1002,8 +2199,56 @@ void anyks::CSV::dump(const json & dump) noexcept {
  * @return собранные данные контейнера
  */
 const vector <vector <string>> & anyks::CSV::get() const noexcept {
-	// Выводим собранные данные контейнера
-	return this->_mapping;
+	// Если ячейки хранятся отдельными строками
+	if(this->_storage == storage_t::STRINGS)
+		// Выводим собранные данные контейнера
+		return this->_mapping;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем количество собранных строк
+		const size_t rows = this->rows();
+		// Если копия ячеек ещё не собрана
+		if(this->_cache.size() != rows){
+			// Выполняем очистку копии ячеек
+			this->_cache.clear();
+			// Выделяем память для всех строк
+			this->_cache.reserve(rows);
+			// Переходим по всем собранным строкам
+			for(size_t i = 0; i < rows; i++){
+				// Получаем количество ячеек строки
+				const size_t count = this->cells(i);
+				// Добавляем новую строку
+				this->_cache.emplace_back();
+				// Выделяем память для ячеек строки
+				this->_cache.back().reserve(count);
+				// Переходим по всем ячейкам строки
+				for(size_t j = 0; j < count; j++)
+					// Добавляем копию ячейки
+					this->_cache.back().emplace_back(this->cell(i, j));
+			}
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим копию собранных данных контейнера
+	return this->_cache;
 }
 /**
  * @brief Оператор вывода данные контейнера в качестве строки
@@ -1031,8 +2276,18 @@ anyks::CSV::operator string() const noexcept {
 anyks::CSV & anyks::CSV::operator = (const CSV & csv) noexcept {
 	// Выполняем копирование флага работы с заголовками
 	this->_header = csv._header;
+	// Выполняем копирование режима хранения ячеек
+	this->_storage = csv._storage;
 	// Выполняем копирвоание полученных параметров
 	this->_mapping = csv._mapping;
+	// Выполняем копирование буфера ячеек
+	this->_arena = csv._arena;
+	// Выполняем копирование смещений ячеек
+	this->_offsets = csv._offsets;
+	// Выполняем копирование границ строк
+	this->_rows = csv._rows;
+	// Выполняем очистку копии ячеек
+	this->_cache.clear();
 	// Выводим текущий объект
 	return (* this);
 }
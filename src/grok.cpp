@@ -50,222 +50,630 @@ static bool isEscaped(const string & text, size_t pos) noexcept {
  *
  */
 void anyks::Grok::Variables::reset() noexcept {
+	// Выполняем удаление названий переменных
+	this->_names.clear();
+	// Выполняем удаление типов переменных
+	this->_types.clear();
+	// Выполняем удаление первых групп захвата переменных
+	this->_fields.clear();
+	// Выполняем удаление подшаблонов переменных
+	this->_labels.clear();
+	// Выполняем очистку названий переменных
+	vector <string> ().swap(this->_names);
+	// Выполняем очистку типов переменных
+	vector <type_t> ().swap(this->_types);
+	// Выполняем очистку первых групп захвата переменных
+	vector <uint32_t> ().swap(this->_fields);
+	// Выполняем очистку подшаблонов переменных
+	vector <string> ().swap(this->_labels);
+}
+/**
+ * @brief Метод получения количество добавленных переменных
+ *
+ * @return количество добавленных переменных
+ */
+uint8_t anyks::Grok::Variables::count() const noexcept {
+	// Выводим количество переменных
+	return static_cast <uint8_t> (this->_names.size());
+}
+/**
+ * @brief Метод извлечения названия переменной по номеру группы захвата
+ *
+ * @param group номер группы захвата регулярного выражения
+ * @return      название переменной или пустая строка для безымянной группы
+ */
+const string & anyks::Grok::Variables::get(const uint32_t group) const noexcept {
+	// Пустое название переменной
+	static const string empty = "";
+	// Если группа захвата сопоставлена с переменной
+	if(static_cast <size_t> (group) < this->_names.size())
+		// Выводим название переменной
+		return this->_names[group];
+	// Выводим пустое значение
+	return empty;
+}
+/**
+ * @brief Метод извлечения типа переменной по номеру группы захвата
+ *
+ * @param group номер группы захвата регулярного выражения
+ * @return      тип переменной
+ */
+anyks::Grok::type_t anyks::Grok::Variables::type(const uint32_t group) const noexcept {
+	// Если для группы захвата указан тип переменной
+	if(static_cast <size_t> (group) < this->_types.size())
+		// Выводим тип переменной
+		return this->_types[group];
+	// Выводим строковый тип
+	return type_t::STRING;
+}
+/**
+ * @brief Метод извлечения первой группы захвата с тем же названием переменной
+ *
+ * @param group номер группы захвата регулярного выражения
+ * @return      номер первой группы захвата переменной
+ */
+uint32_t anyks::Grok::Variables::field(const uint32_t group) const noexcept {
+	// Если для группы захвата известна первая группа переменной
+	if(static_cast <size_t> (group) < this->_fields.size())
+		// Выводим номер первой группы захвата
+		return this->_fields[group];
+	// Выводим номер самой группы
+	return group;
+}
+/**
+ * @brief Метод извлечения подшаблона по номеру группы захвата
+ *
+ * @param group номер группы захвата регулярного выражения
+ * @return      подшаблон или пустая строка, если он неизвестен
+ */
+const string & anyks::Grok::Variables::label(const uint32_t group) const noexcept {
+	// Пустой подшаблон
+	static const string empty = "";
+	// Если для группы захвата известен подшаблон
+	if(static_cast <size_t> (group) < this->_labels.size())
+		// Выводим подшаблон
+		return this->_labels[group];
+	// Выводим пустое значение
+	return empty;
+}
+/**
+ * @brief Метод построения списка первых групп захвата для повторяющихся переменных
+ *
+ */
+void anyks::Grok::Variables::index() noexcept {
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Выполняем блокировку потока
-		const lock_guard <std::mutex> lock(this->_mtx);
-		// Если список регулярных выражений шаблонов создан
-		if(!this->_patterns.empty()){
-			// Выполняем перебор всех шаблонов
-			for(auto & item : this->_patterns)
-				// Выполняем удаление скомпилированного регулярного выражения
-				::pcre2_regfree(&item.second);
+		// Выделяем первые группы захвата для всех групп
+		this->_fields.resize(this->_names.size());
+		// Переходим по всем группам захвата
+		for(uint32_t i = 0; i < static_cast <uint32_t> (this->_names.size()); i++){
+			// По умолчанию группа является первой для своей переменной
+			this->_fields[i] = i;
+			// Если группа захвата сопоставлена с переменной
+			if(!this->_names[i].empty()){
+				// Выполняем поиск предыдущей группы с тем же названием
+				for(uint32_t j = 1; j < i; j++){
+					// Если предыдущая группа имеет то же название
+					if(this->_names[j].compare(this->_names[i]) == 0){
+						// Запоминаем первую группу переменной
+						this->_fields[i] = j;
+						// Выходим из цикла
+						break;
+					}
+				}
+			}
 		}
-		// Выполняем удаление названий переменных
-		this->_names.clear();
-		// Выполняем очистку шаблонов переменных
-		this->_patterns.clear();
-		// Выполняем очистку названий переменных
-		vector <string> ().swap(this->_names);
-		// Выполняем освобождение памяти списка шаблонов переменных
-		std::unordered_multimap <string, regex_t> ().swap(this->_patterns);
 	/**
 	 * Если возникает ошибка
 	 */
 	} catch(const exception & error) {
 		// Выводим сообщение об ошибке
-		::fprintf(stderr, "\"Grok:Variables:reset\": %s\n\n", error.what());
+		::fprintf(stderr, "\"Grok:Variables:index\": %s\n\n", error.what());
 	}
 }
 /**
- * @brief Метод получения количество добавленных переменных
- *
- * @return количество добавленных переменных
- */
-uint8_t anyks::Grok::Variables::count() const noexcept {
-	// Выводим количество переменных
-	return static_cast <uint8_t> (this->_names.size());
-}
-/**
- * @brief Метод извлечения названия переменной которой соответствует текст
+ * @brief Метод сопоставления переменных с группами захвата скомпилированного регулярного выражения
  *
- * @param text  для получения переменной передан
- * @param index индекс запрашиваемой переменной
- * @return      название переменной, которой соответствует текст
+ * @param reg  скомпилированное регулярное выражение
+ * @param vars список переменных в порядке следования групп захвата
  */
-string anyks::Grok::Variables::get(const string & text, const uint8_t index) noexcept {
-	// Если текст для получения переменной передан
-	if(!text.empty() && (index < static_cast <uint8_t> (this->_names.size()))){
+void anyks::Grok::Variables::push(const pcre2_code * reg, const vector <var_t> & vars) noexcept {
+	// Если регулярное выражение передано
+	if(reg != nullptr){
 		/**
-		 * Выполняем обработку ошибки
+		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Получаем название переменной
-			const string & name = this->_names.at(static_cast <size_t> (index));
-			// Получаем список подходящих нам переменных
-			auto ret = this->_patterns.equal_range(name);
-			// Переходим по всему списку регулярных выражений
-			for(auto i = ret.first; i != ret.second; ++i){
-				// Получаем строку текста для поиска
-				const char * str = text.c_str();
-				// Создаём объект матчинга
-				regmatch_t match[i->second.re_nsub + 1];
-				// Выполняем разбор регулярного выражения
-				if(::pcre2_regexec(&i->second, str, i->second.re_nsub + 1, match, REG_NOTEMPTY) == 0){
-					// Название полученной переменной
-					string value = "";
-					// Выполняем перебор всех полученных вариантов
-					for(uint8_t j = 0; j < static_cast <uint8_t> (i->second.re_nsub + 1); j++){
-						// Если результат получен
-						if(match[j].rm_eo > match[j].rm_so){
-							// Формируем полученный результат
-							value.assign(str + match[j].rm_so, match[j].rm_eo - match[j].rm_so);
-							// Если значение переменной получено
-							if(!value.empty())
-								// Выводим название переменной
-								return name;
-						}
-					}
+			// Количество групп захвата и количество именованных групп
+			uint32_t groups = 0, count = 0, size = 0;
+			// Таблица именованных групп
+			PCRE2_SPTR table = nullptr;
+			// Получаем количество групп захвата
+			::pcre2_pattern_info(reg, PCRE2_INFO_CAPTURECOUNT, &groups);
+			// Получаем количество именованных групп
+			::pcre2_pattern_info(reg, PCRE2_INFO_NAMECOUNT, &count);
+			// Получаем размер записи таблицы именованных групп
+			::pcre2_pattern_info(reg, PCRE2_INFO_NAMEENTRYSIZE, &size);
+			// Получаем таблицу именованных групп
+			::pcre2_pattern_info(reg, PCRE2_INFO_NAMETABLE, &table);
+			// Выделяем названия для всех групп захвата (нулевая группа соответствует всему совпадению)
+			this->_names.assign(static_cast <size_t> (groups) + 1, "");
+			// Все группы захвата по умолчанию являются строками
+			this->_types.assign(static_cast <size_t> (groups) + 1, type_t::STRING);
+			// Выделяем подшаблоны для всех групп захвата
+			this->_labels.assign(static_cast <size_t> (groups) + 1, "");
+			// Список групп, которые не являются переменными Grok
+			vector <bool> foreign(static_cast <size_t> (groups) + 1, false);
+			// Выполняем перебор таблицы именованных групп
+			for(uint32_t i = 0; (table != nullptr) && (i < count); i++){
+				// Получаем номер группы (первые два байта записи в порядке big-endian)
+				const uint32_t group = ((static_cast <uint32_t> (table[i * size]) << 8) | table[(i * size) + 1]);
+				// Если номер группы корректный
+				if(group <= groups){
+					// Помечаем группу, как группу из исходного шаблона
+					foreign[group] = true;
+					// Подшаблоном группы является её название в исходном шаблоне
+					this->_labels[group] = ("(?<" + string(reinterpret_cast <const char *> (table + (i * size) + 2)) + ">)");
 				}
 			}
+			// Номер текущей группы захвата
+			uint32_t group = 1;
+			// Переменные идут в порядке открывающих скобок, поэтому назначаем их безымянным группам по порядку
+			for(auto & var : vars){
+				// Пропускаем именованные группы исходного шаблона
+				while((group <= groups) && foreign[group])
+					// Переходим к следующей группе
+					group++;
+				// Если группы захвата закончились
+				if(group > groups)
+					// Выходим из цикла
+					break;
+				// Устанавливаем тип переменной для группы
+				this->_types[group] = var.type;
+				// Устанавливаем подшаблон переменной для группы
+				this->_labels[group] = var.label;
+				// Устанавливаем название переменной для группы
+				this->_names[group++] = var.name;
+			}
+			// Выполняем построение списка первых групп захвата переменных
+			this->index();
 		/**
 		 * Если возникает ошибка
 		 */
 		} catch(const exception & error) {
-			// Формируем полученную ошибку
-			string message = error.what();
-			// Добавляем описание
-			message.append(". Input text [");
-			// Добавляем переданный текст
-			message.append(text);
-			// Добавляем завершение строки
-			message.append(1, ']');
 			// Выводим сообщение об ошибке
-			::fprintf(stderr, "\"Grok:Variables:get\": %s\n\n", message.c_str());
+			::fprintf(stderr, "\"Grok:Variables:push\": %s\n\n", error.what());
 		}
 	}
+}
+/**
+ * @brief Метод вытеснения записей, не помещающихся в кэш
+ *
+ */
+void anyks::Grok::Shared::shrink() noexcept {
+	// Пока количество записей превышает допустимое
+	while(this->_items.size() > this->_stat.capacity){
+		// Удаляем запись из индекса
+		this->_index.erase(this->_items.back().first);
+		// Удаляем давно не используемую запись
+		this->_items.pop_back();
+		// Увеличиваем количество вытесненных записей
+		this->_stat.evictions++;
+	}
+}
+/**
+ * @brief Метод получения счётчиков кэша
+ *
+ * @return счётчики кэша
+ */
+anyks::Grok::stat_t anyks::Grok::Shared::stat() noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::mutex> lock(this->_mtx);
+	// Получаем счётчики кэша
+	stat_t result = this->_stat;
+	// Устанавливаем количество записей в кэше
+	result.size = this->_items.size();
 	// Выводим результат
-	return "";
+	return result;
+}
+/**
+ * @brief Метод установки максимального количества записей кэша
+ *
+ * @param capacity максимальное количество записей (0 отключает кэш)
+ * @param log      объект для работы с логами
+ */
+void anyks::Grok::Shared::capacity(const size_t capacity, const log_t * log) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Выполняем блокировку потока
+		const lock_guard <std::mutex> lock(this->_mtx);
+		// Устанавливаем максимальное количество записей кэша
+		this->_stat.capacity = capacity;
+		// Выполняем вытеснение лишних записей
+		this->shrink();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(capacity), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод получения записи кэша
+ *
+ * @param key ключ записи кэша
+ * @return    собранное регулярное выражение или nullptr
+ */
+std::shared_ptr <const anyks::Grok::cache_t> anyks::Grok::Shared::get(const uint64_t key) noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::mutex> lock(this->_mtx);
+	// Выполняем поиск записи в индексе
+	auto i = this->_index.find(key);
+	// Если запись найдена
+	if(i != this->_index.end()){
+		// Увеличиваем количество попаданий
+		this->_stat.hits++;
+		// Перемещаем запись в начало списка без выделения памяти
+		this->_items.splice(this->_items.begin(), this->_items, i->second);
+		// Выводим собранное регулярное выражение
+		return i->second->second;
+	}
+	// Увеличиваем количество промахов
+	this->_stat.misses++;
+	// Выводим пустое значение
+	return nullptr;
 }
 /**
- * @brief Метод добавления переменной
+ * @brief Метод добавления записи в кэш
  *
- * @param name    название переменной
- * @param pattern шаблон регулярного выражения переменной
+ * @param key  ключ записи кэша
+ * @param item собранное регулярное выражение
+ * @param log  объект для работы с логами
  */
-void anyks::Grok::Variables::push(const string & name, const string & pattern) noexcept {
-	// Если название переменной и шаблон регулярного выражения переданы
-	if(!name.empty() && !pattern.empty()){
+void anyks::Grok::Shared::set(const uint64_t key, const std::shared_ptr <const cache_t> & item, const log_t * log) noexcept {
+	// Если запись передана
+	if(item != nullptr){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
-			// Добавляем название переменной
-			this->_names.push_back(name);
-			// Добавляем шаблон регулярного выражения
-			auto ret = this->_patterns.emplace(name, regex_t());
-			// Выполняем компиляцию регулярного выражения
-			const int error = ::pcre2_regcomp(&ret->second, pattern.c_str(), REG_UTF | REG_ICASE);
-			// Если возникла ошибка компиляции
-			if(error != 0){
-				// Создаём буфер данных для извлечения данных ошибки
-				char buffer[256];
-				// Выполняем заполнение нулями буфер данных
-				::memset(buffer, '\0', sizeof(buffer));
-				// Выполняем извлечение текста ошибки
-				const size_t size = ::pcre2_regerror(error, &ret->second, buffer, sizeof(buffer) - 1);
-				// Если текст ошибки получен
-				if(size > 0){
-					// Формируем полученную ошибку
-					string error(buffer, size);
-					// Добавляем описание
-					error.append(". Input name [");
-					// Добавляем переданный название переменной
-					error.append(name);
-					// Добавляем завершение строки
-					error.append(1, ']');
-					// Добавляем разделитель
-					error.append(1, ' ');
-					// Добавляем название шаблона
-					error.append("pattern [");
-					// Добавляем переданный название шаблона
-					error.append(pattern);
-					// Добавляем завершение строки
-					error.append(1, ']');
-					// Выводим сообщение об ошибке
-					::fprintf(stderr, "\"Grok:Variables:push\": %s\n\n", error.c_str());
-				}
-				// Выполняем очистку шаблона
-				this->_patterns.erase(name);
+			// Если кэш отключён
+			if(this->_stat.capacity == 0)
+				// Выходим из функции
+				return;
+			// Выполняем поиск записи в индексе
+			auto i = this->_index.find(key);
+			// Если запись уже добавлена другим потоком
+			if(i != this->_index.end()){
+				// Обновляем собранное регулярное выражение
+				i->second->second = item;
+				// Перемещаем запись в начало списка
+				this->_items.splice(this->_items.begin(), this->_items, i->second);
+			// Если запись добавляется впервые
+			} else {
+				// Добавляем запись в начало списка
+				this->_items.emplace_front(key, item);
+				// Добавляем запись в индекс
+				this->_index.emplace(key, this->_items.begin());
+				// Выполняем вытеснение лишних записей
+				this->shrink();
 			}
 		/**
 		 * Если возникает ошибка
 		 */
 		} catch(const exception & error) {
-			// Формируем полученную ошибку
-			string message = error.what();
-			// Добавляем описание
-			message.append(". Input name [");
-			// Добавляем переданный название переменной
-			message.append(name);
-			// Добавляем завершение строки
-			message.append(1, ']');
-			// Добавляем разделитель
-			message.append(1, ' ');
-			// Добавляем название шаблона
-			message.append("pattern [");
-			// Добавляем переданный название шаблона
-			message.append(pattern);
-			// Добавляем завершение строки
-			message.append(1, ']');
-			// Выводим сообщение об ошибке
-			::fprintf(stderr, "\"Grok:Variables:push\": %s\n\n", message.c_str());
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
 		}
 	}
 }
 /**
- * @brief деструктор
+ * @brief Метод очистки результата (выделенная память сохраняется для следующего сопоставления)
+ *
+ */
+void anyks::Grok::Mapping::clear() noexcept {
+	// Сбрасываем разобранный текст
+	this->_text = string_view();
+	// Выполняем удаление захваченных переменных
+	this->_captures.clear();
+}
+/**
+ * @brief Метод проверки на пустоту результата
+ *
+ * @return результат проверки
+ */
+bool anyks::Grok::Mapping::empty() const noexcept {
+	// Выводим результат проверки
+	return this->_captures.empty();
+}
+/**
+ * @brief Метод получения количества захваченных переменных
+ *
+ * @return количество захваченных переменных
+ */
+size_t anyks::Grok::Mapping::size() const noexcept {
+	// Выводим количество захваченных переменных
+	return this->_captures.size();
+}
+/**
+ * @brief Метод получения списка захваченных переменных
+ *
+ * @return список захваченных переменных
+ */
+const vector <anyks::Grok::capture_t> & anyks::Grok::Mapping::captures() const noexcept {
+	// Выводим список захваченных переменных
+	return this->_captures;
+}
+/**
+ * @brief Метод получения названия захваченной переменной
+ *
+ * @param capture захваченная переменная
+ * @return        название переменной
+ */
+string_view anyks::Grok::Mapping::name(const capture_t & capture) const noexcept {
+	// Если регулярное выражение установлено
+	if(this->_cache != nullptr){
+		// Получаем название переменной по номеру группы захвата
+		const string & name = this->_cache->vars.get(capture.group);
+		// Выводим название переменной
+		return string_view(name.data(), name.size());
+	}
+	// Выводим пустое значение
+	return string_view();
+}
+/**
+ * @brief Метод получения текста захваченной переменной
+ *
+ * @param capture захваченная переменная
+ * @return        текст значения переменной в разобранном тексте
+ */
+string_view anyks::Grok::Mapping::value(const capture_t & capture) const noexcept {
+	// Если значение находится в пределах разобранного текста
+	if((capture.offset + capture.size) <= this->_text.size())
+		// Выводим текст значения
+		return this->_text.substr(capture.offset, capture.size);
+	// Выводим пустое значение
+	return string_view();
+}
+/**
+ * @brief Метод однократного добавления базовых шаблонов перед первым использованием
  *
  */
-anyks::Grok::Variables::~Variables() noexcept {
+void anyks::Grok::ready() const noexcept {
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Если список регулярных выражений шаблонов создан
-		if(!this->_patterns.empty()){
-			// Выполняем перебор всех шаблонов
-			for(auto & item : this->_patterns)
-				// Выполняем удаление скомпилированного регулярного выражения
-				::pcre2_regfree(&item.second);
-		}
+		// Выполняем добавление базовых шаблонов, если они ещё не добавлены и не загружены из пакета
+		std::call_once(const_cast <grok_t *> (this)->_once, &grok_t::init, const_cast <grok_t *> (this));
 	/**
 	 * Если возникает ошибка
 	 */
 	} catch(const exception & error) {
-		// Выводим сообщение об ошибке
-		::fprintf(stderr, "\"Grok:Variables:~\": %s\n\n", error.what());
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
 	}
 }
 /**
- * @brief Метод очистки параметров модуля
+ * @brief Метод компиляции регулярного выражения с JIT-оптимизацией
  *
+ * @param pattern регулярное выражение для компиляции
+ * @param error   текст ошибки компиляции
+ * @return        скомпилированное регулярное выражение или nullptr
  */
-void anyks::Grok::clear() noexcept {
+pcre2_code * anyks::Grok::compile(const string & pattern, string & error) noexcept {
+	// Код ошибки компиляции
+	int code = 0;
+	// Позиция ошибки в регулярном выражении
+	PCRE2_SIZE offset = 0;
+	// Выполняем компиляцию регулярного выражения
+	pcre2_code * result = ::pcre2_compile(reinterpret_cast <PCRE2_SPTR> (pattern.data()), pattern.size(), PCRE2_UTF | PCRE2_CASELESS, &code, &offset, nullptr);
+	// Если регулярное выражение скомпилировано
+	if(result != nullptr)
+		// Выполняем JIT-компиляцию (если JIT недоступен, сопоставление выполняется интерпретатором)
+		::pcre2_jit_compile(result, PCRE2_JIT_COMPLETE);
+	// Если возникла ошибка компиляции
+	else {
+		// Создаём буфер данных для извлечения данных ошибки
+		PCRE2_UCHAR buffer[256];
+		// Выполняем извлечение текста ошибки
+		const int size = ::pcre2_get_error_message(code, buffer, sizeof(buffer));
+		// Если текст ошибки получен
+		if(size > 0)
+			// Формируем полученную ошибку
+			error.assign(reinterpret_cast <const char *> (buffer), static_cast <size_t> (size));
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения блока результатов сопоставления текущего потока
+ *
+ * @param groups количество групп захвата регулярного выражения
+ * @return       блок результатов сопоставления
+ */
+pcre2_match_data * anyks::Grok::match(const uint32_t groups) noexcept {
+	// Блок результатов сопоставления создаётся один раз для каждого потока
+	static thread_local match_t block;
+	// Если размера блока недостаточно для всех групп захвата
+	if((block.data == nullptr) || (block.size < (groups + 1))){
+		// Если блок результатов уже создан
+		if(block.data != nullptr)
+			// Выполняем удаление блока результатов
+			::pcre2_match_data_free(block.data);
+		// Выполняем создание нового блока результатов
+		block.data = ::pcre2_match_data_create(groups + 1, nullptr);
+		// Запоминаем размер блока результатов
+		block.size = (block.data != nullptr ? (groups + 1) : 0);
+	}
+	// Выводим результат
+	return block.data;
+}
+/**
+ * @brief Метод получения стека JIT текущего потока
+ *
+ * @param data размер стека JIT в байтах
+ * @return     стек JIT текущего потока
+ */
+pcre2_jit_stack * anyks::Grok::stack(void * data) noexcept {
+	// Стек JIT создаётся один раз для каждого потока
+	static thread_local stack_t block;
+	// Получаем запрошенный размер стека JIT
+	const size_t size = (data != nullptr ? (* reinterpret_cast <const size_t *> (data)) : 0);
+	// Если размер стека недостаточен
+	if((size > 0) && ((block.stack == nullptr) || (block.size < size))){
+		// Если стек JIT уже создан
+		if(block.stack != nullptr)
+			// Выполняем удаление стека JIT
+			::pcre2_jit_stack_free(block.stack);
+		// Выполняем создание нового стека JIT
+		block.stack = ::pcre2_jit_stack_create(std::min(size, static_cast <size_t> (0x8000)), size, nullptr);
+		// Запоминаем размер стека JIT
+		block.size = (block.stack != nullptr ? size : 0);
+	}
+	// Выводим результат (при отсутствии стека JIT использует стек потока размером 32 Кб)
+	return block.stack;
+}
+/**
+ * @brief Метод проверки превышения ограничений выполнения регулярного выражения
+ *
+ * @param code код результата сопоставления PCRE2
+ * @return     результат проверки
+ */
+bool anyks::Grok::exceeded(const int32_t code) noexcept {
+	/**
+	 * Определяем код результата сопоставления
+	 */
+	switch(code){
+		// Если превышено количество шагов сопоставления
+		case PCRE2_ERROR_MATCHLIMIT:
+		// Если превышена глубина возвратов
+		case PCRE2_ERROR_DEPTHLIMIT:
+		// Если превышен размер памяти возвратов
+		case PCRE2_ERROR_HEAPLIMIT:
+		// Если превышен размер стека JIT
+		case PCRE2_ERROR_JIT_STACKLIMIT: return true;
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод обратного вызова PCRE2 при профилировании выражения
+ *
+ * @param block параметры обратного вызова
+ * @param data  состояние профилирования
+ * @return      результат продолжения сопоставления (0 - продолжить)
+ */
+int32_t anyks::Grok::callout(pcre2_callout_block * block, void * data) noexcept {
+	// Получаем состояние профилирования
+	probe_t * probe = reinterpret_cast <probe_t *> (data);
+	// Если параметры обратного вызова переданы
+	if((block != nullptr) && (probe != nullptr) && (probe->items != nullptr)){
+		// Получаем текущее время
+		const auto now = std::chrono::steady_clock::now();
+		// Получаем позицию текущего элемента выражения
+		const size_t position = std::min(static_cast <size_t> (block->pattern_position), probe->owners.size() - 1);
+		// Если предыдущий элемент выражения известен
+		if(probe->position != string::npos){
+			// Получаем время выполнения предыдущего элемента
+			const uint64_t elapsed = static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::nanoseconds> (now - probe->last).count());
+			// Время элемента учитывается во всех подшаблонах, которые его содержат
+			for(uint32_t group = probe->owners[probe->position]; group > 0; group = probe->parents[group])
+				// Увеличиваем время выполнения подшаблона
+				probe->items->at(group).time += elapsed;
+		}
+		// Получаем подшаблон, содержащий текущий элемент
+		const uint32_t owner = probe->owners[position];
+		// Если текущий элемент открывает подшаблон
+		if((owner > 0) && (probe->opens[owner] == position))
+			// Увеличиваем количество входов в подшаблон
+			probe->items->at(owner).calls++;
+		// Если перед текущим элементом произошёл возврат
+		if((block->callout_flags & PCRE2_CALLOUT_BACKTRACK) != 0){
+			// Возврат учитывается во всех подшаблонах, которые содержат элемент
+			for(uint32_t group = owner; group > 0; group = probe->parents[group])
+				// Увеличиваем количество возвратов подшаблона
+				probe->items->at(group).backtracks++;
+			// Увеличиваем количество возвратов всего выражения
+			probe->items->at(0).backtracks++;
+		}
+		// Запоминаем позицию текущего элемента
+		probe->position = position;
+		// Запоминаем время текущего элемента (время обратного вызова не учитывается)
+		probe->last = std::chrono::steady_clock::now();
+	}
+	// Продолжаем сопоставление
+	return 0;
+}
+/**
+ * @brief Метод получения общего для процесса кэша собранных регулярных выражений
+ *
+ * @return общий кэш собранных регулярных выражений
+ */
+anyks::Grok::shared_t & anyks::Grok::shared() noexcept {
+	// Общий кэш создаётся один раз для всего процесса
+	static shared_t cache;
+	// Выводим результат
+	return cache;
+}
+/**
+ * @brief Метод получения отпечатка внешних шаблонов
+ *
+ * @return отпечаток внешних шаблонов
+ */
+uint64_t anyks::Grok::fingerprint() const noexcept {
+	// Результат работы функции
+	uint64_t result = 0;
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Выполняем удаление кэша
-		this->_cache.clear();
-		// Выполняем очистку внешних шаблонов
-		this->clearPatterns();
-		// Выполняем полную очистку памяти кэша
-		std::map <uint64_t, std::unique_ptr <cache_t>> ().swap(this->_cache);
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(const_cast <grok_t *> (this)->_mtx.patterns);
+		// Переходим по всем внешним шаблонам (отпечаток не зависит от порядка обхода)
+		for(auto & item : this->_patternsExternal)
+			// Добавляем отпечаток названия и значения шаблона
+			result += (::CityHash64(item.first.c_str(), item.first.size()) ^ (::CityHash64(item.second.c_str(), item.second.size()) * 0x9E3779B97F4A7C15ULL));
 	/**
 	 * Если возникает ошибка
 	 */
@@ -284,28 +692,61 @@ void anyks::Grok::clear() noexcept {
 			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
 		#endif
 	}
+	// Выводим результат
+	return result;
 }
 /**
- * @brief Метод сброса собранных данных
+ * @brief Метод получения ключа записи общего кэша
  *
  * @param cid идентификатор записи в кэше
+ * @return    ключ записи общего кэша (выражение и внешние шаблоны)
  */
-void anyks::Grok::reset(const uint64_t cid) noexcept {
+uint64_t anyks::Grok::key(const uint64_t cid) const noexcept {
+	// Получаем отпечаток внешних шаблонов, от которых зависит сборка выражения
+	const uint64_t stamp = this->fingerprint();
+	// Если внешние шаблоны не установлены
+	if(stamp == 0)
+		// Ключом является идентификатор записи
+		return cid;
+	// Буфер идентификатора записи и отпечатка шаблонов
+	uint64_t buffer[2] = {cid, stamp};
+	// Выводим ключ записи общего кэша
+	return ::CityHash64(reinterpret_cast <const char *> (buffer), sizeof(buffer));
+}
+/**
+ * @brief Метод добавления собранного регулярного выражения в снимок кэша (вызывается под блокировкой сборки)
+ *
+ * @param cid  идентификатор записи в кэше
+ * @param item собранное регулярное выражение
+ */
+void anyks::Grok::admit(const uint64_t cid, const std::shared_ptr <const cache_t> & item) const noexcept {
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Выполняем блокировку потока
-		const lock_guard <std::mutex> lock(this->_mtx.mapping);
-		// Выполняем поиск указанного идентификатора в кэше
-		auto i = this->_cache.find(cid);
-		// Если в кэше найден идентификатор
-		if(i != this->_cache.end()){
-			// Очищаем схему соответствий ключей
-			i->second->mapping.clear();
-			// Выполняем очистку памяти ключей соответствий
-			std::unordered_map <string, string> ().swap(i->second->mapping);
+		// Получаем текущий снимок кэша
+		std::shared_ptr <const caches_t> cache = std::atomic_load(&this->_cache);
+		// Если запись уже добавлена
+		if(cache->count(cid) > 0)
+			// Выходим из функции
+			return;
+		// Получаем порядок добавления записей кэша
+		std::list <uint64_t> & order = const_cast <grok_t *> (this)->_order;
+		// Создаём копию снимка кэша (размер снимка ограничен, поэтому копирование не растёт с количеством собранных выражений)
+		auto snapshot = std::make_shared <caches_t> (* cache);
+		// Пока в снимке нет места для новой записи
+		while(!order.empty() && (snapshot->size() >= GROK_FRONT_SIZE)){
+			// Удаляем самую старую запись (она остаётся в общем кэше и у читающих потоков)
+			snapshot->erase(order.front());
+			// Удаляем идентификатор из порядка добавления
+			order.pop_front();
 		}
+		// Добавляем собранное регулярное выражение в копию
+		snapshot->emplace(cid, item);
+		// Запоминаем порядок добавления записи
+		order.push_back(cid);
+		// Публикуем новый снимок кэша для читающих потоков
+		std::atomic_store(&const_cast <grok_t *> (this)->_cache, std::shared_ptr <const caches_t> (::move(snapshot)));
 	/**
 	 * Если возникает ошибка
 	 */
@@ -326,50 +767,279 @@ void anyks::Grok::reset(const uint64_t cid) noexcept {
 	}
 }
 /**
- * @brief Метод очистки списка добавленных шаблонов
+ * @brief Метод получения собранного регулярного выражения по идентификатору
  *
+ * @param cid идентификатор записи в кэше
+ * @return    собранное регулярное выражение или nullptr
  */
-void anyks::Grok::clearPatterns() noexcept {
-	// Если список ключей существует
-	if(!this->_patternsExternal.empty()){
+std::shared_ptr <const anyks::Grok::cache_t> anyks::Grok::lookup(const uint64_t cid) const noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем текущий снимок кэша без блокировки
+		const std::shared_ptr <const caches_t> cache = std::atomic_load(&this->_cache);
+		// Выполняем поиск идентификатора регулярного выражения в снимке
+		auto i = cache->find(cid);
+		// Если регулярное выражение найдено в снимке
+		if(i != cache->end())
+			// Выводим собранное регулярное выражение
+			return i->second;
+		// Выполняем поиск вытесненного из снимка выражения в общем кэше
+		std::shared_ptr <const cache_t> result = Grok::shared().get(this->key(cid));
+		// Если выражение найдено в общем кэше
+		if(result != nullptr){
+			// Выполняем блокировку сборки регулярных выражений
+			const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.build);
+			// Возвращаем выражение в снимок кэша
+			this->admit(cid, result);
+		}
+		// Выводим результат
+		return result;
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
 		/**
-		 * Выполняем отлов ошибок
+		 * Если включён режим отладки
 		 */
-		try {
-			// Выполняем блокировку потока
-			const lock_guard <std::mutex> lock(this->_mtx.patterns);
-			// Очищаем список именованных групп
-			this->_nameGroups.clear();
-			// Очищаем список внешних шаблонов
-			this->_patternsExternal.clear();
-			// Выполняем освобождение памяти именованных групп
-			std::map <uint64_t, string> ().swap(this->_nameGroups);
-			// Выполняем освобождение памяти списка внешних шаблонов
-			std::unordered_map <string, string> ().swap(this->_patternsExternal);
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(cid), log_t::flag_t::CRITICAL, error.what());
 		/**
-		 * Если возникает ошибка
-		 */
-		} catch(const exception & error) {
-			/**
-			 * Если включён режим отладки
-			 */
-			#if DEBUG_MODE
-				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
-			/**
-			* Если режим отладки не включён
-			*/
-			#else
-				// Выводим сообщение об ошибке
-				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
-			#endif
-		}
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
 	}
+	// Выводим пустое значение
+	return nullptr;
 }
 /**
- * @brief Метод удаления добавленного шаблона
+ * @brief Метод определения типа переменной по его названию
  *
- * @param name название шаблона для удаления
+ * @param name название типа (int, float, bool, ts)
+ * @return     тип переменной
+ */
+anyks::Grok::type_t anyks::Grok::type(const string & name) noexcept {
+	// Название типа в нижнем регистре
+	string type = name;
+	// Переходим по всем символам названия
+	for(auto & letter : type)
+		// Приводим символ к нижнему регистру
+		letter = static_cast <char> (::tolower(static_cast <uint8_t> (letter)));
+	// Если тип является целым числом
+	if((type.compare("int") == 0) || (type.compare("integer") == 0) || (type.compare("long") == 0))
+		// Выводим тип переменной
+		return type_t::INT;
+	// Если тип является числом с плавающей точкой
+	else if((type.compare("float") == 0) || (type.compare("double") == 0))
+		// Выводим тип переменной
+		return type_t::FLOAT;
+	// Если тип является логическим значением
+	else if((type.compare("bool") == 0) || (type.compare("boolean") == 0))
+		// Выводим тип переменной
+		return type_t::BOOL;
+	// Если тип является меткой времени
+	else if((type.compare("ts") == 0) || (type.compare("timestamp") == 0))
+		// Выводим тип переменной
+		return type_t::TS;
+	// Неизвестные типы остаются строками
+	return type_t::STRING;
+}
+/**
+ * @brief Метод конвертации захваченного значения в тип переменной
+ *
+ * @param value   захваченное значение
+ * @param type    тип переменной
+ * @param capture значение захваченной переменной
+ */
+void anyks::Grok::convert(const string_view value, const type_t type, capture_t & capture) noexcept {
+	// Значение остаётся строкой, пока не будет сконвертировано
+	capture.type = type_t::STRING;
+	// Если значение требует конвертации
+	if(!value.empty() && (type != type_t::STRING)){
+		// Получаем начало и конец значения
+		const char * begin = value.data(), * end = (value.data() + value.size());
+		/**
+		 * Определяем тип переменной
+		 */
+		switch(static_cast <uint8_t> (type)){
+			// Если переменная является целым числом или меткой времени
+			case static_cast <uint8_t> (type_t::INT):
+			case static_cast <uint8_t> (type_t::TS):
+			// Если переменная является числом с плавающей точкой
+			case static_cast <uint8_t> (type_t::FLOAT): {
+				// Знак плюса from_chars не принимает, пропускаем его
+				if((* begin == '+') && ((begin + 1) < end) && (begin[1] != '-'))
+					// Смещаем начало значения
+					begin++;
+				// Если ожидается целое число или метка времени
+				if(type != type_t::FLOAT){
+					// Выполняем конвертацию целого числа
+					const auto result = std::from_chars(begin, end, capture.integer);
+					// Если число сконвертировано полностью
+					if((result.ec == std::errc()) && (result.ptr == end)){
+						// Устанавливаем тип значения
+						capture.type = type_t::INT;
+						// Выходим из функции
+						return;
+					}
+					// Целое число с дробной частью не округляется и остаётся строкой
+					if(type == type_t::INT)
+						// Выходим из функции
+						return;
+				}
+				// Буфер значения с завершающим нулём для strtod (from_chars для double есть не во всех стандартных библиотеках)
+				char buffer[64];
+				// Получаем длину значения
+				const size_t length = static_cast <size_t> (end - begin);
+				// Если значение длиннее любого числа или не начинается с цифры, точки или знака минуса
+				if((length >= sizeof(buffer)) || ((::isdigit(static_cast <uint8_t> (* begin)) == 0) && (* begin != '.') && (* begin != '-')))
+					// Выходим из функции
+					return;
+				// Переходим по всем символам значения
+				for(size_t i = 0; i < length; i++){
+					// Шестнадцатеричные числа strtod принимает, а from_chars нет, оставляем их строкой
+					if((begin[i] == 'x') || (begin[i] == 'X'))
+						// Выходим из функции
+						return;
+					// Копируем символ значения
+					buffer[i] = begin[i];
+				}
+				// Устанавливаем завершающий ноль
+				buffer[length] = '\0';
+				// Конец сконвертированной части значения
+				char * stop = nullptr;
+				// Выполняем конвертацию числа с плавающей точкой
+				capture.decimal = ::strtod(buffer, &stop);
+				// Если число сконвертировано полностью и является конечным
+				if((stop == (buffer + length)) && std::isfinite(capture.decimal))
+					// Устанавливаем тип значения
+					capture.type = type_t::FLOAT;
+			} break;
+			// Если переменная является логическим значением
+			case static_cast <uint8_t> (type_t::BOOL): {
+				// Значение в нижнем регистре
+				char buffer[6];
+				// Если значение длиннее любого логического литерала
+				if(value.size() > sizeof(buffer))
+					// Выходим из функции
+					return;
+				// Переходим по всем символам значения
+				for(size_t i = 0; i < value.size(); i++)
+					// Приводим символ к нижнему регистру
+					buffer[i] = static_cast <char> (::tolower(static_cast <uint8_t> (value[i])));
+				// Получаем значение в нижнем регистре
+				const string_view letters(buffer, value.size());
+				// Если значение является истиной
+				if((letters == "true") || (letters == "t") || (letters == "yes") || (letters == "y") || (letters == "on") || (letters == "1")){
+					// Устанавливаем логическое значение
+					capture.boolean = true;
+					// Устанавливаем тип значения
+					capture.type = type_t::BOOL;
+				// Если значение является ложью
+				} else if((letters == "false") || (letters == "f") || (letters == "no") || (letters == "n") || (letters == "off") || (letters == "0")) {
+					// Устанавливаем логическое значение
+					capture.boolean = false;
+					// Устанавливаем тип значения
+					capture.type = type_t::BOOL;
+				}
+			} break;
+		}
+	}
+}
+/**
+ * @brief Метод очистки параметров модуля
+ *
+ */
+void anyks::Grok::clear() noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		{
+			// Выполняем блокировку сборки регулярных выражений
+			const lock_guard <std::mutex> lock(this->_mtx.build);
+			// Публикуем пустой список наборов регулярных выражений (потоки, использующие старый снимок, завершат работу с ним)
+			std::atomic_store(&this->_multi, std::shared_ptr <const multis_t> (std::make_shared <const multis_t> ()));
+			// Публикуем пустой кэш собранных регулярных выражений
+			std::atomic_store(&this->_cache, std::shared_ptr <const caches_t> (std::make_shared <const caches_t> ()));
+			// Очищаем порядок добавления записей кэша
+			this->_order.clear();
+		}
+		// Выполняем очистку внешних шаблонов
+		this->clearPatterns();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод очистки списка добавленных шаблонов
+ *
+ */
+void anyks::Grok::clearPatterns() noexcept {
+	// Если список ключей существует
+	if(!this->_patternsExternal.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			{
+				// Выполняем блокировку именованных групп
+				const lock_guard <std::mutex> lock(this->_mtx.cache);
+				// Очищаем список именованных групп
+				this->_nameGroups.clear();
+				// Выполняем освобождение памяти именованных групп
+				std::map <uint64_t, string> ().swap(this->_nameGroups);
+			}
+			// Выполняем блокировку потока
+			const lock_guard <std::recursive_mutex> lock(this->_mtx.patterns);
+			// Очищаем список внешних шаблонов
+			this->_patternsExternal.clear();
+			// Выполняем освобождение памяти списка внешних шаблонов
+			std::unordered_map <string, string> ().swap(this->_patternsExternal);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
+/**
+ * @brief Метод удаления добавленного шаблона
+ *
+ * @param name название шаблона для удаления
  */
 void anyks::Grok::removePattern(const string & name) noexcept {
 	// Если список ключей существует
@@ -379,7 +1049,7 @@ void anyks::Grok::removePattern(const string & name) noexcept {
 		 */
 		try {
 			// Выполняем блокировку потока
-			const lock_guard <std::mutex> lock(this->_mtx.patterns);
+			const lock_guard <std::recursive_mutex> lock(this->_mtx.patterns);
 			// Выполняем поиск указанного шаблона
 			auto i = this->_patternsExternal.find(name);
 			// Если шаблон найден
@@ -548,10 +1218,16 @@ anyks::Grok::let_t anyks::Grok::variable(const string & text) const noexcept {
 								}
 							} break;
 							// Если найден разделитель переменной
-							case ':':
-								// Устанавливаем позицию разделителя
-								result.delim = i;
-							break;
+							case ':': {
+								// Первый разделитель отделяет название шаблона от названия переменной
+								if(result.delim == 0)
+									// Устанавливаем позицию разделителя
+									result.delim = i;
+								// Второй разделитель отделяет название переменной от её типа
+								else if(result.type == 0)
+									// Устанавливаем позицию разделителя типа
+									result.type = i;
+							} break;
 						}
 					} break;
 				}
@@ -789,9 +1465,9 @@ std::pair <ssize_t, ssize_t> anyks::Grok::namedGroup(const string & text, const
  * @param lets разрешить обработку блочных переменных
  * @return     список извлечённых переменных
  */
-vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bool lets) const noexcept {
+vector <anyks::Grok::var_t> anyks::Grok::prepare(string & text, const bool lets) const noexcept {
 	// Результат работы функции
-	vector <std::pair <string, string>> result;
+	vector <var_t> result;
 	// Если текст для обработки передан
 	if(!text.empty()){
 		/**
@@ -806,12 +1482,20 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 			if((lets || (let.delim == 0)) && (let.pos > 0) && (let.size > 0)){
 				// Ключ и значение переменной
 				string key = "", value = "";
+				// Тип значения переменной
+				type_t type = type_t::STRING;
 				// Если разделитель найден
 				if(let.delim > 0){
 					// Выполняем установку ключа
 					key = text.substr(let.pos, let.delim - let.pos);
+					// Если тип переменной указан
+					if(let.type > 0){
+						// Выполняем установку значения переменной
+						value = text.substr(let.delim + 1, let.type - (let.delim + 1));
+						// Выполняем определение типа переменной
+						type = this->type(text.substr(let.type + 1, (let.pos + let.size) - (let.type + 1)));
 					// Выполняем установку значения переменной
-					value = text.substr(let.delim + 1, let.size - ((let.delim + 1) - let.pos));
+					} else value = text.substr(let.delim + 1, let.size - ((let.delim + 1) - let.pos));
 				// Иначе устанавливаем ключ переменной как он есть
 				} else key = text.substr(let.pos, let.size);
 				// Выполняем поиск переменной среди внутренних шаблонов
@@ -824,6 +1508,8 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 					const size_t pos = (let.pos - 2);
 					// Получаем размер текста для модификации
 					const size_t size = (let.size + 3);
+					// Запоминаем подшаблон в исходном виде
+					const string label = text.substr(pos, size);
 					// Выполняем обработку нашего шаблона
 					const auto & vars = this->prepare(pattern, lets);
 					// Создаём суффикс формирования результирующего регулярного выражения
@@ -833,8 +1519,10 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 					const string prefix = (lets ? ((pos > 0) ? (((text.at(pos - 1) != '(') || ::isEscaped(text, pos - 1)) ? "(" : "(?:") : "(") : "");
 					// Выполняем замену
 					text.replace(pos, size, prefix + pattern + suffix);
-					// Выполняем добавления переменной в список результата
-					result.emplace_back(::move(value), ::move(pattern));
+					// Если переменная образует группу захвата, добавляем её в список результата
+					if(!lets || (prefix.compare("(") == 0))
+						// Выполняем добавления переменной в список результата
+						result.emplace_back(::move(value), type, label);
 					// Если мы получили список переменных из обраотанного шаблона
 					if(!vars.empty())
 						// Выполняем добавления полученных шаблонов в результат
@@ -853,6 +1541,8 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 						const size_t pos = (let.pos - 2);
 						// Получаем размер текста для модификации
 						const size_t size = (let.size + 3);
+						// Запоминаем подшаблон в исходном виде
+						const string label = text.substr(pos, size);
 						// Выполняем обработку нашего шаблона
 						const auto & vars = this->prepare(pattern, lets);
 						// Создаём суффикс формирования результирующего регулярного выражения
@@ -861,8 +1551,10 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 						const string prefix = (lets ? ((pos > 0) ? ((text.at(pos - 1) != '(') ? "(" : "(?:") : "(") : "");
 						// Выполняем замену
 						text.replace(pos, size, prefix + pattern + suffix);
-						// Выполняем добавления переменной в список результата
-						result.emplace_back(::move(value), ::move(pattern));
+						// Если переменная образует группу захвата, добавляем её в список результата
+						if(!lets || (prefix.compare("(") == 0))
+							// Выполняем добавления переменной в список результата
+							result.emplace_back(::move(value), type, label);
 						// Если мы получили список переменных из обраотанного шаблона
 						if(!vars.empty())
 							// Выполняем добавления полученных шаблонов в результат
@@ -894,6 +1586,463 @@ vector <std::pair <string, string>> anyks::Grok::prepare(string & text, const bo
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод построения карты групп захвата собранного регулярного выражения
+ *
+ * @param express собранное регулярное выражение
+ * @param groups  количество групп захвата регулярного выражения
+ * @param probe   состояние профилирования для заполнения
+ * @return        результат построения карты
+ */
+bool anyks::Grok::outline(const string & express, const uint32_t groups, probe_t & probe) const noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Количество найденных групп захвата
+		uint32_t count = 0;
+		// Стек открытых групп (незахватывающие группы наследуют группу захвата родителя)
+		vector <uint32_t> stack(1, 0);
+		// Выделяем позиции открывающих скобок групп захвата
+		probe.opens.assign(static_cast <size_t> (groups) + 1, 0);
+		// Выделяем номера родительских групп захвата
+		probe.parents.assign(static_cast <size_t> (groups) + 1, 0);
+		// Выделяем номера групп для каждой позиции выражения (последняя позиция соответствует концу выражения)
+		probe.owners.assign(express.size() + 1, 0);
+		// Переходим по всем символам регулярного выражения
+		for(size_t i = 0; i < express.size(); i++){
+			// Позиция принадлежит текущей открытой группе
+			probe.owners[i] = stack.back();
+			/**
+			 * Определяем текущий символ
+			 */
+			switch(express[i]){
+				// Если найден символ экранирования
+				case '\\': {
+					// Если начинается блок текста \Q...\E
+					if(((i + 1) < express.size()) && (express[i + 1] == 'Q')){
+						// Выполняем поиск конца блока
+						const size_t end = express.find("\\E", i + 2);
+						// Получаем позицию окончания блока
+						const size_t stop = (end != string::npos ? (end + 1) : (express.size() - 1));
+						// Переходим по всем символам блока
+						for(; i < stop; i++)
+							// Символ блока принадлежит текущей группе
+							probe.owners[i + 1] = stack.back();
+					// Пропускаем экранированный символ
+					} else if((i + 1) < express.size())
+						// Символ принадлежит текущей группе
+						probe.owners[++i] = stack.back();
+				} break;
+				// Если найден класс символов
+				case '[': {
+					// Позиция начала класса
+					size_t j = (i + 1);
+					// Пропускаем отрицание класса
+					if((j < express.size()) && (express[j] == '^'))
+						// Переходим к следующему символу
+						j++;
+					// Закрывающая скобка в начале класса является обычным символом
+					if((j < express.size()) && (express[j] == ']'))
+						// Переходим к следующему символу
+						j++;
+					// Выполняем поиск конца класса
+					while((j < express.size()) && (express[j] != ']')){
+						// Если найдено экранирование
+						if(express[j] == '\\')
+							// Пропускаем экранированный символ
+							j += 2;
+						// Если найден POSIX-класс [:name:]
+						else if((express[j] == '[') && ((j + 1) < express.size()) && (express[j + 1] == ':')) {
+							// Выполняем поиск конца POSIX-класса
+							const size_t end = express.find(":]", j + 2);
+							// Пропускаем POSIX-класс
+							j = (end != string::npos ? (end + 2) : express.size());
+						// Переходим к следующему символу
+						} else j++;
+					}
+					// Получаем позицию окончания класса
+					const size_t stop = std::min(j, express.size() - 1);
+					// Переходим по всем символам класса
+					for(; i < stop; i++)
+						// Символ класса принадлежит текущей группе
+						probe.owners[i + 1] = stack.back();
+				} break;
+				// Если найдено начало группы
+				case '(': {
+					// Флаг группы захвата
+					bool capture = true;
+					// Если группа содержит параметры
+					if(((i + 1) < express.size()) && ((express[i + 1] == '?') || (express[i + 1] == '*'))){
+						// Группа захватывает только именованные группы (?<name>, (?P<name> и (?'name'
+						capture = (
+							(express[i + 1] == '?') && ((i + 2) < express.size()) && (
+								(express[i + 2] == '\'') || ((express[i + 2] == 'P') && ((i + 3) < express.size()) && (express[i + 3] == '<')) ||
+								((express[i + 2] == '<') && ((i + 3) < express.size()) && (express[i + 3] != '=') && (express[i + 3] != '!'))
+							)
+						);
+						// Если группа является комментарием (?#...)
+						if((express[i + 1] == '?') && ((i + 2) < express.size()) && (express[i + 2] == '#')){
+							// Выполняем поиск конца комментария
+							const size_t end = express.find(')', i);
+							// Получаем позицию окончания комментария
+							const size_t stop = (end != string::npos ? end : (express.size() - 1));
+							// Переходим по всем символам комментария
+							for(; i < stop; i++)
+								// Символ комментария принадлежит текущей группе
+								probe.owners[i + 1] = stack.back();
+							// Переходим к следующему символу
+							break;
+						}
+					}
+					// Если группа является группой захвата
+					if(capture){
+						// Если групп больше, чем в скомпилированном выражении
+						if(++count > groups)
+							// Выводим результат
+							return false;
+						// Запоминаем позицию открывающей скобки
+						probe.opens[count] = i;
+						// Запоминаем родительскую группу
+						probe.parents[count] = stack.back();
+						// Добавляем группу в стек
+						stack.push_back(count);
+					// Незахватывающая группа принадлежит родительской группе захвата
+					} else stack.push_back(stack.back());
+					// Открывающая скобка принадлежит самой группе
+					probe.owners[i] = stack.back();
+				} break;
+				// Если найден конец группы
+				case ')': {
+					// Если группа открыта
+					if(stack.size() > 1)
+						// Закрываем группу
+						stack.pop_back();
+				} break;
+			}
+		}
+		// Выводим результат (количество групп должно совпадать со скомпилированным выражением)
+		return (count == groups);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(express, groups), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод извлечения литералов, обязательных для совпадения регулярного выражения
+ *
+ * @param express собранное регулярное выражение
+ * @return        список обязательных литералов
+ */
+vector <string> anyks::Grok::literals(const string & express) const noexcept {
+	// Результат работы функции
+	vector <string> result;
+	// Если регулярное выражение передано
+	if(!express.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Глубина вложенности групп
+			size_t depth = 0;
+			// Текущий собираемый литерал
+			string literal = "";
+			/**
+			 * flushFn Функция завершения текущего литерала
+			 */
+			auto flushFn = [&]() noexcept -> void {
+				// Если литерал достаточной длины
+				if(literal.size() >= GROK_LITERAL_SIZE)
+					// Добавляем литерал в результат
+					result.push_back(literal);
+				// Выполняем очистку литерала
+				literal.clear();
+			};
+			/**
+			 * closeFn Функция поиска закрывающего символа
+			 *
+			 * @param pos   позиция начала поиска
+			 * @param close закрывающий символ
+			 * @return      позиция закрывающего символа или конец выражения
+			 */
+			auto closeFn = [&express](const size_t pos, const char close) noexcept -> size_t {
+				// Выполняем поиск закрывающего символа
+				const size_t end = express.find(close, pos);
+				// Выводим позицию закрывающего символа
+				return (end != string::npos ? end : (express.size() - 1));
+			};
+			// Переходим по всем символам регулярного выражения
+			for(size_t i = 0; i < express.size(); i++){
+				// Получаем текущий символ
+				const char letter = express[i];
+				/**
+				 * Определяем текущий символ
+				 */
+				switch(letter){
+					// Если найден символ экранирования
+					case '\\': {
+						// Если экранирование является последним символом
+						if((i + 1) >= express.size()){
+							// Завершаем литерал
+							flushFn();
+							// Выходим из цикла
+							break;
+						}
+						// Получаем экранированный символ
+						const char next = express[++i];
+						// Если экранирован знак пунктуации, это обычный символ
+						if((static_cast <uint8_t> (next) < 0x80) && (::ispunct(next) || (next == ' '))){
+							// Если символ находится вне групп
+							if(depth == 0)
+								// Добавляем символ в литерал
+								literal.append(1, next);
+							// Переходим к следующему символу
+							break;
+						}
+						// Экранированные классы и управляющие последовательности завершают литерал
+						flushFn();
+						/**
+						 * Определяем тип экранированной последовательности
+						 */
+						switch(next){
+							// Блок текста \Q...\E
+							case 'Q': {
+								// Выполняем поиск конца блока
+								const size_t end = express.find("\\E", i + 1);
+								// Пропускаем блок текста
+								i = (end != string::npos ? (end + 1) : express.size());
+							} break;
+							// Шестнадцатеричный код символа
+							case 'x': {
+								// Если код указан в фигурных скобках
+								if(((i + 1) < express.size()) && (express[i + 1] == '{'))
+									// Пропускаем код символа
+									i = closeFn(i + 1, '}');
+								// Пропускаем до двух шестнадцатеричных цифр
+								else {
+									// Переходим по цифрам кода
+									for(uint8_t j = 0; (j < 2) && ((i + 1) < express.size()) && ::isxdigit(express[i + 1]); j++)
+										// Пропускаем цифру
+										i++;
+								}
+							} break;
+							// Свойства символов, обратные ссылки и восьмеричные коды
+							case 'p': case 'P': case 'g': case 'k': case 'o': case 'N': {
+								// Если параметр последовательности передан в скобках
+								if((i + 1) < express.size()){
+									/**
+									 * Определяем тип скобок
+									 */
+									switch(express[i + 1]){
+										// Если параметр в фигурных скобках
+										case '{': i = closeFn(i + 1, '}'); break;
+										// Если параметр в угловых скобках
+										case '<': i = closeFn(i + 1, '>'); break;
+										// Если параметр в одинарных кавычках
+										case '\'': i = closeFn(i + 2, '\''); break;
+									}
+								}
+							} break;
+							// Управляющий символ \cX
+							case 'c': i++; break;
+							// Обратная ссылка или восьмеричный код
+							default: {
+								// Если последовательность начинается с цифры
+								if(::isdigit(next)){
+									// Пропускаем все цифры последовательности
+									while(((i + 1) < express.size()) && ::isdigit(express[i + 1]))
+										// Пропускаем цифру
+										i++;
+								}
+							}
+						}
+					} break;
+					// Если найден класс символов
+					case '[': {
+						// Завершаем литерал
+						flushFn();
+						// Позиция начала класса
+						size_t j = (i + 1);
+						// Пропускаем отрицание класса
+						if((j < express.size()) && (express[j] == '^'))
+							// Переходим к следующему символу
+							j++;
+						// Закрывающая скобка в начале класса является обычным символом
+						if((j < express.size()) && (express[j] == ']'))
+							// Переходим к следующему символу
+							j++;
+						// Выполняем поиск конца класса
+						while((j < express.size()) && (express[j] != ']')){
+							// Если найдено экранирование
+							if(express[j] == '\\')
+								// Пропускаем экранированный символ
+								j += 2;
+							// Если найден POSIX-класс [:name:]
+							else if((express[j] == '[') && ((j + 1) < express.size()) && (express[j + 1] == ':')) {
+								// Выполняем поиск конца POSIX-класса
+								const size_t end = express.find(":]", j + 2);
+								// Пропускаем POSIX-класс
+								j = (end != string::npos ? (end + 2) : express.size());
+							// Переходим к следующему символу
+							} else j++;
+						}
+						// Пропускаем класс символов
+						i = j;
+					} break;
+					// Если найдено начало группы
+					case '(': {
+						// Завершаем литерал
+						flushFn();
+						// Если группа находится на верхнем уровне и задаёт параметры выражения (?flags)
+						if((depth == 0) && ((i + 1) < express.size()) && (express[i + 1] == '?')){
+							// Позиция конца параметров
+							size_t j = (i + 2);
+							// Выполняем поиск конца параметров
+							while((j < express.size()) && (::isalpha(express[j]) || (express[j] == '-') || (express[j] == '^')))
+								// Переходим к следующему символу
+								j++;
+							// Если включается расширенный режим, пробелы в выражении перестают быть литералами
+							if((j < express.size()) && (express[j] == ')') && (express.substr(i + 2, j - (i + 2)).find('x') != string::npos))
+								// Выводим пустой результат
+								return vector <string> ();
+						}
+						// Увеличиваем глубину вложенности
+						depth++;
+					} break;
+					// Если найден конец группы
+					case ')': {
+						// Если глубина вложенности установлена
+						if(depth > 0)
+							// Уменьшаем глубину вложенности
+							depth--;
+						// Завершаем литерал
+						flushFn();
+					} break;
+					// Если найдена альтернатива
+					case '|': {
+						// Альтернатива верхнего уровня не имеет обязательных литералов
+						if(depth == 0)
+							// Выводим пустой результат
+							return vector <string> ();
+					} break;
+					// Если найден необязательный квантификатор
+					case '?':
+					case '*': {
+						// Если литерал собирается
+						if(!literal.empty())
+							// Удаляем необязательный символ
+							literal.pop_back();
+						// Завершаем литерал
+						flushFn();
+					} break;
+					// Если найден квантификатор повтора
+					case '+':
+						// Символ обязателен, но литерал прерывается
+						flushFn();
+					break;
+					// Если найден возможный квантификатор {n,m}
+					case '{': {
+						// Позиция конца квантификатора
+						size_t j = (i + 1);
+						// Минимальное количество повторов
+						size_t min = 0;
+						// Флаг наличия цифр
+						bool digits = false;
+						// Выполняем чтение минимального количества повторов
+						while((j < express.size()) && ::isdigit(express[j])){
+							// Запоминаем наличие цифр
+							digits = true;
+							// Увеличиваем минимальное количество повторов
+							min = ((min * 10) + (express[j++] - '0'));
+						}
+						// Если найден разделитель
+						if(digits && (j < express.size()) && (express[j] == ',')){
+							// Пропускаем разделитель
+							j++;
+							// Пропускаем максимальное количество повторов
+							while((j < express.size()) && ::isdigit(express[j]))
+								// Переходим к следующему символу
+								j++;
+						}
+						// Если квантификатор корректный
+						if(digits && (j < express.size()) && (express[j] == '}')){
+							// Если символ необязательный
+							if((min == 0) && !literal.empty())
+								// Удаляем необязательный символ
+								literal.pop_back();
+							// Завершаем литерал
+							flushFn();
+							// Пропускаем квантификатор
+							i = j;
+						// Фигурная скобка является обычным символом
+						} else if(depth == 0)
+							// Добавляем символ в литерал
+							literal.append(1, letter);
+					} break;
+					// Если найдены метасимволы
+					case '.':
+					case '^':
+					case '$':
+						// Завершаем литерал
+						flushFn();
+					break;
+					// Если найден обычный символ
+					default: {
+						// Если символ находится внутри группы
+						if(depth > 0)
+							// Переходим к следующему символу
+							break;
+						// Символы за пределами ASCII сравниваются с учётом Unicode, поэтому литерал прерывается
+						if(static_cast <uint8_t> (letter) >= 0x80)
+							// Завершаем литерал
+							flushFn();
+						// Добавляем символ в литерал
+						else literal.append(1, letter);
+					}
+				}
+			}
+			// Завершаем последний литерал
+			flushFn();
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(express), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Выводим пустой результат
+			return vector <string> ();
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод добавления списка поддерживаемых шаблонов
  *
@@ -906,6 +2055,8 @@ void anyks::Grok::patterns(const json & patterns) noexcept {
 		 * Выполняем отлов ошибок
 		 */
 		try {
+			// Выполняем добавление базовых шаблонов
+			this->ready();
 			// Объект блоковой переменной
 			let_t let;
 			// Список регулярных выражений в которых содержатся блоковые переменные
@@ -959,9 +2110,12 @@ void anyks::Grok::patterns(const json & patterns) noexcept {
  */
 void anyks::Grok::pattern(const string & key, const string & val) noexcept {
 	// Если параметры шаблона переданы
-	if(!key.empty() && !val.empty())
+	if(!key.empty() && !val.empty()){
+		// Выполняем добавление базовых шаблонов
+		this->ready();
 		// Выполняем добавление нашего шаблона
 		this->pattern(key, val, event_t::EXTERNAL);
+	}
 }
 /**
  * @brief Метод добавления шаблона
@@ -978,7 +2132,7 @@ void anyks::Grok::pattern(const string & key, const string & val, const event_t
 		 */
 		try {
 			// Выполняем блокировку потока
-			const lock_guard <std::mutex> lock(this->_mtx.patterns);
+			const lock_guard <std::recursive_mutex> lock(this->_mtx.patterns);
 			// Выполняем копирование текста регулярного выражения
 			string text = val;
 			// Выполняем удаление лишних скобок
@@ -1012,7 +2166,949 @@ void anyks::Grok::pattern(const string & key, const string & val, const event_t
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key, val, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key, val, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
+/**
+ * @brief Метод генерации шаблона
+ *
+ * @param key название шаблона в виде <name>
+ * @param val значение шиблок (Регулярное выражение или Grok-шаблон)
+ * @return    сгенерированный шаблон
+ */
+string anyks::Grok::generatePattern(const string & key, const string & val) noexcept {
+	// Результат работы функции
+	string result = "";
+	// Если данные переданы верные
+	if(!key.empty() && !val.empty() && (key.front() == '<') && (key.back() == '>')){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Создаём название переменной
+			string name = key;
+			// Добавляем разделитель
+			name.append(1, '_');
+			// Добавляем значение
+			name.append(val);
+			// Выполняем генерацию идентификатора кэша
+			const uint64_t id = ::CityHash64(name.c_str(), name.size());
+			{
+				// Выполняем блокировку именованных групп
+				const lock_guard <std::mutex> lock(this->_mtx.cache);
+				// Выполняем поиск идентификатора в списке переменных
+				auto i = this->_nameGroups.find(id);
+				// Если именованная группа найдена
+				if(i != this->_nameGroups.end())
+					// Выводим полученный результат
+					return i->second;
+			}
+			// Название переменной
+			string var = "";
+			// Получаем группу шаблона
+			string group = key;
+			// Удаляем экранирование блоков
+			group.erase(0, 1).pop_back();
+			// Переходим по всем символам группы
+			for(auto & item : group)
+				// Выполняем формирование названия переменной
+				var.append(1, ::toupper(item));
+			// Добавляем разделитель
+			var.append(1, '_');
+			// Добавлем текущее значение времени
+			var.append(std::to_string(id));
+			// Выполняем добавление шаблона
+			this->pattern(var, val);
+			// Формируем генерацию grok-шаблона
+			result.append("%{");
+			// Добавляем название сформированной переменной
+			result.append(var);
+			// Добавляем разделитель
+			result.append(1, ':');
+			// Добавляем значение переменной
+			result.append(group);
+			// Закрываем сгенерированный шаблон
+			result.append(1, '}');
+			// Выполняем блокировку потока потока
+			const lock_guard <std::mutex> lock(this->_mtx.cache);
+			// Добавляем полученный результат в кэш
+			this->_nameGroups.emplace(id, result);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key, val), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод загрузки пакета предварительно собранных шаблонов
+ *
+ * @param filename адрес файла пакета шаблонов
+ * @param stamp    отметка исходных шаблонов, для которых собран пакет
+ * @return         результат загрузки пакета
+ */
+bool anyks::Grok::loadPatterns(const string & filename, const uint64_t stamp) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Если адрес файла пакета передан
+	if(!filename.empty()){
+		// Список декодированных регулярных выражений
+		vector <pcre2_code *> codes;
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Объект отображения файла пакета в память
+			mmap_t mapping(this->_fmk, this->_log);
+			// Если файл пакета отображён в память
+			if(mapping.open(filename)){
+				// Текущая позиция чтения пакета
+				size_t offset = 0;
+				// Получаем адрес данных пакета
+				const char * data = mapping.data();
+				// Получаем размер данных пакета
+				const size_t size = mapping.size();
+				/**
+				 * readFn Функция чтения блока данных пакета
+				 *
+				 * @param buffer буфер для чтения данных
+				 * @param bytes  количество байт для чтения
+				 * @return       результат чтения данных
+				 */
+				auto readFn = [&](void * buffer, const size_t bytes) noexcept -> bool {
+					// Если данных пакета недостаточно
+					if(bytes > (size - offset))
+						// Выводим результат
+						return false;
+					// Выполняем копирование данных пакета (данные в пакете не выровнены)
+					::memcpy(buffer, data + offset, bytes);
+					// Смещаем позицию чтения
+					offset += bytes;
+					// Выводим результат
+					return true;
+				};
+				/**
+				 * stringFn Функция чтения строки пакета
+				 *
+				 * @param text строка для чтения
+				 * @return     результат чтения строки
+				 */
+				auto stringFn = [&](string & text) -> bool {
+					// Размер строки
+					uint32_t length = 0;
+					// Если размер строки не прочитан или данных пакета недостаточно
+					if(!readFn(&length, sizeof(length)) || (length > (size - offset)))
+						// Выводим результат
+						return false;
+					// Выполняем получение строки
+					text.assign(data + offset, length);
+					// Смещаем позицию чтения
+					offset += length;
+					// Выводим результат
+					return true;
+				};
+				// Сигнатура файла пакета
+				char magic[sizeof(GROK_BUNDLE_MAGIC)];
+				// Версия формата и количество записей пакета
+				uint32_t version = 0, count = 0;
+				// Отметка исходных шаблонов пакета
+				uint64_t mark = 0;
+				// Флаг корректности пакета
+				bool mode = (readFn(magic, sizeof(magic)) && (::memcmp(magic, GROK_BUNDLE_MAGIC, sizeof(magic)) == 0) &&
+				             readFn(&version, sizeof(version)) && (version == GROK_BUNDLE_VERSION) &&
+				             readFn(&mark, sizeof(mark)) && (mark == stamp));
+				// Списки внутренних и внешних шаблонов пакета
+				std::unordered_map <string, string> internal, external;
+				// Переходим по спискам внутренних и внешних шаблонов
+				for(auto * patterns : {&internal, &external}){
+					// Выполняем чтение количества шаблонов
+					mode = (mode && readFn(&count, sizeof(count)));
+					// Переходим по всем шаблонам
+					for(uint32_t i = 0; mode && (i < count); i++){
+						// Название и значение шаблона
+						string key = "", value = "";
+						// Если шаблон прочитан
+						if((mode = (stringFn(key) && stringFn(value))))
+							// Добавляем шаблон в список
+							patterns->emplace(::move(key), ::move(value));
+					}
+				}
+				// Список именованных групп пакета
+				std::map <uint64_t, string> groups;
+				// Выполняем чтение количества именованных групп
+				mode = (mode && readFn(&count, sizeof(count)));
+				// Переходим по всем именованным группам
+				for(uint32_t i = 0; mode && (i < count); i++){
+					// Идентификатор именованной группы
+					uint64_t id = 0;
+					// Значение именованной группы
+					string value = "";
+					// Если именованная группа прочитана
+					if((mode = (readFn(&id, sizeof(id)) && stringFn(value))))
+						// Добавляем именованную группу в список
+						groups.emplace(id, ::move(value));
+				}
+				// Список идентификаторов собранных регулярных выражений
+				vector <uint64_t> cids;
+				// Список собранных регулярных выражений пакета
+				vector <std::shared_ptr <cache_t>> items;
+				// Выполняем чтение количества собранных регулярных выражений
+				mode = (mode && readFn(&count, sizeof(count)));
+				// Переходим по всем собранным регулярным выражениям
+				for(uint32_t i = 0; mode && (i < count); i++){
+					// Количество названий групп захвата
+					uint32_t names = 0;
+					// Идентификатор записи в кэше
+					uint64_t cid = 0;
+					// Создаём новую запись кэша
+					auto item = std::make_shared <cache_t> (this->_log);
+					// Выполняем чтение параметров регулярного выражения
+					mode = (readFn(&cid, sizeof(cid)) && stringFn(item->express.expression) &&
+					        readFn(&item->express.groups, sizeof(item->express.groups)) &&
+					        readFn(&names, sizeof(names)) && (names <= (item->express.groups + 1)));
+					// Переходим по всем названиям групп захвата
+					for(uint32_t j = 0; mode && (j < names); j++){
+						// Добавляем название группы захвата
+						item->vars._names.emplace_back();
+						// Выполняем чтение названия группы захвата
+						mode = stringFn(item->vars._names.back());
+					}
+					// Переходим по всем типам групп захвата
+					for(uint32_t j = 0; mode && (j < names); j++){
+						// Тип группы захвата
+						uint8_t type = 0;
+						// Если тип группы захвата прочитан и корректен
+						if((mode = (readFn(&type, sizeof(type)) && (type <= static_cast <uint8_t> (type_t::TS)))))
+							// Добавляем тип группы захвата
+							item->vars._types.push_back(static_cast <type_t> (type));
+					}
+					// Если регулярное выражение прочитано
+					if(mode){
+						// Выполняем построение списка первых групп захвата переменных
+						item->vars.index();
+						// Добавляем идентификатор записи в кэше
+						cids.push_back(cid);
+						// Добавляем собранное регулярное выражение
+						items.push_back(::move(item));
+					}
+				}
+				// Размер байт-кода регулярных выражений
+				uint64_t length = 0;
+				// Выполняем чтение размера байт-кода
+				mode = (mode && readFn(&length, sizeof(length)));
+				// Пропускаем выравнивание байт-кода
+				offset = ((offset + 0x07) & ~static_cast <size_t> (0x07));
+				// Если байт-код регулярных выражений присутствует
+				if(mode && !items.empty()){
+					// Получаем адрес байт-кода регулярных выражений
+					const uint8_t * bytes = reinterpret_cast <const uint8_t *> (data + offset);
+					// Если количество закодированных регулярных выражений совпадает с количеством записей
+					if((mode = ((offset <= size) && (length <= (size - offset)) && (::pcre2_serialize_get_number_of_codes(bytes) == static_cast <int32_t> (items.size()))))){
+						// Выделяем память для декодированных регулярных выражений
+						codes.resize(items.size(), nullptr);
+						// Выполняем декодирование байт-кода (версия PCRE2 и архитектура проверяются библиотекой)
+						mode = (::pcre2_serialize_decode(codes.data(), static_cast <int32_t> (codes.size()), bytes, nullptr) == static_cast <int32_t> (codes.size()));
+					}
+					// Переходим по всем декодированным регулярным выражениям
+					for(size_t i = 0; mode && (i < items.size()); i++){
+						// Передаём регулярное выражение записи кэша
+						items[i]->express.reg = codes[i];
+						// Регулярным выражением теперь владеет запись кэша
+						codes[i] = nullptr;
+						// Выполняем JIT-компиляцию (машинный код в пакете не хранится)
+						::pcre2_jit_compile(items[i]->express.reg, PCRE2_JIT_COMPLETE);
+						// Помечаем регулярное выражение как собранное
+						items[i]->express.mode = true;
+					}
+				}
+				// Если пакет прочитан полностью
+				if(mode){
+					// Базовые шаблоны загружены из пакета и повторно не добавляются
+					std::call_once(this->_once, []() noexcept -> void {});
+					{
+						// Выполняем блокировку потока
+						const lock_guard <std::recursive_mutex> lock(this->_mtx.patterns);
+						// Устанавливаем список внутренних шаблонов
+						this->_patternsInternal.swap(internal);
+						// Устанавливаем список внешних шаблонов
+						this->_patternsExternal.swap(external);
+					}{
+						// Выполняем блокировку потока
+						const lock_guard <std::mutex> lock(this->_mtx.cache);
+						// Устанавливаем список именованных групп
+						this->_nameGroups.swap(groups);
+					}
+					// Создаём новый снимок кэша
+					auto snapshot = std::make_shared <caches_t> ();
+					// Переходим по всем собранным регулярным выражениям
+					for(size_t i = 0; i < items.size(); i++){
+						// Получаем собранное регулярное выражение только для чтения
+						std::shared_ptr <const cache_t> item(::move(items[i]));
+						// Добавляем собранное регулярное выражение в общий кэш (вытесненное из снимка выражение будет найдено в нём)
+						Grok::shared().set(this->key(cids[i]), item, this->_log);
+						// Добавляем собранное регулярное выражение в снимок
+						snapshot->emplace(cids[i], ::move(item));
+					}
+					// Выполняем блокировку сборки регулярных выражений
+					const lock_guard <std::mutex> lock(this->_mtx.build);
+					// Публикуем пустой список наборов (наборы собираются заново из загруженного кэша)
+					std::atomic_store(&this->_multi, std::shared_ptr <const multis_t> (std::make_shared <const multis_t> ()));
+					// Устанавливаем порядок добавления записей кэша
+					this->_order.assign(cids.begin(), cids.end());
+					// Публикуем снимок кэша собранных регулярных выражений
+					std::atomic_store(&this->_cache, std::shared_ptr <const caches_t> (::move(snapshot)));
+					// Запоминаем результат загрузки пакета
+					result = true;
+				// Выводим сообщение об ошибке
+				} else {
+					/**
+					 * Если включён режим отладки
+					 */
+					#if DEBUG_MODE
+						// Выводим сообщение об ошибке
+						this->_log->debug("GROK bundle \"%s\" is broken or was built for other patterns", __PRETTY_FUNCTION__, std::make_tuple(filename, stamp), log_t::flag_t::WARNING, filename.c_str());
+					/**
+					* Если режим отладки не включён
+					*/
+					#else
+						// Выводим сообщение об ошибке
+						this->_log->print("GROK bundle \"%s\" is broken or was built for other patterns", log_t::flag_t::WARNING, filename.c_str());
+					#endif
+				}
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(filename, stamp), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Запоминаем результат загрузки пакета
+			result = false;
+		}
+		// Переходим по всем не переданным в кэш регулярным выражениям
+		for(auto code : codes){
+			// Если регулярное выражение декодировано
+			if(code != nullptr)
+				// Выполняем удаление регулярного выражения
+				::pcre2_code_free(code);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод сохранения пакета предварительно собранных шаблонов
+ *
+ * @param filename адрес файла пакета шаблонов
+ * @param stamp    отметка исходных шаблонов, для которых собран пакет
+ * @return         результат сохранения пакета
+ */
+bool anyks::Grok::savePatterns(const string & filename, const uint64_t stamp) const noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Если адрес файла пакета передан
+	if(!filename.empty()){
+		// Байт-код регулярных выражений
+		uint8_t * bytes = nullptr;
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Буфер данных пакета
+			string buffer = "";
+			/**
+			 * numberFn Функция записи числа в пакет
+			 *
+			 * @param number число для записи
+			 */
+			auto numberFn = [&buffer](const auto number) -> void {
+				// Добавляем число в буфер данных пакета
+				buffer.append(reinterpret_cast <const char *> (&number), sizeof(number));
+			};
+			/**
+			 * stringFn Функция записи строки в пакет
+			 *
+			 * @param text строка для записи
+			 */
+			auto stringFn = [&buffer, &numberFn](const string & text) -> void {
+				// Добавляем размер строки
+				numberFn(static_cast <uint32_t> (text.size()));
+				// Добавляем строку в буфер данных пакета
+				buffer.append(text);
+			};
+			// Выполняем добавление базовых шаблонов
+			this->ready();
+			// Добавляем сигнатуру файла пакета
+			buffer.append(GROK_BUNDLE_MAGIC, sizeof(GROK_BUNDLE_MAGIC));
+			// Добавляем версию формата пакета
+			numberFn(GROK_BUNDLE_VERSION);
+			// Добавляем отметку исходных шаблонов
+			numberFn(stamp);
+			{
+				// Выполняем блокировку потока
+				const lock_guard <std::recursive_mutex> lock(const_cast <grok_t *> (this)->_mtx.patterns);
+				// Переходим по спискам внутренних и внешних шаблонов
+				for(auto * patterns : {&this->_patternsInternal, &this->_patternsExternal}){
+					// Добавляем количество шаблонов
+					numberFn(static_cast <uint32_t> (patterns->size()));
+					// Переходим по всем шаблонам
+					for(auto & item : * patterns){
+						// Добавляем название шаблона
+						stringFn(item.first);
+						// Добавляем значение шаблона
+						stringFn(item.second);
+					}
+				}
+			}{
+				// Выполняем блокировку потока
+				const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.cache);
+				// Добавляем количество именованных групп
+				numberFn(static_cast <uint32_t> (this->_nameGroups.size()));
+				// Переходим по всем именованным группам
+				for(auto & item : this->_nameGroups){
+					// Добавляем идентификатор именованной группы
+					numberFn(item.first);
+					// Добавляем значение именованной группы
+					stringFn(item.second);
+				}
+			}
+			// Получаем текущий снимок кэша
+			std::shared_ptr <const caches_t> cache = std::atomic_load(&this->_cache);
+			// Список регулярных выражений для кодирования
+			vector <const pcre2_code *> codes;
+			// Добавляем количество собранных регулярных выражений
+			numberFn(static_cast <uint32_t> (cache->size()));
+			// Переходим по всем собранным регулярным выражениям
+			for(auto & item : * cache){
+				// Добавляем идентификатор записи в кэше
+				numberFn(item.first);
+				// Добавляем текст регулярного выражения
+				stringFn(item.second->express.expression);
+				// Добавляем количество групп захвата
+				numberFn(item.second->express.groups);
+				// Добавляем количество названий групп захвата
+				numberFn(static_cast <uint32_t> (item.second->vars._names.size()));
+				// Переходим по всем названиям групп захвата
+				for(auto & name : item.second->vars._names)
+					// Добавляем название группы захвата
+					stringFn(name);
+				// Переходим по всем типам групп захвата
+				for(size_t i = 0; i < item.second->vars._names.size(); i++)
+					// Добавляем тип группы захвата
+					numberFn(static_cast <uint8_t> (item.second->vars.type(static_cast <uint32_t> (i))));
+				// Добавляем регулярное выражение для кодирования
+				codes.push_back(item.second->express.reg);
+			}
+			// Размер байт-кода регулярных выражений
+			PCRE2_SIZE size = 0;
+			// Если регулярные выражения для кодирования получены
+			if(!codes.empty()){
+				// Выполняем кодирование регулярных выражений в байт-код
+				const int32_t code = ::pcre2_serialize_encode(codes.data(), static_cast <int32_t> (codes.size()), &bytes, &size, nullptr);
+				// Если кодирование не выполнено
+				if(code < 0){
+					// Создаём буфер данных для извлечения данных ошибки
+					PCRE2_UCHAR message[256];
+					// Выполняем извлечение текста ошибки
+					const int length = ::pcre2_get_error_message(code, message, sizeof(message));
+					/**
+					 * Если включён режим отладки
+					 */
+					#if DEBUG_MODE
+						// Выводим сообщение об ошибке
+						this->_log->debug("GROK bundle \"%s\": %s", __PRETTY_FUNCTION__, std::make_tuple(filename, stamp), log_t::flag_t::CRITICAL, filename.c_str(), (length > 0 ? reinterpret_cast <const char *> (message) : "serialization failed"));
+					/**
+					* Если режим отладки не включён
+					*/
+					#else
+						// Выводим сообщение об ошибке
+						this->_log->print("GROK bundle \"%s\": %s", log_t::flag_t::CRITICAL, filename.c_str(), (length > 0 ? reinterpret_cast <const char *> (message) : "serialization failed"));
+					#endif
+					// Выводим результат
+					return false;
+				}
+			}
+			// Добавляем размер байт-кода
+			numberFn(static_cast <uint64_t> (size));
+			// Выравниваем начало байт-кода по границе 8 байт
+			buffer.append(((buffer.size() + 0x07) & ~static_cast <size_t> (0x07)) - buffer.size(), '\0');
+			// Если байт-код получен
+			if(bytes != nullptr){
+				// Добавляем байт-код в буфер данных пакета
+				buffer.append(reinterpret_cast <const char *> (bytes), size);
+				// Выполняем удаление байт-кода
+				::pcre2_serialize_free(bytes);
+				// Зануляем байт-код
+				bytes = nullptr;
+			}
+			// Адрес временного файла пакета (пакет заменяется целиком, чтобы читатели не получили его часть)
+			const string temp = (filename + ".tmp");
+			// Открываем временный файл пакета на запись
+			std::ofstream file(temp, ios::out | ios::binary | ios::trunc);
+			// Если файл открыт
+			if(file.is_open()){
+				// Выполняем запись данных пакета
+				file.write(buffer.data(), buffer.size());
+				// Выполняем закрытие файла
+				file.close();
+				// Если данные записаны
+				if(!file.fail()){
+					/**
+					 * Для операционной системы MS Windows
+					 */
+					#if defined(_WIN32) || defined(_WIN64)
+						// Удаляем предыдущий пакет (переименование не заменяет существующий файл)
+						::remove(filename.c_str());
+					#endif
+					// Выполняем замену файла пакета
+					result = (::rename(temp.c_str(), filename.c_str()) == 0);
+				}
+			}
+			// Если пакет не сохранён
+			if(!result){
+				// Выполняем удаление временного файла пакета
+				::remove(temp.c_str());
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("GROK bundle \"%s\" could not be written", __PRETTY_FUNCTION__, std::make_tuple(filename, stamp), log_t::flag_t::CRITICAL, filename.c_str());
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("GROK bundle \"%s\" could not be written", log_t::flag_t::CRITICAL, filename.c_str());
+				#endif
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(filename, stamp), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Запоминаем результат сохранения пакета
+			result = false;
+		}
+		// Если байт-код не удалён
+		if(bytes != nullptr)
+			// Выполняем удаление байт-кода
+			::pcre2_serialize_free(bytes);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод использования шаблонов и собранных регулярных выражений другого модуля без повторной загрузки
+ *
+ * @param grok модуль GROK с загруженными шаблонами
+ * @return     результат установки шаблонов
+ */
+bool anyks::Grok::share(const Grok & grok) noexcept {
+	// Если передан другой модуль
+	if(&grok != this){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Базовые шаблоны модуля-источника должны быть добавлены или загружены из пакета
+			grok.ready();
+			// Списки внутренних и внешних шаблонов модуля-источника
+			std::unordered_map <string, string> internal, external;
+			{
+				// Выполняем блокировку шаблонов модуля-источника
+				const lock_guard <std::recursive_mutex> lock(const_cast <grok_t &> (grok)._mtx.patterns);
+				// Выполняем копирование внутренних шаблонов
+				internal = grok._patternsInternal;
+				// Выполняем копирование внешних шаблонов
+				external = grok._patternsExternal;
+			}
+			// Список именованных групп модуля-источника
+			std::map <uint64_t, string> groups;
+			{
+				// Выполняем блокировку именованных групп модуля-источника
+				const lock_guard <std::mutex> lock(const_cast <grok_t &> (grok)._mtx.cache);
+				// Выполняем копирование именованных групп
+				groups = grok._nameGroups;
+			}
+			// Получаем снимок кэша модуля-источника (собранные выражения только читаются и разделяются между модулями)
+			std::shared_ptr <const caches_t> cache = std::atomic_load(&grok._cache);
+			// Базовые шаблоны получены из модуля-источника и повторно не добавляются
+			std::call_once(this->_once, []() noexcept -> void {});
+			{
+				// Выполняем блокировку потока
+				const lock_guard <std::recursive_mutex> lock(this->_mtx.patterns);
+				// Устанавливаем список внутренних шаблонов
+				this->_patternsInternal.swap(internal);
+				// Устанавливаем список внешних шаблонов
+				this->_patternsExternal.swap(external);
+			}{
+				// Выполняем блокировку потока
+				const lock_guard <std::mutex> lock(this->_mtx.cache);
+				// Устанавливаем список именованных групп
+				this->_nameGroups.swap(groups);
+			}
+			// Выполняем блокировку сборки регулярных выражений
+			const lock_guard <std::mutex> lock(this->_mtx.build);
+			// Публикуем пустой список наборов (наборы собираются заново из полученного кэша)
+			std::atomic_store(&this->_multi, std::shared_ptr <const multis_t> (std::make_shared <const multis_t> ()));
+			// Очищаем порядок добавления записей кэша
+			this->_order.clear();
+			// Переходим по всем записям снимка кэша модуля-источника
+			for(auto & item : * cache)
+				// Добавляем идентификатор записи в порядок добавления
+				this->_order.push_back(item.first);
+			// Публикуем снимок кэша собранных регулярных выражений модуля-источника
+			std::atomic_store(&this->_cache, ::move(cache));
+			// Сообщаем, что шаблоны установлены
+			return true;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод сборки регулярного выражения
+ *
+ * @param text текст регулярного выражения для сборки
+ * @return     идентификатор записи в кэше
+ */
+uint64_t anyks::Grok::build(string & text) const noexcept {
+	// Результат работы функции
+	uint64_t result = 0;
+	// Если текст передан
+	if(!text.empty()){
+		// Выполняем генерацию идентификатора кэша
+		result = ::CityHash64(text.c_str(), text.size());
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем текущий снимок кэша без блокировки
+			std::shared_ptr <const caches_t> cache = std::atomic_load(&this->_cache);
+			// Выполняем поиск кэша для текущего регулярного выражения
+			auto i = cache->find(result);
+			// Если кэш для регулярного выражения найден
+			if(i != cache->end()){
+				// Выполняем установку регулярное выражение
+				text = i->second->express.expression;
+				// Выводим идентификатор записи в кэше
+				return result;
+			}
+			// Выполняем блокировку сборки, чтобы одно выражение не собиралось несколькими потоками
+			const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.build);
+			// Получаем снимок кэша, который мог измениться пока ожидалась блокировка
+			cache = std::atomic_load(&this->_cache);
+			// Выполняем повторный поиск регулярного выражения в кэше
+			i = cache->find(result);
+			// Если регулярное выражение уже собрано другим потоком
+			if(i != cache->end()){
+				// Выполняем установку регулярное выражение
+				text = i->second->express.expression;
+				// Выводим идентификатор записи в кэше
+				return result;
+			}
+			// Получаем ключ записи общего кэша (выражение и внешние шаблоны)
+			const uint64_t key = this->key(result);
+			// Выполняем поиск выражения, собранного другим экземпляром модуля
+			std::shared_ptr <const cache_t> shared = Grok::shared().get(key);
+			// Если выражение найдено в общем кэше
+			if(shared != nullptr){
+				// Выполняем установку регулярное выражение
+				text = shared->express.expression;
+				// Добавляем собранное регулярное выражение в снимок кэша
+				this->admit(result, shared);
+				// Выводим идентификатор записи в кэше
+				return result;
+			}
+			// Выполняем добавление базовых шаблонов
+			this->ready();
+			// Выполняем блокировку шаблонов на время их подстановки (именованные группы добавляют шаблоны в том же потоке)
+			const lock_guard <std::recursive_mutex> patterns(const_cast <grok_t *> (this)->_mtx.patterns);
+			// Создаём новую запись кэша
+			auto item = std::make_shared <cache_t> (this->_log);
+			// Выполняем удаление лишних скобок
+			this->removeBrackets(text);
+			// Выполняем генерацию именованных групп
+			this->namedGroups(text);
+			// Если текст существует а не сломан
+			if(!text.empty()){
+				// Выполняем обработку полученных шаблонов
+				const auto & vars = this->prepare(text);
+				// Выполняем установку регулярного выражения
+				item->express.expression = text;
+				// Текст ошибки компиляции
+				string error = "";
+				// Выполняем компиляцию регулярного выражения
+				item->express.reg = compile(item->express.expression, error);
+				// Если регулярное выражение скомпилировано
+				if((item->express.mode = (item->express.reg != nullptr))){
+					// Получаем количество групп захвата регулярного выражения
+					::pcre2_pattern_info(item->express.reg, PCRE2_INFO_CAPTURECOUNT, &item->express.groups);
+					// Сопоставляем переменные с группами захвата один раз при сборке
+					item->vars.push(item->express.reg, vars);
+					// Получаем собранное регулярное выражение только для чтения
+					std::shared_ptr <const cache_t> compiled(::move(item));
+					// Добавляем собранное регулярное выражение в общий кэш
+					Grok::shared().set(key, compiled, this->_log);
+					// Добавляем собранное регулярное выражение в снимок кэша
+					this->admit(result, compiled);
+				// Если возникла ошибка компиляции
+				} else {
+					// Если текст ошибки получен
+					if(!error.empty()){
+						/**
+						 * Если включён режим отладки
+						 */
+						#if DEBUG_MODE
+							// Выводим сообщение об ошибке
+							this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.c_str());
+						/**
+						* Если режим отладки не включён
+						*/
+						#else
+							// Выводим сообщение об ошибке
+							this->_log->print("%s", log_t::flag_t::CRITICAL, error.c_str());
+						#endif
+					}
+					// Выполняем зануление идентификатора записи
+					result = 0;
+				}
+			// Формируем сообщение об ошибке
+			} else {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, "Regular expression is broken");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Regular expression is broken");
+				#endif
+				// Выполняем зануление идентификатора записи
+				result = 0;
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод сборки набора альтернативных регулярных выражений
+ *
+ * @param texts список регулярных выражений в порядке перебора
+ * @return      идентификатор набора
+ */
+uint64_t anyks::Grok::build(const vector <string> & texts) const noexcept {
+	// Результат работы функции
+	uint64_t result = 0;
+	// Если список регулярных выражений передан
+	if(!texts.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Ключ набора регулярных выражений
+			string key = "";
+			// Переходим по всем регулярным выражениям
+			for(auto & text : texts){
+				// Добавляем регулярное выражение в ключ
+				key.append(text);
+				// Добавляем разделитель выражений
+				key.append(1, '\n');
+			}
+			// Выполняем генерацию идентификатора набора
+			result = ::CityHash64(key.c_str(), key.size());
+			// Если набор уже собран (поиск выполняется в снимке без блокировки)
+			if(std::atomic_load(&this->_multi)->count(result) > 0)
+				// Выводим идентификатор набора
+				return result;
+			// Создаём новый набор регулярных выражений
+			auto multi = std::make_shared <multi_t> (this->_log);
+			// Выделяем счётчики совпадений для каждого выражения
+			multi->hits = vector <std::atomic <size_t>> (texts.size());
+			// Выделяем счётчики превышений ограничений для каждого выражения
+			multi->timeouts = vector <std::atomic <size_t>> (texts.size());
+			// Переходим по всем регулярным выражениям
+			for(auto & text : texts){
+				// Список обязательных литералов выражения
+				vector <uint32_t> required;
+				// Выполняем копирование регулярного выражения
+				string express = text;
+				// Собранное регулярное выражение
+				std::shared_ptr <const cache_t> item;
+				// Выполняем сборку регулярного выражения
+				const uint64_t cid = this->build(express);
+				// Если регулярное выражение собрано
+				if(cid > 0){
+					// Получаем собранное регулярное выражение из кэша
+					item = this->lookup(cid);
+					// Переходим по всем обязательным литералам собранного выражения
+					for(auto & literal : this->literals(express))
+						// Добавляем литерал в автомат предварительного отбора
+						required.push_back(multi->prefilter.add(literal));
+				}
+				// Добавляем идентификатор выражения
+				multi->cids.push_back(cid);
+				// Добавляем собранное регулярное выражение
+				multi->caches.push_back(::move(item));
+				// Добавляем список обязательных литералов
+				multi->required.push_back(::move(required));
+			}
+			// Выполняем построение автомата предварительного отбора
+			multi->prefilter.compile();
+			// Выполняем блокировку сборки регулярных выражений
+			const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.build);
+			// Получаем текущий снимок наборов
+			std::shared_ptr <const multis_t> multis = std::atomic_load(&this->_multi);
+			// Если набор ещё не добавлен другим потоком
+			if(multis->count(result) == 0){
+				// Создаём копию снимка наборов
+				auto snapshot = std::make_shared <multis_t> (* multis);
+				// Добавляем набор в копию
+				snapshot->emplace(result, ::move(multi));
+				// Публикуем новый снимок наборов для читающих потоков
+				std::atomic_store(&const_cast <grok_t *> (this)->_multi, std::shared_ptr <const multis_t> (::move(snapshot)));
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(texts.size()), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Выполняем зануление идентификатора набора
+			result = 0;
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод выполнения парсинга текста
+ *
+ * @param text    текст для парсинга
+ * @param cid     идентификатор записи в кэше
+ * @param mapping результат сопоставления текста
+ * @return        результат выполнения регулярного выражения
+ */
+bool anyks::Grok::parse(const string_view text, const uint64_t cid, mapping_t & mapping) const noexcept {
+	// Если данные текста и правил переданы
+	if(!text.empty() && (cid > 0)){
+		/**
+		 * Выполняем обработку ошибки
+		 */
+		try {
+			// Получаем собранное регулярное выражение
+			const std::shared_ptr <const cache_t> cache = this->lookup(cid);
+			// Если идентификатор регулярного выражения в кэше найден
+			if(cache != nullptr)
+				// Выполняем парсинг текста собранным регулярным выражением
+				return (this->parse(text, cache, std::atomic_load(&this->_context).get(), mapping) > 0);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), cid), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -1022,69 +3118,81 @@ void anyks::Grok::pattern(const string & key, const string & val, const event_t
 			#endif
 		}
 	}
+	// Выводим результат
+	return false;
 }
 /**
- * @brief Метод генерации шаблона
+ * @brief Метод выполнения парсинга текста собранным регулярным выражением
  *
- * @param key название шаблона в виде <name>
- * @param val значение шиблок (Регулярное выражение или Grok-шаблон)
- * @return    сгенерированный шаблон
+ * @param text    текст для парсинга
+ * @param cache   собранное регулярное выражение
+ * @param context контекст сопоставления с ограничениями выполнения
+ * @param mapping результат сопоставления текста
+ * @return        код результата сопоставления PCRE2 (больше нуля при совпадении)
  */
-string anyks::Grok::generatePattern(const string & key, const string & val) noexcept {
+int32_t anyks::Grok::parse(const string_view text, const std::shared_ptr <const cache_t> & cache, const context_t * context, mapping_t & mapping) const noexcept {
 	// Результат работы функции
-	string result = "";
-	// Если данные переданы верные
-	if(!key.empty() && !val.empty() && (key.front() == '<') && (key.back() == '>')){
+	int32_t result = PCRE2_ERROR_NOMATCH;
+	// Если текст передан и регулярное выражение скомпилировано
+	if(!text.empty() && (cache != nullptr) && cache->express.mode){
 		/**
-		 * Выполняем отлов ошибок
+		 * Выполняем обработку ошибки
 		 */
 		try {
-			// Создаём название переменной
-			string name = key;
-			// Добавляем разделитель
-			name.append(1, '_');
-			// Добавляем значение
-			name.append(val);
-			// Выполняем генерацию идентификатора кэша
-			const uint64_t id = ::CityHash64(name.c_str(), name.size());
-			// Выполняем поиск идентификатора в списке переменных
-			auto i = this->_nameGroups.find(id);
-			// Если менованная группа найдена
-			if(i != this->_nameGroups.end())
-				// Выводим полученный результат
-				return i->second;
-			// Если именованная группа не найдена
-			else {
-				// Название переменной
-				string var = "";
-				// Получаем группу шаблона
-				string group = key;
-				// Удаляем экранирование блоков
-				group.erase(0, 1).pop_back();
-				// Переходим по всем символам группы
-				for(auto & item : group)
-					// Выполняем формирование названия переменной
-					var.append(1, ::toupper(item));
-				// Добавляем разделитель
-				var.append(1, '_');
-				// Добавлем текущее значение времени
-				var.append(std::to_string(id));
-				// Выполняем добавление шаблона
-				this->pattern(var, val);
-				// Формируем генерацию grok-шаблона
-				result.append("%{");
-				// Добавляем название сформированной переменной
-				result.append(var);
-				// Добавляем разделитель
-				result.append(1, ':');
-				// Добавляем значение переменной
-				result.append(group);
-				// Закрываем сгенерированный шаблон
-				result.append(1, '}');
-				// Выполняем блокировку потока потока
-				const lock_guard <std::mutex> lock(this->_mtx.cache);
-				// Добавляем полученный результат в кэш
-				this->_nameGroups.emplace(id, result);
+			// Получаем количество групп захвата регулярного выражения
+			const uint32_t groups = cache->express.groups;
+			// Получаем блок результатов сопоставления текущего потока
+			pcre2_match_data * data = match(groups);
+			// Если блок результатов получен, выполняем разбор регулярного выражения (длина текста передаётся явно, нулевой символ не требуется)
+			if((data != nullptr) && ((result = ::pcre2_match(cache->express.reg, reinterpret_cast <PCRE2_SPTR> (text.data()), text.size(), 0, PCRE2_NOTEMPTY, data, (context != nullptr ? context->context : nullptr))) > 0)){
+				// Получаем список смещений найденных групп
+				const PCRE2_SIZE * offsets = ::pcre2_get_ovector_pointer(data);
+				// Выполняем очистку предыдущего результата (выделенная память сохраняется)
+				mapping._captures.clear();
+				// Запоминаем разобранный текст, в который указывают смещения
+				mapping._text = text;
+				// Если результат ссылается на другое регулярное выражение
+				if(mapping._cache != cache)
+					// Запоминаем регулярное выражение, содержащее названия переменных
+					mapping._cache = cache;
+				// Выполняем перебор всех полученных вариантов
+				for(uint32_t j = 1; j < (groups + 1); j++){
+					// Если группа именована и результат получен (у не найденных групп оба смещения равны PCRE2_UNSET)
+					if(!cache->vars.get(j).empty() && (offsets[(j * 2) + 1] > offsets[j * 2])){
+						// Получаем первую группу захвата переменной
+						const uint32_t field = cache->vars.field(j);
+						// Флаг добавления переменной впервые
+						bool append = true;
+						// Если переменная встречается в выражении несколько раз
+						if(field != j){
+							// Переходим по всем уже захваченным переменным
+							for(auto & capture : mapping._captures){
+								// Если переменная уже захвачена
+								if(capture.group == field){
+									// Запрещаем повторное добавление
+									append = false;
+									// Выходим из цикла
+									break;
+								}
+							}
+						}
+						// Если переменная добавляется впервые
+						if(append){
+							// Выполняем добавление переменной в результат
+							mapping._captures.emplace_back();
+							// Получаем добавленную переменную
+							capture_t & capture = mapping._captures.back();
+							// Запоминаем группу захвата, определяющую название переменной
+							capture.group = field;
+							// Запоминаем смещение значения в тексте
+							capture.offset = offsets[j * 2];
+							// Запоминаем размер значения в тексте
+							capture.size = (offsets[(j * 2) + 1] - offsets[j * 2]);
+							// Выполняем конвертацию значения прямо из смещений совпадения
+							convert(text.substr(capture.offset, capture.size), cache->vars.type(j), capture);
+						}
+					}
+				}
 			}
 		/**
 		 * Если возникает ошибка
@@ -1095,7 +3203,7 @@ string anyks::Grok::generatePattern(const string & key, const string & val) noex
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key, val), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -1109,113 +3217,82 @@ string anyks::Grok::generatePattern(const string & key, const string & val) noex
 	return result;
 }
 /**
- * @brief Метод сборки регулярного выражения
+ * @brief Метод поиска первого совпавшего выражения набора
  *
- * @param text текст регулярного выражения для сборки
- * @return     идентификатор записи в кэше
+ * @param text    текст для парсинга
+ * @param mid     идентификатор набора альтернативных регулярных выражений
+ * @param mapping результат сопоставления текста
+ * @return        идентификатор записи в кэше совпавшего выражения или 0
  */
-uint64_t anyks::Grok::build(string & text) const noexcept {
-	// Результат работы функции
-	uint64_t result = 0;
-	// Если текст передан
-	if(!text.empty()){
-		// Выполняем генерацию идентификатора кэша
-		result = ::CityHash64(text.c_str(), text.size());
+uint64_t anyks::Grok::find(const string_view text, const uint64_t mid, mapping_t & mapping) const noexcept {
+	// Если текст и идентификатор набора переданы
+	if(!text.empty() && (mid > 0)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем поиск кэша для текущего регулярного выражения
-			auto i = this->_cache.find(result);
-			// Если кэш для регулярного выражения найден
-			if(i != this->_cache.end()){
-				// Выполняем установку регулярное выражение
-				text = i->second->express.expression;
-				// Выводим идентификатор записи в кэше
-				return result;
-			// Если в кэше регулярного выражения нет
-			} else {
-				// Выполняем удаление лишних скобок
-				this->removeBrackets(text);
-				// Выполняем блокировку потока
-				const_cast <grok_t *> (this)->_mtx.cache.lock();
-				// Выполняем создании записи кэша
-				auto ret = const_cast <grok_t *> (this)->_cache.emplace(result, std::make_unique <cache_t> (this->_log));
-				// Выполняем разблокировку потока
-				const_cast <grok_t *> (this)->_mtx.cache.unlock();
-				// Выполняем генерацию именованных групп
-				this->namedGroups(text);
-				// Если текст существует а не сломан
-				if(!text.empty()){
-					// Выполняем обработку полученных шаблонов
-					const auto & vars = this->prepare(text);
-					// Если список переменных получен
-					if(!vars.empty()){
-						// Выполняем перебор списка переменных
-						for(auto & var : vars)
-							// Выполняем добавление переменной
-							ret.first->second->vars.push(var.first, var.second);
+			// Получаем текущий снимок наборов без блокировки
+			const std::shared_ptr <const multis_t> multis = std::atomic_load(&this->_multi);
+			// Выполняем поиск набора регулярных выражений
+			auto i = multis->find(mid);
+			// Если набор регулярных выражений найден
+			if(i != multis->end()){
+				// Отметки найденных литералов текущего потока
+				static thread_local vector <uint32_t> marks;
+				// Значение отметки текущего поиска
+				static thread_local uint32_t stamp = 0;
+				// Если значение отметки переполнилось
+				if(++stamp == 0){
+					// Выполняем сброс всех отметок
+					std::fill(marks.begin(), marks.end(), 0);
+					// Устанавливаем начальное значение отметки
+					stamp = 1;
+				}
+				// Получаем текущий контекст сопоставления с ограничениями выполнения
+				const std::shared_ptr <const context_t> context = std::atomic_load(&this->_context);
+				// Получаем максимальное время сопоставления строки
+				const uint64_t budget = (context != nullptr ? context->limits.budget : 0);
+				// Запоминаем время начала сопоставления строки
+				const auto start = (budget > 0 ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point());
+				// Выполняем поиск всех обязательных литералов за один проход по тексту
+				i->second->prefilter.scan(text, marks, stamp);
+				// Переходим по всем выражениям набора в порядке перебора
+				for(size_t j = 0; j < i->second->cids.size(); j++){
+					// Флаг наличия всех обязательных литералов
+					bool candidate = (i->second->caches[j] != nullptr);
+					// Переходим по всем обязательным литералам выражения
+					for(size_t k = 0; candidate && (k < i->second->required[j].size()); k++){
+						// Получаем идентификатор литерала
+						const uint32_t id = i->second->required[j][k];
+						// Проверяем, что литерал найден в тексте
+						candidate = ((id < marks.size()) && (marks[id] == stamp));
 					}
-					// Выполняем установку регулярного выражения
-					ret.first->second->express.expression = text;
-					// Выполняем компиляцию регулярного выражения
-					const int error = ::pcre2_regcomp(&ret.first->second->express.reg, ret.first->second->express.expression.c_str(), REG_UTF | REG_ICASE);
-					// Если возникла ошибка компиляции
-					if(!(ret.first->second->express.mode = (error == 0))){
-						// Создаём буфер данных для извлечения данных ошибки
-						char buffer[256];
-						// Выполняем заполнение нулями буфер данных
-						::memset(buffer, '\0', sizeof(buffer));
-						// Выполняем извлечение текста ошибки
-						const size_t size = ::pcre2_regerror(error, &ret.first->second->express.reg, buffer, sizeof(buffer) - 1);
-						// Если текст ошибки получен
-						if(size > 0){
-							// Формируем полученную ошибку
-							string error(buffer, size);
-							/**
-							 * Если включён режим отладки
-							 */
-							#if DEBUG_MODE
-								// Выводим сообщение об ошибке
-								this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.c_str());
-							/**
-							* Если режим отладки не включён
-							*/
-							#else
-								// Выводим сообщение об ошибке
-								this->_log->print("%s", log_t::flag_t::CRITICAL, error.c_str());
-							#endif
-						}
-						// Выполняем сброс собранных данных переменных
-						ret.first->second->vars.reset();
-						// Выполняем блокировку потока потока для удаления кэша
-						const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.cache);
-						// Выполняем удаление записи из кэша
-						const_cast <grok_t *> (this)->_cache.erase(result);
-						// Выполняем зануление идентификатора записи
-						result = 0;
+					// Если выражение не может совпасть
+					if(!candidate)
+						// Переходим к следующему выражению
+						continue;
+					// Выполняем сопоставление текста с выражением
+					const int32_t code = this->parse(text, i->second->caches[j], context.get(), mapping);
+					// Время сопоставления учитывается после завершения выражения (PCRE2 не прерывает сопоставление по времени)
+					const bool expired = ((budget > 0) && (static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::microseconds> (std::chrono::steady_clock::now() - start).count()) > budget));
+					// Если текст соответствует выражению и время сопоставления строки не истекло
+					if((code > 0) && !expired){
+						// Увеличиваем количество совпадений выражения
+						i->second->hits[j]++;
+						// Выводим идентификатор совпавшего выражения
+						return i->second->cids[j];
+					}
+					// Если превышены ограничения выполнения или время сопоставления строки истекло (совпадение, полученное после истечения времени, отбрасывается)
+					if(exceeded(code) || expired){
+						// Выполняем очистку результата сопоставления
+						mapping.clear();
+						// Увеличиваем количество превышений ограничений выражения
+						i->second->timeouts[j]++;
+						// Увеличиваем количество пропущенных строк
+						i->second->skipped++;
+						// Строка пропускается без перебора остальных выражений
+						return 0;
 					}
-				// Формируем сообщение об ошибке
-				} else {
-					/**
-					 * Если включён режим отладки
-					 */
-					#if DEBUG_MODE
-						// Выводим сообщение об ошибке
-						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(ret.first->second->express.expression), log_t::flag_t::CRITICAL, "Regular expression is broken");
-					/**
-					* Если режим отладки не включён
-					*/
-					#else
-						// Выводим сообщение об ошибке
-						this->_log->print("%s", log_t::flag_t::CRITICAL, "Regular expression is broken");
-					#endif
-					// Выполняем блокировку потока потока для удаления кэша
-					const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.cache);
-					// Выполняем удаление записи из кэша
-					const_cast <grok_t *> (this)->_cache.erase(result);
-					// Выполняем зануление идентификатора записи
-					result = 0;
 				}
 			}
 		/**
@@ -1227,7 +3304,7 @@ uint64_t anyks::Grok::build(string & text) const noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), mid), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -1238,57 +3315,364 @@ uint64_t anyks::Grok::build(string & text) const noexcept {
 		}
 	}
 	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод получения количества совпадений каждого выражения набора
+ *
+ * @param mid идентификатор набора альтернативных регулярных выражений
+ * @return    количество совпадений в порядке выражений набора
+ */
+vector <size_t> anyks::Grok::hits(const uint64_t mid) const noexcept {
+	// Результат работы функции
+	vector <size_t> result;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем текущий снимок наборов без блокировки
+		const std::shared_ptr <const multis_t> multis = std::atomic_load(&this->_multi);
+		// Выполняем поиск набора регулярных выражений
+		auto i = multis->find(mid);
+		// Если набор регулярных выражений найден
+		if(i != multis->end()){
+			// Переходим по всем счётчикам совпадений
+			for(auto & hit : i->second->hits)
+				// Добавляем количество совпадений выражения
+				result.push_back(hit.load());
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(mid), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим результат
 	return result;
 }
 /**
- * @brief Метод выполнения парсинга текста
+ * @brief Метод получения количества превышений ограничений каждого выражения набора
  *
- * @param text текст для парсинга
- * @param cid  идентификатор записи в кэше
- * @return     результат выполнения регулярного выражения
+ * @param mid идентификатор набора альтернативных регулярных выражений
+ * @return    количество превышений ограничений в порядке выражений набора
  */
-bool anyks::Grok::parse(const string & text, const uint64_t cid) noexcept {
+vector <size_t> anyks::Grok::timeouts(const uint64_t mid) const noexcept {
 	// Результат работы функции
-	bool result = false;
-	// Если данные текста и правил переданы
-	if(!text.empty() && (cid > 0)){
+	vector <size_t> result;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем текущий снимок наборов без блокировки
+		const std::shared_ptr <const multis_t> multis = std::atomic_load(&this->_multi);
+		// Выполняем поиск набора регулярных выражений
+		auto i = multis->find(mid);
+		// Если набор регулярных выражений найден
+		if(i != multis->end()){
+			// Переходим по всем счётчикам превышений ограничений
+			for(auto & timeout : i->second->timeouts)
+				// Добавляем количество превышений ограничений выражения
+				result.push_back(timeout.load());
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
 		/**
-		 * Выполняем обработку ошибки
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(mid), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения количества строк, пропущенных из-за превышения ограничений
+ *
+ * @param mid идентификатор набора альтернативных регулярных выражений
+ * @return    количество пропущенных строк
+ */
+size_t anyks::Grok::skipped(const uint64_t mid) const noexcept {
+	// Получаем текущий снимок наборов без блокировки
+	const std::shared_ptr <const multis_t> multis = std::atomic_load(&this->_multi);
+	// Выполняем поиск набора регулярных выражений
+	auto i = multis->find(mid);
+	// Если набор регулярных выражений найден
+	if(i != multis->end())
+		// Выводим количество пропущенных строк
+		return i->second->skipped.load();
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод установки ограничений выполнения регулярных выражений
+ *
+ * @param limits ограничения выполнения регулярных выражений
+ */
+void anyks::Grok::limits(const limits_t & limits) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Если ограничения не установлены
+		if((limits.match == 0) && (limits.depth == 0) && (limits.stack == 0) && (limits.budget == 0))
+			// Публикуем пустой контекст сопоставления
+			std::atomic_store(&this->_context, std::shared_ptr <const context_t> ());
+		// Если ограничения установлены
+		else {
+			// Создаём новый контекст сопоставления
+			auto context = std::make_shared <context_t> ();
+			// Запоминаем ограничения выполнения
+			context->limits = limits;
+			// Если ограничения PCRE2 установлены
+			if((limits.match > 0) || (limits.depth > 0) || (limits.stack > 0)){
+				// Выполняем создание контекста сопоставления PCRE2
+				context->context = ::pcre2_match_context_create(nullptr);
+				// Если контекст сопоставления не создан
+				if(context->context == nullptr)
+					// Выводим сообщение об ошибке
+					throw std::bad_alloc();
+				// Если ограничение количества шагов сопоставления установлено
+				if(limits.match > 0)
+					// Устанавливаем ограничение количества шагов сопоставления
+					::pcre2_set_match_limit(context->context, limits.match);
+				// Если ограничение глубины возвратов установлено
+				if(limits.depth > 0)
+					// Устанавливаем ограничение глубины возвратов
+					::pcre2_set_depth_limit(context->context, limits.depth);
+				// Если размер стека JIT установлен, каждый поток получает собственный стек указанного размера
+				if(limits.stack > 0)
+					// Устанавливаем функцию получения стека JIT текущего потока
+					::pcre2_jit_stack_assign(context->context, &Grok::stack, &context->limits.stack);
+			}
+			// Публикуем новый контекст сопоставления для читающих потоков
+			std::atomic_store(&this->_context, std::shared_ptr <const context_t> (::move(context)));
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(limits.match, limits.depth, limits.stack, limits.budget), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод профилирования регулярного выражения на корпусе строк
+ *
+ * @param text   регулярное выражение в формате GROK
+ * @param corpus текст корпуса (каждая строка является отдельной записью)
+ * @return       отчёт профилирования по подшаблонам выражения
+ */
+anyks::Grok::report_t anyks::Grok::profile(const string & text, const string_view corpus) const noexcept {
+	// Результат работы функции
+	report_t result;
+	// Если регулярное выражение и корпус переданы
+	if(!text.empty() && !corpus.empty()){
+		/**
+		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем поиск идентификатора регулярного выражения в кэше
-			auto i = this->_cache.find(cid);
-			// Если идентификатор регулярного выражения в кэше найден
-			if((i != this->_cache.end()) && i->second->express.mode){
-				// Создаём объект матчинга
-				regmatch_t match[i->second->express.reg.re_nsub + 1];
-				// Выполняем разбор регулярного выражения
-				const int error = ::pcre2_regexec(&i->second->express.reg, text.c_str(), i->second->express.reg.re_nsub + 1, match, REG_NOTEMPTY);
-				// Если ошибок не получено
-				if((result = (error == 0))){
-					// Название полученной переменной
-					string value = "";
-					// Выполняем перебор всех полученных вариантов
-					for(uint8_t j = 1; j < static_cast <uint8_t> (i->second->express.reg.re_nsub + 1); j++){
-						// Если результат получен
-						if(match[j].rm_eo > match[j].rm_so){
-							// Добавляем полученный результат в список результатов
-							value.assign(text.c_str() + match[j].rm_so, match[j].rm_eo - match[j].rm_so);
-							// Если значение переменной получено
-							if(!value.empty()){
-								// Извлекаем переменную которой соответствует текст
-								const string & key = i->second->vars.get(value, j - 1);
-								// Если название переменной получено
-								if(!key.empty()){
-									// Выполняем блокировку потока
-									const lock_guard <std::mutex> lock(this->_mtx.mapping);
-									// Выполняем добавления полученных данных в схему соответствий
-									i->second->mapping.emplace(key, value);
-								}
-							}
-						}
-					}
-				}
+			// Выполняем добавление базовых шаблонов
+			this->ready();
+			// Выполняем копирование регулярного выражения
+			string express = text;
+			// Список извлечённых переменных
+			vector <var_t> vars;
+			{
+				// Выполняем блокировку сборки, так как разбор шаблонов использует общие данные
+				const lock_guard <std::mutex> lock(const_cast <grok_t *> (this)->_mtx.build);
+				// Выполняем блокировку шаблонов на время их подстановки
+				const lock_guard <std::recursive_mutex> patterns(const_cast <grok_t *> (this)->_mtx.patterns);
+				// Выполняем удаление лишних скобок
+				this->removeBrackets(express);
+				// Выполняем генерацию именованных групп
+				this->namedGroups(express);
+				// Если текст существует а не сломан
+				if(!express.empty())
+					// Выполняем обработку полученных шаблонов
+					vars = this->prepare(express);
+			}
+			// Если регулярное выражение сломано
+			if(express.empty())
+				// Выводим пустой результат
+				return result;
+			// Код ошибки компиляции
+			int code = 0;
+			// Позиция ошибки в регулярном выражении
+			PCRE2_SIZE offset = 0;
+			// Выполняем компиляцию без JIT: флаги возвратов передаются в обратный вызов только интерпретатором
+			std::unique_ptr <pcre2_code, void (*)(pcre2_code *)> reg(
+				::pcre2_compile(reinterpret_cast <PCRE2_SPTR> (express.data()), express.size(), PCRE2_UTF | PCRE2_CASELESS | PCRE2_AUTO_CALLOUT, &code, &offset, nullptr),
+				&::pcre2_code_free
+			);
+			// Если регулярное выражение не скомпилировано
+			if(reg == nullptr){
+				// Создаём буфер данных для извлечения данных ошибки
+				PCRE2_UCHAR buffer[256];
+				// Выполняем извлечение текста ошибки
+				const int size = ::pcre2_get_error_message(code, buffer, sizeof(buffer));
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, (size > 0 ? reinterpret_cast <const char *> (buffer) : "Regular expression is broken"));
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, (size > 0 ? reinterpret_cast <const char *> (buffer) : "Regular expression is broken"));
+				#endif
+				// Выводим пустой результат
+				return result;
+			}
+			// Количество групп захвата регулярного выражения
+			uint32_t groups = 0;
+			// Получаем количество групп захвата регулярного выражения
+			::pcre2_pattern_info(reg.get(), PCRE2_INFO_CAPTURECOUNT, &groups);
+			// Объект работы с переменными
+			vars_t variables(this->_log);
+			// Сопоставляем переменные с группами захвата для получения подшаблонов
+			variables.push(reg.get(), vars);
+			// Состояние профилирования
+			probe_t probe;
+			// Выполняем построение карты групп захвата
+			if(!this->outline(express, groups, probe)){
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, "Capture groups of the regular expression could not be mapped");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Capture groups of the regular expression could not be mapped");
+				#endif
+				// Выводим пустой результат
+				return result;
+			}
+			// Выделяем профили для всего выражения и каждой группы захвата
+			result.items.resize(static_cast <size_t> (groups) + 1);
+			// Переходим по всем профилям
+			for(uint32_t i = 0; i <= groups; i++){
+				// Устанавливаем номер группы захвата
+				result.items[i].group = i;
+				// Устанавливаем номер родительской группы захвата
+				result.items[i].parent = probe.parents[i];
+				// Устанавливаем подшаблон группы захвата
+				result.items[i].label = (i > 0 ? variables.label(i) : text);
+			}
+			// Запоминаем профили в состоянии профилирования
+			probe.items = &result.items;
+			// Создаём контекст сопоставления с функцией обратного вызова
+			std::unique_ptr <pcre2_match_context, void (*)(pcre2_match_context *)> context(::pcre2_match_context_create(nullptr), &::pcre2_match_context_free);
+			// Если контекст сопоставления не создан
+			if(context == nullptr)
+				// Выводим сообщение об ошибке
+				throw std::bad_alloc();
+			// Устанавливаем функцию обратного вызова профилирования
+			::pcre2_set_callout(context.get(), &Grok::callout, &probe);
+			// Получаем текущие ограничения выполнения
+			const std::shared_ptr <const context_t> limits = std::atomic_load(&this->_context);
+			// Если ограничения выполнения установлены
+			if(limits != nullptr){
+				// Если ограничение количества шагов сопоставления установлено
+				if(limits->limits.match > 0)
+					// Устанавливаем ограничение количества шагов сопоставления
+					::pcre2_set_match_limit(context.get(), limits->limits.match);
+				// Если ограничение глубины возвратов установлено
+				if(limits->limits.depth > 0)
+					// Устанавливаем ограничение глубины возвратов
+					::pcre2_set_depth_limit(context.get(), limits->limits.depth);
+			}
+			// Получаем блок результатов сопоставления текущего потока
+			pcre2_match_data * data = match(groups);
+			// Если блок результатов не создан
+			if(data == nullptr)
+				// Выводим сообщение об ошибке
+				throw std::bad_alloc();
+			// Переходим по всем строкам корпуса
+			for(size_t start = 0, stop = 0; start < corpus.size(); start = (stop + 1)){
+				// Выполняем поиск конца строки
+				stop = corpus.find('\n', start);
+				// Если конец строки не найден
+				if(stop == string_view::npos)
+					// Строка заканчивается концом корпуса
+					stop = corpus.size();
+				// Получаем текущую строку
+				string_view line = corpus.substr(start, stop - start);
+				// Если строка заканчивается возвратом каретки
+				if(!line.empty() && (line.back() == '\r'))
+					// Удаляем возврат каретки
+					line.remove_suffix(1);
+				// Если строка пустая
+				if(line.empty())
+					// Переходим к следующей строке
+					continue;
+				// Увеличиваем количество строк корпуса
+				result.lines++;
+				// Сбрасываем позицию предыдущего обратного вызова на начало выражения
+				probe.position = 0;
+				// Запоминаем время начала сопоставления
+				const auto begin = probe.last = std::chrono::steady_clock::now();
+				// Выполняем сопоставление строки
+				const int32_t rc = ::pcre2_match(reg.get(), reinterpret_cast <PCRE2_SPTR> (line.data()), line.size(), 0, 0, data, context.get());
+				// Получаем время окончания сопоставления
+				const auto end = std::chrono::steady_clock::now();
+				// Получаем время выполнения последнего элемента выражения
+				const uint64_t elapsed = static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::nanoseconds> (end - probe.last).count());
+				// Время последнего элемента учитывается во всех подшаблонах, которые его содержат
+				for(uint32_t group = probe.owners[probe.position]; group > 0; group = probe.parents[group])
+					// Увеличиваем время выполнения подшаблона
+					result.items[group].time += elapsed;
+				// Увеличиваем количество запусков всего выражения
+				result.items[0].calls++;
+				// Увеличиваем время выполнения всего выражения
+				result.items[0].time += static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::nanoseconds> (end - begin).count());
+				// Если строка совпала
+				if(rc > 0)
+					// Увеличиваем количество совпавших строк
+					result.matched++;
+				// Если превышены ограничения выполнения
+				else if(exceeded(rc))
+					// Увеличиваем количество пропущенных строк
+					result.skipped++;
 			}
 		/**
 		 * Если возникает ошибка
@@ -1299,7 +3683,7 @@ bool anyks::Grok::parse(const string & text, const uint64_t cid) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, cid), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -1307,68 +3691,77 @@ bool anyks::Grok::parse(const string & text, const uint64_t cid) noexcept {
 				// Выводим сообщение об ошибке
 				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
 			#endif
+			// Выводим пустой результат
+			return report_t();
 		}
 	}
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод получения счётчиков общего кэша собранных регулярных выражений
+ *
+ * @return счётчики общего кэша
+ */
+anyks::Grok::stat_t anyks::Grok::stat() noexcept {
+	// Выводим счётчики общего кэша
+	return Grok::shared().stat();
+}
+/**
+ * @brief Метод установки максимального количества записей общего кэша собранных регулярных выражений
+ *
+ * @param capacity максимальное количество записей (0 отключает кэш)
+ * @param log      объект для работы с логами
+ */
+void anyks::Grok::capacity(const size_t capacity, const log_t * log) noexcept {
+	// Устанавливаем максимальное количество записей общего кэша
+	Grok::shared().capacity(capacity, log);
+}
 /**
  * @brief Метод извлечения данных в виде JSON
  *
- * @param cid идентификатор записи в кэше
- * @return    json объект дампа данных
+ * @param mapping результат сопоставления текста
+ * @return        json объект дампа данных
  */
-anyks::json anyks::Grok::dump(const uint64_t cid) const noexcept {
+anyks::json anyks::Grok::dump(const mapping_t & mapping) const noexcept {
 	// Результат работы функции
 	json result(kObjectType);
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Выполняем поиск идентификатора регулярного выражения в кэше
-		auto i = this->_cache.find(cid);
-		// Если идентификатор регулярного выражения в кэше найден
-		if(i != this->_cache.end()){
-			// Если схема соответствия ключей сформированна
-			if(!i->second->mapping.empty()){
-				// Выполняем сборку объекта результатов
-				for(auto & item : i->second->mapping){
-					// Если результат получен в виде обычного числа
-					if(this->_fmk->is(item.second, fmk_t::check_t::NUMBER)){
-						/**
-						 * Выполняем отлов ошибок
-						 */
-						try {
-							// Если число положительное
-							if(item.second.front() != '-')
-								// Выполняем конвертацию в число
-								result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(item.second))).Move(), result.GetAllocator());
-							// Выполняем конвертацию в число
-							else result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(item.second))).Move(), result.GetAllocator());
-						/**
-						 * Если возникает ошибка
-						 */
-						} catch(const exception & error) {
-							// Выполняем конвертацию в число
-							result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(item.second.c_str(), item.second.length(), result.GetAllocator()).Move(), result.GetAllocator());
-						}
-					// Если результат получен в виде числа с плавающей точкой
-					} else if(this->_fmk->is(item.second, fmk_t::check_t::DECIMAL)) {
-						/**
-						 * Выполняем отлов ошибок
-						 */
-						try {
-							// Выполняем конвертацию в число с плавающей точкой
-							result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(::stod(item.second)).Move(), result.GetAllocator());
-						/**
-						 * Если возникает ошибка
-						 */
-						} catch(const exception & error) {
-							// Выполняем конвертацию в число
-							result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(item.second.c_str(), item.second.length(), result.GetAllocator()).Move(), result.GetAllocator());
-						}
-					// Формируем результат в формате JSON
-					} else result.AddMember(Value(item.first.c_str(), item.first.length(), result.GetAllocator()).Move(), Value(item.second.c_str(), item.second.length(), result.GetAllocator()).Move(), result.GetAllocator());
+		// Если схема соответствия ключей сформированна
+		if(!mapping.empty()){
+			// Выполняем сборку объекта результатов
+			for(auto & capture : mapping._captures){
+				// Получаем название переменной
+				const string_view name = mapping.name(capture);
+				/**
+				 * Определяем тип сконвертированного значения
+				 */
+				switch(static_cast <uint8_t> (capture.type)){
+					// Если значение является целым числом
+					case static_cast <uint8_t> (type_t::INT):
+						// Добавляем целое число
+						result.AddMember(Value(name.data(), name.size(), result.GetAllocator()).Move(), Value(capture.integer).Move(), result.GetAllocator());
+					break;
+					// Если значение является числом с плавающей точкой
+					case static_cast <uint8_t> (type_t::FLOAT):
+						// Добавляем число с плавающей точкой
+						result.AddMember(Value(name.data(), name.size(), result.GetAllocator()).Move(), Value(capture.decimal).Move(), result.GetAllocator());
+					break;
+					// Если значение является логическим
+					case static_cast <uint8_t> (type_t::BOOL):
+						// Добавляем логическое значение
+						result.AddMember(Value(name.data(), name.size(), result.GetAllocator()).Move(), Value(capture.boolean).Move(), result.GetAllocator());
+					break;
+					// Значения без типа копируются из разобранного текста как они есть
+					default: {
+						// Получаем текст значения
+						const string_view value = mapping.value(capture);
+						// Добавляем строковое значение
+						result.AddMember(Value(name.data(), name.size(), result.GetAllocator()).Move(), Value(value.data(), value.size(), result.GetAllocator()).Move(), result.GetAllocator());
+					}
 				}
 			}
 		}
@@ -1396,29 +3789,28 @@ anyks::json anyks::Grok::dump(const uint64_t cid) const noexcept {
 /**
  * @brief Метод извлечения записи по ключу
  *
- * @param key ключ записи для извлечения
- * @param cid идентификатор записи в кэше
- * @return    значение записи ключа
+ * @param key     ключ записи для извлечения
+ * @param mapping результат сопоставления текста
+ * @return        значение записи ключа
  */
-string anyks::Grok::get(const string & key, const uint64_t cid) const noexcept {
+string anyks::Grok::get(const string & key, const mapping_t & mapping) const noexcept {
 	// Результат работы функции
 	string result = "";
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Выполняем поиск идентификатора регулярного выражения в кэше
-		auto i = this->_cache.find(cid);
-		// Если идентификатор регулярного выражения в кэше найден
-		if(i != this->_cache.end()){
-			// Если ключ записи передан
-			if(!key.empty()){
-				// Выполняем поиск ключа в схеме соответствий
-				auto j = i->second->mapping.find(key);
-				// Если ключ в схеме соответствий найден
-				if(j != i->second->mapping.end())
+		// Если ключ записи передан
+		if(!key.empty()){
+			// Переходим по всем захваченным переменным
+			for(auto & capture : mapping._captures){
+				// Если название переменной совпадает с ключом
+				if(mapping.name(capture) == key){
+					// Получаем текст значения
+					const string_view value = mapping.value(capture);
 					// Выводим результат
-					return j->second;
+					return string(value.data(), value.size());
+				}
 			}
 		}
 	/**
@@ -1430,7 +3822,7 @@ string anyks::Grok::get(const string & key, const uint64_t cid) const noexcept {
 		 */
 		#if DEBUG_MODE
 			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key, cid), log_t::flag_t::CRITICAL, error.what());
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(key), log_t::flag_t::CRITICAL, error.what());
 		/**
 		* Если режим отладки не включён
 		*/
@@ -1443,12 +3835,10 @@ string anyks::Grok::get(const string & key, const uint64_t cid) const noexcept {
 	return result;
 }
 /**
- * @brief Конструктор
+ * @brief Метод добавления базовых шаблонов
  *
- * @param fmk объект фреймворка
- * @param log объект для работы с логами
  */
-anyks::Grok::Grok(const fmk_t * fmk, const log_t * log) noexcept : _fmk(fmk), _log(log) {
+void anyks::Grok::init() noexcept {
 	/**
 	 * Выполняем добавление базовых шаблонов
 	 * https://docs.streamsets.com/platform-datacollector/latest/datacollector/UserGuide/Apx-GrokPatterns/GrokPatterns_title.html
@@ -1762,3 +4152,14 @@ anyks::Grok::Grok(const fmk_t * fmk, const log_t * log) noexcept : _fmk(fmk), _l
 	this->pattern("CISCOFW713172", "Group = %{GREEDYDATA:group}, IP = %{IP:src_ip}, Automatic NAT Detection Status:\\s+Remote end\\s*%{DATA:is_remote_natted}\\s*behind a NAT device\\s+This\\s+end\\s*%{DATA:is_local_natted}\\s*behind a NAT device", event_t::INTERNAL);
 	this->pattern("CISCOFW733100", "\\[\\s*%{DATA:drop_type}\\s*\\] drop %{DATA:drop_rate_id} exceeded. Current burst rate is %{INT:drop_rate_current_burst} per second, max configured rate is %{INT:drop_rate_max_burst}; Current average rate is %{INT:drop_rate_current_avg} per second, max configured rate is %{INT:drop_rate_max_avg}; Cumulative total count is %{INT:drop_total_count}", event_t::INTERNAL);
 }
+/**
+ * @brief Конструктор
+ *
+ * @param fmk объект фреймворка
+ * @param log объект для работы с логами
+ */
+anyks::Grok::Grok(const fmk_t * fmk, const log_t * log) noexcept :
+ _cache(std::make_shared <const caches_t> ()),
+ _multi(std::make_shared <const multis_t> ()), _fmk(fmk), _log(log) {
+	// Базовые шаблоны добавляются при первом использовании или загружаются из пакета
+}
@@ -0,0 +1,226 @@
+/**
+ * @file: mmap.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <mmap.hpp>
+
+/**
+ * Подписываемся на пространство имён awh
+ */
+using namespace awh;
+
+/**
+ * @brief Метод закрытия отображения файла
+ *
+ */
+void anyks::MMap::close() noexcept {
+	/**
+	 * Для операционной системы MS Windows
+	 */
+	#if defined(_WIN32) || defined(_WIN64)
+		// Если данные отображены в память
+		if(this->_data != nullptr)
+			// Выполняем снятие отображения
+			::UnmapViewOfFile(this->_data);
+		// Если отображение файла создано
+		if(this->_mapping != nullptr)
+			// Закрываем дескриптор отображения
+			::CloseHandle(this->_mapping);
+		// Если файл открыт
+		if(this->_file != INVALID_HANDLE_VALUE)
+			// Закрываем дескриптор файла
+			::CloseHandle(this->_file);
+		// Сбрасываем дескриптор отображения
+		this->_mapping = nullptr;
+		// Сбрасываем дескриптор файла
+		this->_file = INVALID_HANDLE_VALUE;
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#else
+		// Если данные отображены в память
+		if(this->_data != nullptr)
+			// Выполняем снятие отображения
+			::munmap(const_cast <char *> (this->_data), this->_size);
+		// Если файл открыт
+		if(this->_fd > -1)
+			// Закрываем файловый дескриптор
+			::close(this->_fd);
+		// Сбрасываем файловый дескриптор
+		this->_fd = -1;
+	#endif
+	// Сбрасываем размер отображённых данных
+	this->_size = 0;
+	// Сбрасываем адрес отображённых данных
+	this->_data = nullptr;
+}
+/**
+ * @brief Метод открытия файла и отображения его в память
+ *
+ * @param filename адрес файла для отображения
+ * @return         результат отображения файла
+ */
+bool anyks::MMap::open(const string & filename) noexcept {
+	// Выполняем закрытие предыдущего отображения
+	this->close();
+	// Если адрес файла передан
+	if(!filename.empty()){
+		/**
+		 * Для операционной системы MS Windows
+		 */
+		#if defined(_WIN32) || defined(_WIN64)
+			// Выполняем открытие файла на чтение
+			this->_file = ::CreateFileW(this->_fmk->convert(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			// Если файл открыт
+			if(this->_file != INVALID_HANDLE_VALUE){
+				// Размер открытого файла
+				LARGE_INTEGER size;
+				// Если размер файла получен
+				if(::GetFileSizeEx(this->_file, &size)){
+					// Устанавливаем размер файла
+					this->_size = static_cast <size_t> (size.QuadPart);
+					// Пустой файл отображать не требуется
+					if(this->_size == 0)
+						// Выводим результат
+						return true;
+					// Выполняем создание отображения файла
+					this->_mapping = ::CreateFileMappingW(this->_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					// Если отображение файла создано
+					if(this->_mapping != nullptr)
+						// Выполняем отображение файла в память
+						this->_data = reinterpret_cast <const char *> (::MapViewOfFile(this->_mapping, FILE_MAP_READ, 0, 0, 0));
+				}
+			}
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#else
+			// Выполняем открытие файла на чтение
+			this->_fd = ::open(filename.c_str(), O_RDONLY);
+			// Если файл открыт
+			if(this->_fd > -1){
+				// Параметры открытого файла
+				struct stat info;
+				// Если параметры файла получены
+				if(::fstat(this->_fd, &info) == 0){
+					// Устанавливаем размер файла
+					this->_size = static_cast <size_t> (info.st_size);
+					// Пустой файл отображать не требуется
+					if(this->_size == 0)
+						// Выводим результат
+						return true;
+					// Выполняем отображение файла в память
+					void * data = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, this->_fd, 0);
+					// Если отображение выполнено
+					if(data != MAP_FAILED){
+						// Устанавливаем адрес отображённых данных
+						this->_data = reinterpret_cast <const char *> (data);
+						// Сообщаем ядру, что файл будет читаться последовательно
+						::madvise(data, this->_size, MADV_SEQUENTIAL);
+					}
+				}
+			}
+		#endif
+		// Если отображение выполнено
+		if(this->_data != nullptr)
+			// Выводим результат
+			return true;
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("File \"%s\" could not be mapped into memory", __PRETTY_FUNCTION__, std::make_tuple(filename), log_t::flag_t::CRITICAL, filename.c_str());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("File \"%s\" could not be mapped into memory", log_t::flag_t::CRITICAL, filename.c_str());
+		#endif
+		// Выполняем закрытие отображения
+		this->close();
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод проверки пустоты отображения
+ *
+ * @return результат проверки
+ */
+bool anyks::MMap::empty() const noexcept {
+	// Выводим результат проверки
+	return (this->_size == 0);
+}
+/**
+ * @brief Метод получения размера отображённых данных
+ *
+ * @return размер отображённых данных
+ */
+size_t anyks::MMap::size() const noexcept {
+	// Выводим размер отображённых данных
+	return this->_size;
+}
+/**
+ * @brief Метод получения адреса отображённых данных
+ *
+ * @return адрес отображённых данных
+ */
+const char * anyks::MMap::data() const noexcept {
+	// Выводим адрес отображённых данных
+	return this->_data;
+}
+/**
+ * @brief Метод получения отображённых данных в виде строки без копирования
+ *
+ * @return отображённые данные
+ */
+string_view anyks::MMap::view() const noexcept {
+	// Если данные отображены в память
+	if(this->_data != nullptr)
+		// Выводим отображённые данные
+		return string_view(this->_data, this->_size);
+	// Выводим пустое значение
+	return string_view();
+}
+/**
+ * @brief Конструктор
+ *
+ * @param fmk объект фреймворка
+ * @param log объект для работы с логами
+ */
+anyks::MMap::MMap(const fmk_t * fmk, const log_t * log) noexcept :
+ _size(0), _data(nullptr),
+/**
+ * Для операционной системы MS Windows
+ */
+#if defined(_WIN32) || defined(_WIN64)
+ _file(INVALID_HANDLE_VALUE), _mapping(nullptr),
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#else
+ _fd(-1),
+#endif
+ _fmk(fmk), _log(log) {}
+/**
+ * @brief Деструктор
+ *
+ */
+anyks::MMap::~MMap() noexcept {
+	// Выполняем закрытие отображения
+	this->close();
+}
@@ -0,0 +1,323 @@
+/**
+ * @file: multiline.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <multiline.hpp>
+
+/**
+ * Подписываемся на пространство имён awh
+ */
+using namespace awh;
+
+/**
+ * @brief Метод проверки, начинает ли строка новое событие
+ *
+ * @param buffer буфер данных строки
+ * @param size   размер буфера данных строки
+ * @return       результат проверки
+ */
+bool anyks::Multiline::start(const char * buffer, const size_t size) const noexcept {
+	// Определяем правило начала события
+	switch(static_cast <uint8_t> (this->_mode)){
+		// Если событие продолжают строки с отступом
+		case static_cast <uint8_t> (mode_t::INDENT):
+			// Строка без отступа начинает новое событие
+			return ((size == 0) || ((buffer[0] != ' ') && (buffer[0] != '\t')));
+		// Если начало события определяется регулярным выражением
+		case static_cast <uint8_t> (mode_t::START): {
+			// Если регулярное выражение не скомпилировано, каждая строка является событием
+			if((this->_reg == nullptr) || (this->_data == nullptr))
+				// Выводим результат
+				return true;
+			// Выполняем сопоставление строки с регулярным выражением начала события
+			return (::pcre2_match(this->_reg, reinterpret_cast <PCRE2_SPTR> (buffer), size, 0, 0, this->_data, nullptr) > 0);
+		}
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод вывода накопленного события
+ *
+ */
+void anyks::Multiline::emit() noexcept {
+	// Пустые строки в конце события являются разделителем событий, а не его частью
+	while(!this->_buffer.empty() && (this->_buffer.back() == '\n'))
+		// Удаляем завершающую пустую строку
+		this->_buffer.pop_back();
+	// Если событие накоплено
+	if(!this->_buffer.empty()){
+		// Если функция обратного вызова установлена
+		if(this->_callback != nullptr)
+			// Выводим полученное событие
+			this->_callback(this->_buffer.data(), this->_buffer.size());
+		// Выполняем очистку буфера события (память сохраняется для следующего события)
+		this->_buffer.clear();
+	}
+	// Сбрасываем количество строк события
+	this->_count = 0;
+}
+/**
+ * @brief Метод очистки данных
+ *
+ */
+void anyks::Multiline::clear() noexcept {
+	// Сбрасываем количество строк события
+	this->_count = 0;
+	// Выполняем очистку буфера текущего события
+	this->_buffer.clear();
+	// Выполняем освобождение выделенной памяти
+	vector <char> ().swap(this->_buffer);
+}
+/**
+ * @brief Метод добавления очередной строки (пустая строка продолжает событие, а при правиле отступов завершает его)
+ *
+ * @param buffer буфер данных строки
+ * @param size   размер буфера данных строки
+ */
+void anyks::Multiline::push(const char * buffer, const size_t size) noexcept {
+	// Если данные переданы или получена пустая строка
+	if((buffer != nullptr) || (size == 0)){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Если получена пустая строка
+			if(size == 0){
+				// Если событие не накапливается, пустую строку продолжать нечем
+				if(this->_count == 0)
+					// Выходим из функции
+					return;
+				// Определяем правило начала события
+				switch(static_cast <uint8_t> (this->_mode)){
+					// Если событие продолжают строки с отступом
+					case static_cast <uint8_t> (mode_t::INDENT):
+						// Пустая строка завершает событие
+						this->emit();
+					break;
+					// Если начало события определяется регулярным выражением
+					case static_cast <uint8_t> (mode_t::START): {
+						// Если событие превысит максимальный размер
+						if((this->_buffer.size() + 1) > this->_bytes)
+							// Выводим накопленное событие
+							this->emit();
+						// Если пустая строка продолжает текущее событие
+						else {
+							// Добавляем пустую строку в событие
+							this->_buffer.push_back('\n');
+							// Запоминаем время получения строки
+							this->_last = std::chrono::steady_clock::now();
+							// Если событие достигло максимального количества строк
+							if(++this->_count >= this->_lines)
+								// Выводим накопленное событие
+								this->emit();
+						}
+					} break;
+				}
+				// Выходим из функции
+				return;
+			}
+			// Если событие уже накапливается
+			if(this->_count > 0){
+				// Если строка начинает новое событие или событие превысит максимальный размер
+				if(this->start(buffer, size) || ((this->_buffer.size() + size + 1) > this->_bytes))
+					// Выводим накопленное событие
+					this->emit();
+				// Если строка продолжает текущее событие
+				else this->_buffer.push_back('\n');
+			}
+			// Добавляем строку в событие
+			this->_buffer.insert(this->_buffer.end(), buffer, buffer + size);
+			// Запоминаем время получения строки
+			this->_last = std::chrono::steady_clock::now();
+			// Если событие достигло максимального количества строк
+			if(++this->_count >= this->_lines)
+				// Выводим накопленное событие
+				this->emit();
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(size), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Выполняем очистку буфера текущего события
+			this->_buffer.clear();
+			// Сбрасываем количество строк события
+			this->_count = 0;
+		}
+	}
+}
+/**
+ * @brief Метод вывода ожидающего события, если время ожидания продолжения истекло
+ *
+ * @return результат вывода события
+ */
+bool anyks::Multiline::idle() noexcept {
+	// Если время ожидания установлено и событие накапливается
+	if((this->_timeout > 0) && (this->_count > 0)){
+		// Получаем время ожидания продолжения события
+		const auto elapsed = std::chrono::duration_cast <std::chrono::milliseconds> (std::chrono::steady_clock::now() - this->_last).count();
+		// Если время ожидания истекло
+		if(static_cast <time_t> (elapsed) >= this->_timeout){
+			// Выводим накопленное событие
+			this->emit();
+			// Выводим результат
+			return true;
+		}
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод завершения потока и вывода последнего события
+ *
+ */
+void anyks::Multiline::finish() noexcept {
+	// Выводим накопленное событие
+	this->emit();
+}
+/**
+ * @brief Метод получения времени ожидания продолжения события
+ *
+ * @return время ожидания в миллисекундах (0 - без ограничения)
+ */
+time_t anyks::Multiline::timeout() const noexcept {
+	// Выводим время ожидания
+	return this->_timeout;
+}
+/**
+ * @brief Метод установки времени ожидания продолжения события
+ *
+ * @param timeout время ожидания в миллисекундах (0 - без ограничения)
+ */
+void anyks::Multiline::timeout(const time_t timeout) noexcept {
+	// Устанавливаем время ожидания
+	this->_timeout = (timeout > 0 ? timeout : 0);
+}
+/**
+ * @brief Метод установки ограничений размера события
+ *
+ * @param lines максимальное количество строк события
+ * @param bytes максимальный размер события в байтах
+ */
+void anyks::Multiline::max(const size_t lines, const size_t bytes) noexcept {
+	// Устанавливаем максимальное количество строк события
+	this->_lines = (lines > 0 ? lines : MULTILINE_LINES);
+	// Устанавливаем максимальный размер события
+	this->_bytes = (bytes > 0 ? bytes : MULTILINE_BYTES);
+}
+/**
+ * @brief Метод установки правила определения начала события по отступам
+ *
+ */
+void anyks::Multiline::indent() noexcept {
+	// Устанавливаем правило определения начала события по отступам
+	this->_mode = mode_t::INDENT;
+}
+/**
+ * @brief Метод установки регулярного выражения начала события
+ *
+ * @param pattern регулярное выражение начала события
+ * @return        результат компиляции регулярного выражения
+ */
+bool anyks::Multiline::pattern(const string & pattern) noexcept {
+	// Если блок результатов сопоставления создан
+	if(this->_data != nullptr){
+		// Выполняем удаление блока результатов
+		::pcre2_match_data_free(this->_data);
+		// Выполняем зануление блока результатов
+		this->_data = nullptr;
+	}
+	// Если регулярное выражение скомпилировано
+	if(this->_reg != nullptr){
+		// Выполняем удаление регулярного выражения
+		::pcre2_code_free(this->_reg);
+		// Выполняем зануление регулярного выражения
+		this->_reg = nullptr;
+	}
+	// Устанавливаем правило определения начала события по регулярному выражению
+	this->_mode = mode_t::START;
+	// Если регулярное выражение передано
+	if(!pattern.empty()){
+		// Код ошибки компиляции
+		int code = 0;
+		// Позиция ошибки в регулярном выражении
+		PCRE2_SIZE offset = 0;
+		// Выполняем компиляцию регулярного выражения
+		this->_reg = ::pcre2_compile(reinterpret_cast <PCRE2_SPTR> (pattern.data()), pattern.size(), PCRE2_UTF, &code, &offset, nullptr);
+		// Если регулярное выражение скомпилировано
+		if(this->_reg != nullptr){
+			// Выполняем JIT-компиляцию (если JIT недоступен, сопоставление выполняется интерпретатором)
+			::pcre2_jit_compile(this->_reg, PCRE2_JIT_COMPLETE);
+			// Выполняем создание блока результатов сопоставления
+			this->_data = ::pcre2_match_data_create_from_pattern(this->_reg, nullptr);
+			// Выводим результат
+			return (this->_data != nullptr);
+		}
+		// Создаём буфер данных для извлечения данных ошибки
+		PCRE2_UCHAR buffer[256];
+		// Выполняем извлечение текста ошибки
+		const int size = ::pcre2_get_error_message(code, buffer, sizeof(buffer));
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(pattern), log_t::flag_t::CRITICAL, (size > 0 ? reinterpret_cast <const char *> (buffer) : "Regular expression is broken"));
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, (size > 0 ? reinterpret_cast <const char *> (buffer) : "Regular expression is broken"));
+		#endif
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод установки функции обратного вызова при получении события
+ *
+ * @param callback функция обратного вызова
+ */
+void anyks::Multiline::on(function <void (const char *, const size_t)> callback) noexcept {
+	// Устанавливаем функцию обратного вызова
+	this->_callback = callback;
+}
+/**
+ * @brief Деструктор
+ *
+ */
+anyks::Multiline::~Multiline() noexcept {
+	// Если блок результатов сопоставления создан
+	if(this->_data != nullptr)
+		// Выполняем удаление блока результатов
+		::pcre2_match_data_free(this->_data);
+	// Если регулярное выражение скомпилировано
+	if(this->_reg != nullptr)
+		// Выполняем удаление регулярного выражения
+		::pcre2_code_free(this->_reg);
+}
@@ -25,13 +25,70 @@ using namespace awh;
  */
 using namespace rapidjson;
 
+/**
+ * Максимальный размер порции данных передаваемой в libxml2 за один вызов
+ */
+static constexpr size_t XML_SLICE_SIZE = 0x100000;
+/**
+ * @brief Структура источника данных XML в памяти
+ *
+ */
+typedef struct XMLSource {
+	// Смещение прочитанных данных
+	size_t offset;
+	// Данные для чтения
+	string_view text;
+	/**
+	 * @brief Конструктор
+	 *
+	 * @param text данные для чтения
+	 */
+	XMLSource(const string_view text) noexcept : offset(0), text(text) {}
+} xml_source_t;
+/**
+ * @brief Функция чтения очередной порции данных XML для libxml2
+ *
+ * @param ctx    контекст источника данных
+ * @param buffer буфер для записи данных
+ * @param size   размер буфера
+ * @return       количество записанных байт
+ */
+static int xmlSourceRead(void * ctx, char * buffer, int size) noexcept {
+	// Получаем объект источника данных
+	xml_source_t * source = reinterpret_cast <xml_source_t *> (ctx);
+	// Если источник данных или буфер не переданы
+	if((source == nullptr) || (buffer == nullptr) || (size <= 0))
+		// Сообщаем, что ничего не прочитано
+		return 0;
+	// Определяем количество копируемых байт, ограничивая его размером порции
+	const size_t bytes = std::min(std::min(static_cast <size_t> (size), XML_SLICE_SIZE), source->text.size() - source->offset);
+	// Выполняем копирование данных в буфер
+	::memcpy(buffer, source->text.data() + source->offset, bytes);
+	// Смещаем позицию чтения
+	source->offset += bytes;
+	// Выводим количество прочитанных байт
+	return static_cast <int> (bytes);
+}
+/**
+ * @brief Функция закрытия источника данных XML для libxml2
+ *
+ * @param ctx контекст источника данных
+ * @return    результат закрытия
+ */
+static int xmlSourceClose(void * ctx) noexcept {
+	// Источником данных владеет вызывающая сторона
+	(void) ctx;
+	// Сообщаем, что закрытие выполнено
+	return 0;
+}
+
 /**
  * @brief Метод сброса списка добавленных шаблонов GROK
  *
  */
 void anyks::Parser::clearPatterns() noexcept {
-	// Выполняем блокировку потока
-	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
 	// Выполняем удаление списка добавленных шаблонов GROK
 	this->_grok.clearPatterns();
 }
@@ -42,8 +99,8 @@ void anyks::Parser::clearPatterns() noexcept {
  * @param val регуляреное выражение соответствующее переменной
  */
 void anyks::Parser::pattern(const string & key, const string & val) noexcept {
-	// Выполняем блокировку потока
-	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
 	// Выполняем добавление шаблона GROK
 	this->_grok.pattern(key, val);
 }
@@ -53,24 +110,65 @@ void anyks::Parser::pattern(const string & key, const string & val) noexcept {
  * @param patterns список поддерживаемых шаблонов
  */
 void anyks::Parser::patterns(const Document & patterns) noexcept {
-	// Выполняем блокировку потока
-	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
 	// Выполняем добавление списка шаблонов
 	this->_grok.patterns(patterns);
 }
+/**
+ * @brief Метод загрузки пакета предварительно собранных шаблонов GROK
+ *
+ * @param filename адрес файла пакета шаблонов
+ * @param stamp    отметка исходных шаблонов, для которых собран пакет
+ * @return         результат загрузки пакета
+ */
+bool anyks::Parser::loadPatterns(const string & filename, const uint64_t stamp) noexcept {
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
+	// Выполняем загрузку пакета шаблонов
+	return this->_grok.loadPatterns(filename, stamp);
+}
+/**
+ * @brief Метод использования шаблонов GROK и собранных регулярных выражений другого парсера без повторной загрузки
+ *
+ * @param parser парсер с загруженными шаблонами GROK
+ * @return       результат установки шаблонов
+ */
+bool anyks::Parser::share(const Parser & parser) noexcept {
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
+	// Выполняем установку шаблонов другого парсера
+	return this->_grok.share(parser._grok);
+}
+/**
+ * @brief Метод сохранения пакета предварительно собранных шаблонов GROK
+ *
+ * @param filename адрес файла пакета шаблонов
+ * @param patterns список регулярных выражений в формате GROK, собираемых в пакет
+ * @param stamp    отметка исходных шаблонов, для которых собран пакет
+ * @return         результат сохранения пакета
+ */
+bool anyks::Parser::savePatterns(const string & filename, const vector <string> & patterns, const uint64_t stamp) noexcept {
+	// Выполняем блокировку модуля GROK
+	const lock_guard <std::mutex> lock(this->_mtx);
+	// Если регулярные выражения переданы
+	if(!patterns.empty())
+		// Выполняем сборку регулярных выражений, чтобы их байт-код попал в пакет
+		this->_grok.build(patterns);
+	// Выполняем сохранение пакета шаблонов
+	return this->_grok.savePatterns(filename, stamp);
+}
 /**
  * @brief Метод конвертации текста в формате YAML в объект JSON
  *
  * @param text текст для конвертации
  * @return     объект в формате JSON
  */
-Document anyks::Parser::yaml(const string & text) noexcept {
+Document anyks::Parser::yaml(const string_view text) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
@@ -238,8 +336,12 @@ Document anyks::Parser::yaml(const string & text) noexcept {
 					} break;
 				}
 			};
+			// Создаём буфер чтения данных без копирования
+			memory_t buffer(text.data(), text.size());
+			// Создаём поток чтения данных из буфера
+			istream stream(&buffer);
 			// Выполняем загрузку текстовых данных YAML
-			YAML::Node node = YAML::Load(text);
+			YAML::Node node = YAML::Load(stream);
 			/**
 			 * Определяем тип полученной ноды
 			 */
@@ -307,7 +409,7 @@ Document anyks::Parser::yaml(const string & text) noexcept {
 					 */
 					#if DEBUG_MODE
 						// Выводим сообщение об ошибке
-						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::WARNING, "Method is undefined");
+						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::WARNING, "Method is undefined");
 					/**
 					* Если режим отладки не включён
 					*/
@@ -326,7 +428,7 @@ Document anyks::Parser::yaml(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -343,7 +445,7 @@ Document anyks::Parser::yaml(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -367,8 +469,6 @@ string anyks::Parser::yaml(const Document & data) noexcept {
 	string result = "";
 	// Если данные переданы
 	if((data.IsObject() && !data.ObjectEmpty()) || (data.IsArray() && !data.Empty())){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
@@ -569,19 +669,17 @@ string anyks::Parser::yaml(const Document & data) noexcept {
  * @param text текст для конвертации
  * @return     объект в формате JSON
  */
-Document anyks::Parser::ini(const string & text) noexcept {
+Document anyks::Parser::ini(const string_view text) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем загрузку INI-конфига
-			ini::File file = ini::load(text);
+			// Выполняем загрузку INI-конфига (модуль INI принимает только строку)
+			ini::File file = ini::load(string(text));
 			// Выполняем перебор всего INI-файла
 			for(auto i = file.begin(); i != file.end(); ++i){
 				// Выполняем установку нового раздела
@@ -644,7 +742,7 @@ Document anyks::Parser::ini(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -668,8 +766,6 @@ string anyks::Parser::ini(const Document & data) noexcept {
 	string result = "";
 	// Если данные переданы
 	if(data.IsObject()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
@@ -752,23 +848,25 @@ string anyks::Parser::ini(const Document & data) noexcept {
  * @param text текст для конвертации
  * @return     объект в формате JSON
  */
-Document anyks::Parser::syslog(const string & text) noexcept {
+Document anyks::Parser::syslog(const string_view text) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
+			// Получаем объект модуля SysLog из пула
+			auto syslog = this->_syslog.get();
 			// Выполняем очистку контейнера
-			this->_syslog.clear();
+			syslog->clear();
 			// Выполняем парсинг данных
-			this->_syslog = text;
+			(* syslog) = string(text);
 			// Выполняем дамп данных в формате JSON
-			return this->_syslog.dump();
+			result = syslog->dump();
+			// Возвращаем объект модуля SysLog в пул
+			this->_syslog.put(syslog);
 		/**
 		 * Если возникает ошибка
 		 */
@@ -778,7 +876,7 @@ Document anyks::Parser::syslog(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -798,20 +896,24 @@ Document anyks::Parser::syslog(const string & text) noexcept {
  * @return     текст после конвертации
  */
 string anyks::Parser::syslog(const Document & data) noexcept {
+	// Результат работы функции
+	string result = "";
 	// Если данные переданы
 	if(data.IsObject()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
+			// Получаем объект модуля SysLog из пула
+			auto syslog = this->_syslog.get();
 			// Выполняем очистку контейнера
-			this->_syslog.clear();
+			syslog->clear();
 			// Устанавливаем полученные данные
-			this->_syslog.dump(data);
+			syslog->dump(data);
 			// Выполняем формирование SysLog
-			return this->_syslog.syslog();
+			result = syslog->syslog();
+			// Возвращаем объект модуля SysLog в пул
+			this->_syslog.put(syslog);
 		/**
 		 * Если возникает ошибка
 		 */
@@ -831,8 +933,8 @@ string anyks::Parser::syslog(const Document & data) noexcept {
 			#endif
 		}
 	}
-	// Выводим результат по умолчанию
-	return "";
+	// Выводим результат
+	return result;
 }
 /**
  * @brief Метод конвертации текста в формате GROK в объект JSON
@@ -841,27 +943,133 @@ string anyks::Parser::syslog(const Document & data) noexcept {
  * @param pattern регулярное выражение в формате GROK
  * @return        объект в формате JSON
  */
-Document anyks::Parser::grok(const string & text, const string & pattern) noexcept {
+Document anyks::Parser::grok(const string_view text, const string & pattern) noexcept {
+	// Если шаблон передан
+	if(!pattern.empty())
+		// Выполняем сопоставление списком из одного выражения (ограничения и их превышения учитываются так же, как для списка)
+		return this->grok(text, vector <string> {pattern});
+	// Выводим пустой результат
+	return Document(kObjectType);
+}
+/**
+ * @brief Метод построчной конвертации текста в формате GROK с однократной сборкой регулярного выражения
+ *
+ * @param text     текст для конвертации (каждая строка является отдельной записью)
+ * @param pattern  регулярное выражение в формате GROK
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество совпавших и не совпавших строк
+ */
+std::pair <size_t, size_t> anyks::Parser::grok(const string_view text, const string & pattern, function <void (const Document &)> callback) noexcept {
+	// Если шаблон передан
+	if(!pattern.empty())
+		// Выполняем сопоставление списком из одного выражения
+		return this->grok(text, vector <string> {pattern}, callback);
+	// Выводим пустой результат
+	return std::make_pair(0, 0);
+}
+/**
+ * @brief Метод конвертации текста в формате GROK первым совпавшим выражением из списка
+ *
+ * @param text     текст для конвертации
+ * @param patterns список регулярных выражений в формате GROK в порядке перебора
+ * @return         объект в формате JSON
+ */
+Document anyks::Parser::grok(const string_view text, const vector <string> & patterns) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
-	// Если текст и шаблон переданы
-	if(!text.empty() && !pattern.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Если текст и шаблоны переданы
+	if(!text.empty() && !patterns.empty()){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем получение регулярного выражения
-			string express = pattern;
-			// Выполняем сборку регулярного выражения
-			const size_t cid = this->_grok.build(express);
-			// Выполняем парсинг данных
-			this->_grok.parse(text, cid);
-			// Выводим полученные данные
-			result = this->_grok.dump(cid);
-			// Выполняем сброс собранных данных
-			this->_grok.reset(cid);
+			// Выполняем сборку набора регулярных выражений (модуль GROK сам защищает сборку от изменения шаблонов)
+			const uint64_t mid = this->_grok.build(patterns);
+			// Результат сопоставления текста
+			grok_t::mapping_t mapping;
+			// Выполняем поиск первого совпавшего выражения без блокировки
+			if(this->_grok.find(text, mid, mapping) > 0)
+				// Выводим полученные данные
+				result = this->_grok.dump(mapping);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), patterns.size()), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод построчной конвертации текста в формате GROK первым совпавшим выражением из списка
+ *
+ * @param text     текст для конвертации (каждая строка является отдельной записью)
+ * @param patterns список регулярных выражений в формате GROK в порядке перебора
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество совпавших и не совпавших строк
+ */
+std::pair <size_t, size_t> anyks::Parser::grok(const string_view text, const vector <string> & patterns, function <void (const Document &)> callback) noexcept {
+	// Результат работы функции
+	std::pair <size_t, size_t> result = {0, 0};
+	// Если текст и шаблоны переданы
+	if(!text.empty() && !patterns.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем сборку набора регулярных выражений один раз для всех строк (модуль GROK сам защищает сборку от изменения шаблонов)
+			const uint64_t mid = this->_grok.build(patterns);
+			// Если набор регулярных выражений собран
+			if(mid > 0){
+				// Результат сопоставления текущей строки
+				grok_t::mapping_t mapping;
+				// Позиция начала и конца текущей строки
+				size_t begin = 0, end = 0;
+				// Выполняем перебор всех строк текста
+				while(begin < text.size()){
+					// Выполняем поиск конца строки
+					const char * found = reinterpret_cast <const char *> (::memchr(text.data() + begin, '\n', text.size() - begin));
+					// Получаем позицию конца строки
+					end = (found != nullptr ? static_cast <size_t> (found - text.data()) : text.size());
+					// Получаем текущую строку
+					string_view line = text.substr(begin, end - begin);
+					// Смещаемся на следующую строку
+					begin = (end + 1);
+					// Удаляем завершающий символ возврата каретки
+					if(!line.empty() && (line.back() == '\r'))
+						// Уменьшаем размер строки
+						line.remove_suffix(1);
+					// Пустые строки записями не являются
+					if(line.empty())
+						// Переходим к следующей строке
+						continue;
+					// Выполняем поиск первого совпавшего выражения
+					if(this->_grok.find(line, mid, mapping) > 0){
+						// Увеличиваем количество совпавших строк
+						result.first++;
+						// Если функция обратного вызова установлена
+						if(callback != nullptr)
+							// Выводим полученную запись
+							callback(this->_grok.dump(mapping));
+						// Выполняем очистку результата сопоставления
+						mapping.clear();
+					// Увеличиваем количество не совпавших строк
+					} else result.second++;
+				}
+			}
 		/**
 		 * Если возникает ошибка
 		 */
@@ -871,7 +1079,7 @@ Document anyks::Parser::grok(const string & text, const string & pattern) noexce
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, pattern), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(patterns.size()), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -884,6 +1092,65 @@ Document anyks::Parser::grok(const string & text, const string & pattern) noexce
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод получения количества совпадений каждого выражения списка GROK
+ *
+ * @param patterns список регулярных выражений в формате GROK
+ * @return         количество совпадений в порядке выражений списка
+ */
+vector <size_t> anyks::Parser::hits(const vector <string> & patterns) noexcept {
+	// Выводим количество совпадений каждого выражения
+	return this->_grok.hits(this->_grok.build(patterns));
+}
+/**
+ * @brief Метод получения количества превышений ограничений каждого выражения списка GROK
+ *
+ * @param patterns список регулярных выражений в формате GROK
+ * @return         количество превышений ограничений в порядке выражений списка
+ */
+vector <size_t> anyks::Parser::timeouts(const vector <string> & patterns) noexcept {
+	// Выводим количество превышений ограничений каждого выражения
+	return this->_grok.timeouts(this->_grok.build(patterns));
+}
+/**
+ * @brief Метод получения количества строк, пропущенных из-за превышения ограничений GROK
+ *
+ * @param patterns список регулярных выражений в формате GROK
+ * @return         количество пропущенных строк
+ */
+size_t anyks::Parser::skipped(const vector <string> & patterns) noexcept {
+	// Выводим количество пропущенных строк
+	return this->_grok.skipped(this->_grok.build(patterns));
+}
+/**
+ * @brief Метод профилирования регулярного выражения GROK на корпусе строк
+ *
+ * @param text    текст корпуса (каждая строка является отдельной записью)
+ * @param pattern регулярное выражение в формате GROK
+ * @return        отчёт профилирования по подшаблонам выражения
+ */
+anyks::grok_t::report_t anyks::Parser::profile(const string_view text, const string & pattern) noexcept {
+	// Выводим отчёт профилирования выражения
+	return this->_grok.profile(pattern, text);
+}
+/**
+ * @brief Метод установки ограничений выполнения регулярных выражений GROK
+ *
+ * @param limits ограничения выполнения регулярных выражений
+ */
+void anyks::Parser::limits(const grok_t::limits_t & limits) noexcept {
+	// Выполняем установку ограничений выполнения
+	this->_grok.limits(limits);
+}
+/**
+ * @brief Метод установки количества потоков парсинга больших текстов CSV
+ *
+ * @param threads количество потоков парсинга
+ */
+void anyks::Parser::threads(const size_t threads) noexcept {
+	// Устанавливаем количество потоков парсинга
+	this->_threads = std::max(threads, static_cast <size_t> (1));
+}
 /**
  * @brief Метод конвертации текста в формате CSV в объект JSON
  *
@@ -891,25 +1158,25 @@ Document anyks::Parser::grok(const string & text, const string & pattern) noexce
  * @param header флаг формирования заголовков
  * @return       объект в формате JSON
  */
-Document anyks::Parser::csv(const string & text, const bool header) noexcept {
+Document anyks::Parser::csv(const string_view text, const bool header) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем очистку контейнера
-			this->_csv.clear();
-			// Выполняем парсинг данных
-			this->_csv = text;
+			// Создаём объект модуля CSV для текущего вызова
+			csv_t csv(this->_fmk, this->_log);
+			// Ячейки нужны только для формирования дампа, храним их в едином буфере
+			csv.storage(csv_t::storage_t::ARENA);
+			// Выполняем парсинг данных (большие тексты разбираются участками параллельно)
+			csv.parse(text, '0', this->_threads);
 			// Работаем с заголовком
-			this->_csv.header(header);
+			csv.header(header);
 			// Выполняем дамп данных в формате JSON
-			return this->_csv.dump();
+			return csv.dump();
 		/**
 		 * Если возникает ошибка
 		 */
@@ -919,7 +1186,7 @@ Document anyks::Parser::csv(const string & text, const bool header) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, header), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), header), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -945,22 +1212,22 @@ string anyks::Parser::csv(const Document & data, const bool header, const char d
 	string result = "";
 	// Если данные переданы
 	if((data.IsObject() && !data.ObjectEmpty()) || (data.IsArray() && !data.Empty())){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем очистку контейнера
-			this->_csv.clear();
+			// Создаём объект модуля CSV для текущего вызова
+			csv_t csv(this->_fmk, this->_log);
+			// Ячейки нужны только для формирования строк, храним их в едином буфере
+			csv.storage(csv_t::storage_t::ARENA);
 			// Работаем с заголовком
-			this->_csv.header(header);
+			csv.header(header);
 			// Выполняем загрузку данных
-			this->_csv.dump(data);
+			csv.dump(data);
 			// Выполняем перебор полученного количества строк
-			for(size_t i = 0; i < this->_csv.rows(); i++){
+			for(size_t i = 0; i < csv.rows(); i++){
 				// Получаем данные для добавления в файл
-				result.append(this->_csv.row(i, delim));
+				result.append(csv.row(i, delim));
 				// Добавляем разделитель строки
 				result.append("\r\n");
 			}
@@ -987,418 +1254,500 @@ string anyks::Parser::csv(const Document & data, const bool header, const char d
 	return result;
 }
 /**
- * @brief Метод конвертации текста в формате XML в объект JSON
+ * @brief Метод потоковой конвертации массива записей в формате JSON в текст в формате CSV
  *
- * @param text текст для конвертации
- * @return     объект в формате JSON
+ * @param text     текст массива записей в формате JSON
+ * @param header   флаг формирования заголовков
+ * @param delim    используемый разделитель
+ * @param callback функция обратного вызова при получении строки CSV
+ * @return         количество выведенных строк
  */
-Document anyks::Parser::xml(const string & text) noexcept {
-	// Результат работы функции
-	Document result(kObjectType);
+size_t anyks::Parser::csv(const string_view text, const bool header, const char delim, function <void (const string &)> callback) noexcept {
+	// Создаём объект писателя CSV
+	tabulator_t tabulator(header, delim, CSV_HEADER_SAMPLE, callback, this->_fmk, this->_log);
+	// Если массив записей разобран полностью
+	if(this->read(text, format_t::JSON, tabulator)){
+		// Если часть значений не попала в заголовки
+		if(tabulator.dropped() > 0){
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%zu values with keys missing from the CSV header were skipped", __PRETTY_FUNCTION__, std::make_tuple(header, delim), log_t::flag_t::WARNING, tabulator.dropped());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%zu values with keys missing from the CSV header were skipped", log_t::flag_t::WARNING, tabulator.dropped());
+			#endif
+		}
+		// Выводим количество выведенных строк
+		return tabulator.rows();
+	}
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод потоковой конвертации текста в формате CSV по отдельным строкам
+ *
+ * @param text     текст для конвертации
+ * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::csv(const string_view text, const bool header, function <void (const Document &)> callback) noexcept {
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Выполняем разбор текста целиком одним блоком
+		return this->csv([&text](csv_t & csv) noexcept -> void {
+			// Выполняем потоковый парсинг текста
+			csv.feed(text.data(), text.size(), '0');
+		}, header, callback);
+	}
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод потоковой конвертации данных в формате CSV из файлового дескриптора по отдельным строкам
+ *
+ * @param fd       файловый дескриптор для чтения данных
+ * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::csv(const int32_t fd, const bool header, function <void (const Document &)> callback) noexcept {
+	// Если файловый дескриптор передан
+	if(fd > -1){
+		// Выполняем разбор данных файлового дескриптора блоками
+		return this->csv([fd](csv_t & csv) noexcept -> void {
+			// Количество прочитанных байт
+			ssize_t bytes = 0;
+			// Буфер для чтения блока данных
+			vector <char> buffer(0x10000);
+			// Выполняем чтение данных порциями
+			while((bytes = ::read(fd, buffer.data(), buffer.size())) != 0){
+				// Если во время чтения произошла ошибка
+				if(bytes < 0){
+					// Если чтение было прервано сигналом, повторяем попытку
+					if(errno == EINTR)
+						// Продолжаем чтение
+						continue;
+					// Выходим из цикла
+					break;
+				}
+				// Выполняем потоковый парсинг полученного блока
+				csv.feed(buffer.data(), static_cast <size_t> (bytes), '0');
+			}
+		}, header, callback);
+	}
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод конвертации строки CSV в запись JSON
+ *
+ * @param row    список ячеек строки
+ * @param header список заголовков (если пустой, запись формируется массивом)
+ * @param result объект JSON для записи результата
+ */
+void anyks::Parser::csv(const vector <string> & row, const vector <string> & header, Document & result) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Получаем аллокатор значений JSON
+		auto & allocator = result.GetAllocator();
+		// Если заголовки переданы
+		if(!header.empty())
+			// Формируем запись в виде объекта
+			result.SetObject();
+		// Формируем запись в виде массива
+		else result.SetArray();
+		// Получаем количество столбцов записи (столбцы без заголовков пропускаются)
+		const size_t count = (header.empty() ? row.size() : std::min(row.size(), header.size()));
+		// Выполняем перебор всех столбцов строки
+		for(size_t i = 0; i < count; i++){
+			// Значение столбца
+			Value value;
+			// Получаем ячейку строки
+			const string & item = row[i];
+			// Если запись является числом
+			if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
+				/**
+				 * Выполняем отлов ошибок
+				 */
+				try {
+					// Если число положительное
+					if(item.front() != '-')
+						// Устанавливаем полученное значение
+						value.SetUint64(static_cast <uint64_t> (::stoull(item)));
+					// Устанавливаем полученное значение
+					else value.SetInt64(static_cast <int64_t> (::stoll(item)));
+				/**
+				 * Если возникает ошибка
+				 */
+				} catch(const exception &) {
+					// Устанавливаем полученное значение как строку
+					value.SetString(item.c_str(), item.length(), allocator);
+				}
+			// Если запись является числом с плавающей точкой
+			} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
+				/**
+				 * Выполняем отлов ошибок
+				 */
+				try {
+					// Устанавливаем полученное значение
+					value.SetDouble(::stod(item));
+				/**
+				 * Если возникает ошибка
+				 */
+				} catch(const exception &) {
+					// Устанавливаем полученное значение как строку
+					value.SetString(item.c_str(), item.length(), allocator);
+				}
+			// Если число является булевым истинным значением
+			} else if(this->_fmk->compare("true", item))
+				// Устанавливаем полученное значение
+				value.SetBool(true);
+			// Если число является булевым ложным значением
+			else if(this->_fmk->compare("false", item))
+				// Устанавливаем полученное значение
+				value.SetBool(false);
+			// Устанавливаем полученное значение как строку
+			else value.SetString(item.c_str(), item.length(), allocator);
+			// Если заголовки не переданы
+			if(header.empty())
+				// Добавляем значение в массив
+				result.PushBack(value, allocator);
+			// Добавляем значение с ключом заголовка
+			else result.AddMember(Value(header[i].c_str(), header[i].length(), allocator).Move(), value, allocator);
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод потоковой конвертации данных в формате CSV по отдельным строкам
+ *
+ * @param source   функция передачи блоков данных в объект модуля CSV
+ * @param header   флаг формирования заголовков (первая строка задаёт ключи записей)
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::csv(function <void (csv_t &)> source, const bool header, function <void (const Document &)> callback) noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если функции обратного вызова переданы
+	if((source != nullptr) && (callback != nullptr)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем поиск первого символа
-			const size_t pos1 = text.find("<");
-			// Выполняем поиск последнего символа
-			const size_t pos2 = text.rfind(">");
-			// Если первый и последний символ получены
-			if((pos1 != string::npos) && (pos2 != string::npos)){
-				// Выполняем парсинг XML скрипта
-				xmlDocPtr doc = xmlParseDoc(reinterpret_cast <const xmlChar *> (text.substr(pos1, (pos2 + 1) - pos1).c_str()));
-				// Если парсинг не выполнен
-				if(doc == nullptr){
-					/**
-					 * Если включён режим отладки
-					 */
-					#if DEBUG_MODE
-						// Выводим сообщение об ошибке
-						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, "Document not parsed successfully");
-					/**
-					* Если режим отладки не включён
-					*/
-					#else
-						// Выводим сообщение об ошибке
-						this->_log->print("%s", log_t::flag_t::CRITICAL, "Document not parsed successfully");
-					#endif
-					// Выводим результат
-					return result;
+			// Флаг получения строки заголовков
+			bool ready = !header;
+			// Список заголовков
+			vector <string> keys;
+			// Создаём объект модуля CSV для текущего вызова
+			csv_t csv(this->_fmk, this->_log);
+			// Устанавливаем функцию обратного вызова для разобранных строк
+			csv.on([&](const vector <string> & row) noexcept -> void {
+				// Если строка заголовков ещё не получена
+				if(!ready){
+					// Запоминаем список заголовков
+					keys = row;
+					// Отмечаем получение заголовков
+					ready = true;
+				// Если получена строка данных
+				} else {
+					// Запись в формате JSON
+					Document record;
+					// Выполняем конвертацию строки в запись
+					this->csv(row, keys, record);
+					// Увеличиваем количество полученных записей
+					result++;
+					// Выводим полученную запись
+					callback(record);
 				}
-				// Выполняем получение корневой ноды
-				xmlNodePtr node = xmlDocGetRootElement(doc);
-				// Если корневая нода получена
-				if(node != nullptr){
-					/**
-					 * @brief Прототип функции парсинга XML документа
-					 *
-					 * @param таблица результатов
-					 * @param объект текущей ноды
-					 * @param аллокатор для копирования
-					 */
-					function <void (Value &, xmlNodePtr, Document::AllocatorType &)> parseFn;
-					/**
-					 * @brief Функция парсинга XML документа
-					 *
-					 * @param root      корень объекта для записи результата
-					 * @param node      объект текущей ноды
-					 * @param allocator аллокатор для копирования
-					 */
-					parseFn = [&parseFn, this](Value & root, xmlNodePtr node, Document::AllocatorType & allocator) noexcept -> void {
-						/**
-						 *  Если переданная нода существует
-						 */
-						while(node != nullptr){
-							// Если нода передана не системная
-							if((node->type == XML_ELEMENT_NODE) && !xmlIsBlankNode(node)){
-								// Если доступны дочерние ноды
-								if(node->xmlChildrenNode != nullptr){
-									// Если есть дочерние элементы у ноды
-									if(xmlChildElementCount(node) > 0){
-										// Если такого ключа ещё не существует в списке
-										if(!root.HasMember(reinterpret_cast <const char *> (node->name))){
-											// Документ для извлечения данных
-											Document result(kObjectType);
-											// Выполняем парсинг ноды дальше
-											parseFn(result, node->xmlChildrenNode, result.GetAllocator());
-											// Создаём объект контейнера для помещения в него данных XML
-											root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
-											// Извлекаем полученные данные объекта
-											root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, allocator);
-										// Если текущий ключ не является массивом
-										} else if(!root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-											// Документ для извлечения данных
-											Document result(kArrayType);
-											// Добавляем в массив полученное значение
-											result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
-											// Добавляем пустой объект в список
-											result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
-											// Выполняем парсинг ноды дальше
-											parseFn(result[result.Size() - 1], node->xmlChildrenNode, result.GetAllocator());
-											// Создаём из текущего объекта массив
-											root[reinterpret_cast <const char *> (node->name)].SetArray();
-											// Копируем полученный результат
-											root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, allocator);
-										// Если текущий ключ уже является массивом
-										} else {
-											// Получаем количество элементов в массиве
-											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-											// Выполняем создание объекта внутри массива
-											root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
-											// Выполняем парсинг ноды дальше
-											parseFn(root[reinterpret_cast <const char *> (node->name)][size], node->xmlChildrenNode, allocator);
-										}
-										// Если у ноды есть параметры
-										if(node->properties != nullptr){
-											// Получаем список атрибутов
-											xmlAttr * attribute = node->properties;
+			});
+			// Выполняем передачу блоков данных на потоковый парсинг
+			source(csv);
+			// Завершаем потоковый парсинг и выводим последнюю строку
+			csv.finish();
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(header), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод конвертации ноды XML в объект JSON
+ *
+ * @param node   нода XML для конвертации
+ * @param result объект JSON для записи результата
+ */
+void anyks::Parser::xml(xmlNodePtr node, Document & result) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Если корневая нода получена
+		if(node != nullptr){
+			/**
+			 * @brief Прототип функции парсинга XML документа
+			 *
+			 * @param таблица результатов
+			 * @param объект текущей ноды
+			 * @param аллокатор для копирования
+			 */
+			function <void (Value &, xmlNodePtr, Document::AllocatorType &)> parseFn;
+			/**
+			 * @brief Функция парсинга XML документа
+			 *
+			 * @param root      корень объекта для записи результата
+			 * @param node      объект текущей ноды
+			 * @param allocator аллокатор для копирования
+			 */
+			parseFn = [&parseFn, this](Value & root, xmlNodePtr node, Document::AllocatorType & allocator) noexcept -> void {
+				/**
+				 *  Если переданная нода существует
+				 */
+				while(node != nullptr){
+					// Если нода передана не системная
+					if((node->type == XML_ELEMENT_NODE) && !xmlIsBlankNode(node)){
+						// Если доступны дочерние ноды
+						if(node->xmlChildrenNode != nullptr){
+							// Если есть дочерние элементы у ноды
+							if(xmlChildElementCount(node) > 0){
+								// Если такого ключа ещё не существует в списке
+								if(!root.HasMember(reinterpret_cast <const char *> (node->name))){
+									// Документ для извлечения данных
+									Document result(kObjectType);
+									// Выполняем парсинг ноды дальше
+									parseFn(result, node->xmlChildrenNode, result.GetAllocator());
+									// Создаём объект контейнера для помещения в него данных XML
+									root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
+									// Извлекаем полученные данные объекта
+									root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, allocator);
+								// Если текущий ключ не является массивом
+								} else if(!root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+									// Документ для извлечения данных
+									Document result(kArrayType);
+									// Добавляем в массив полученное значение
+									result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
+									// Добавляем пустой объект в список
+									result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
+									// Выполняем парсинг ноды дальше
+									parseFn(result[result.Size() - 1], node->xmlChildrenNode, result.GetAllocator());
+									// Создаём из текущего объекта массив
+									root[reinterpret_cast <const char *> (node->name)].SetArray();
+									// Копируем полученный результат
+									root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, allocator);
+								// Если текущий ключ уже является массивом
+								} else {
+									// Получаем количество элементов в массиве
+									const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+									// Выполняем создание объекта внутри массива
+									root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
+									// Выполняем парсинг ноды дальше
+									parseFn(root[reinterpret_cast <const char *> (node->name)][size], node->xmlChildrenNode, allocator);
+								}
+								// Если у ноды есть параметры
+								if(node->properties != nullptr){
+									// Получаем список атрибутов
+									xmlAttr * attribute = node->properties;
+									/**
+									 *  Выполняем перебор всего списка атрибутов
+									 */
+									while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
+										// Выполняем получение значения
+										xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
+										// Если полученное значение является числом
+										if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
 											/**
-											 *  Выполняем перебор всего списка атрибутов
+											 * Выполняем отлов ошибок
 											 */
-											while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
-												// Выполняем получение значения
-												xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
-												// Если полученное значение является числом
-												if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
-													/**
-													 * Выполняем отлов ошибок
-													 */
-													try {
-														// Если число является отрицательным
-														if(reinterpret_cast <const char *> (value)[0] == '-'){
-															// Если элемент не является массивом
-															if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-																// Выполняем формирования списка параметров
-																root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															// Иначе добавляем в указанный индекс массива
-															else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-																// Получаем количество элементов в массиве
-																const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-																// Выполняем добавление названия атрибута
-																root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															}
-														// Если число является положительным
-														} else {
-															// Если элемент не является массивом
-															if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-																// Выполняем формирования списка параметров
-																root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															// Иначе добавляем в указанный индекс массива
-															else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-																// Получаем количество элементов в массиве
-																const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-																// Выполняем добавление названия атрибута
-																root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															}
-														}
-													/**
-													 * Если возникает ошибка
-													 */
-													} catch(const exception &) {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
-													}
-												// Если полученное значение является числом с плавающей точкой
-												} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
-													/**
-													 * Выполняем отлов ошибок
-													 */
-													try {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-														}
-													/**
-													 * Если возникает ошибка
-													 */
-													} catch(const exception &) {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
+											try {
+												// Если число является отрицательным
+												if(reinterpret_cast <const char *> (value)[0] == '-'){
+													// Если элемент не является массивом
+													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+														// Выполняем формирования списка параметров
+														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
+													// Иначе добавляем в указанный индекс массива
+													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+														// Получаем количество элементов в массиве
+														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+														// Выполняем добавление названия атрибута
+														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													}
-												// Если полученное значения является строкой
+												// Если число является положительным
 												} else {
-													// Флаг булевого значения
-													bool flag = false;
-													// Если строка является булевым значением
-													if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-														}
-													// Если значение является обычной строкой
-													} else {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
+													// Если элемент не является массивом
+													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+														// Выполняем формирования списка параметров
+														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
+													// Иначе добавляем в указанный индекс массива
+													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+														// Получаем количество элементов в массиве
+														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+														// Выполняем добавление названия атрибута
+														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													}
 												}
-												// Выполняем итерацию по аттрибутам
-												attribute = attribute->next;
-												// Выполняем освобождение памяти выделенной под значение
-												xmlFree(value);
-											}
-										}
-									// Если дочерних элементов нет
-									} else {
-										// Если корневой элемент не является объектом
-										if(!root.IsObject())
-											// Устанавливаем тип JSON как объект
-											root.SetObject();
-										// Если такой ключ уже существует
-										if(root.HasMember(reinterpret_cast <const char *> (node->name))){
-											// Если ключ не является массивом
-											if(!root[reinterpret_cast <const char *> (node->name)].IsArray()){
-												// Документ для извлечения данных
-												Document result(kArrayType);
-												// Добавляем в массив полученное значение
-												result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
-												// Добавляем пустой объект в список
-												result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
-												// Создаём из текущего объекта массив
-												root[reinterpret_cast <const char *> (node->name)].SetArray();
-												// Копируем полученный результат
-												root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, result.GetAllocator());
-											// Выполняем создание объекта внутри массива
-											} else root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
-										// Если такой ключ ещё не существует
-										} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
-										// Если у ноды есть параметры
-										if(node->properties != nullptr){
-											// Получаем список атрибутов
-											xmlAttr * attribute = node->properties;
 											/**
-											 *  Выполняем перебор всего списка атрибутов
+											 * Если возникает ошибка
 											 */
-											while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
-												// Выполняем получение значения
-												xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
-												// Если полученное значение является числом
-												if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
-													/**
-													 * Выполняем отлов ошибок
-													 */
-													try {
-														// Если число является отрицательным
-														if(reinterpret_cast <const char *> (value)[0] == '-'){
-															// Если элемент не является массивом
-															if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-																// Выполняем формирования списка параметров
-																root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															// Иначе добавляем в указанный индекс массива
-															else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-																// Получаем количество элементов в массиве
-																const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-																// Выполняем добавление названия атрибута
-																root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															}
-														// Если число является положительным
-														} else {
-															// Если элемент не является массивом
-															if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-																// Выполняем формирования списка параметров
-																root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															// Иначе добавляем в указанный индекс массива
-															else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-																// Получаем количество элементов в массиве
-																const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-																// Выполняем добавление названия атрибута
-																root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-															}
-														}
-													/**
-													 * Если возникает ошибка
-													 */
-													} catch(const exception &) {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
-													}
-												// Если полученное значение является числом с плавающей точкой
-												} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
-													/**
-													 * Выполняем отлов ошибок
-													 */
-													try {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-														}
-													/**
-													 * Если возникает ошибка
-													 */
-													} catch(const exception &) {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
-													}
-												// Если полученное значения является строкой
-												} else {
-													// Флаг булевого значения
-													bool flag = false;
-													// Если строка является булевым значением
-													if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-														}
-													// Если значение является обычной строкой
-													} else {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-														}
-													}
+											} catch(const exception &) {
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												}
-												// Выполняем итерацию по аттрибутам
-												attribute = attribute->next;
-												// Выполняем освобождение памяти выделенной под значение
-												xmlFree(value);
 											}
-										}
-										// Получаем ключ записи
-										string key("value");
-										// Если элемент не является массивом
-										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+										// Если полученное значение является числом с плавающей точкой
+										} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
 											/**
-											 *  Если такой ключ уже существует в объекте
+											 * Выполняем отлов ошибок
 											 */
-											while(root[reinterpret_cast <const char *> (node->name)].HasMember(key.c_str()))
-												// Выполняем изменение ключа
-												key.insert(key.begin(), '_');
-										// Иначе добавляем в указанный индекс массива
-										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-											// Получаем количество элементов в массиве
-											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+											try {
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
+												}
 											/**
-											 *  Если такой ключ уже существует в объекте
+											 * Если возникает ошибка
 											 */
-											while(root[reinterpret_cast <const char *> (node->name)][size - 1].HasMember(key.c_str()))
-												// Выполняем изменение ключа
-												key.insert(key.begin(), '_');
+											} catch(const exception &) {
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+												}
+											}
+										// Если полученное значения является строкой
+										} else {
+											// Флаг булевого значения
+											bool flag = false;
+											// Если строка является булевым значением
+											if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
+												}
+											// Если значение является обычной строкой
+											} else {
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+												}
+											}
 										}
+										// Выполняем итерацию по аттрибутам
+										attribute = attribute->next;
+										// Выполняем освобождение памяти выделенной под значение
+										xmlFree(value);
+									}
+								}
+							// Если дочерних элементов нет
+							} else {
+								// Если корневой элемент не является объектом
+								if(!root.IsObject())
+									// Устанавливаем тип JSON как объект
+									root.SetObject();
+								// Если такой ключ уже существует
+								if(root.HasMember(reinterpret_cast <const char *> (node->name))){
+									// Если ключ не является массивом
+									if(!root[reinterpret_cast <const char *> (node->name)].IsArray()){
+										// Документ для извлечения данных
+										Document result(kArrayType);
+										// Добавляем в массив полученное значение
+										result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
+										// Добавляем пустой объект в список
+										result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
+										// Создаём из текущего объекта массив
+										root[reinterpret_cast <const char *> (node->name)].SetArray();
+										// Копируем полученный результат
+										root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, result.GetAllocator());
+									// Выполняем создание объекта внутри массива
+									} else root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
+								// Если такой ключ ещё не существует
+								} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
+								// Если у ноды есть параметры
+								if(node->properties != nullptr){
+									// Получаем список атрибутов
+									xmlAttr * attribute = node->properties;
+									/**
+									 *  Выполняем перебор всего списка атрибутов
+									 */
+									while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
 										// Выполняем получение значения
-										xmlChar * value = xmlNodeListGetString(node->doc, node->xmlChildrenNode, 1);
+										xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
 										// Если полученное значение является числом
 										if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
 											/**
@@ -1408,44 +1757,28 @@ Document anyks::Parser::xml(const string & text) noexcept {
 												// Если число является отрицательным
 												if(reinterpret_cast <const char *> (value)[0] == '-'){
 													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-														// Если у ноды есть параметры
-														if(node->properties != nullptr)
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Выполняем установку полученного значения
-														else root[reinterpret_cast <const char *> (node->name)].SetInt64(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value))));
+													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+														// Выполняем формирования списка параметров
+														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													// Иначе добавляем в указанный индекс массива
-													} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 														// Получаем количество элементов в массиве
 														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Если у ноды есть параметры
-														if(node->properties != nullptr)
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Выполняем установку полученного значения
-														else root[reinterpret_cast <const char *> (node->name)][size - 1].SetInt64(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value))));
+														// Выполняем добавление названия атрибута
+														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													}
 												// Если число является положительным
 												} else {
 													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-														// Если у ноды есть параметры
-														if(node->properties != nullptr)
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Выполняем установку полученного значения
-														else root[reinterpret_cast <const char *> (node->name)].SetUint64(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value))));
+													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+														// Выполняем формирования списка параметров
+														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													// Иначе добавляем в указанный индекс массива
-													} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 														// Получаем количество элементов в массиве
 														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Если у ноды есть параметры
-														if(node->properties != nullptr)
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Выполняем установку полученного значения
-														else root[reinterpret_cast <const char *> (node->name)][size - 1].SetUint64(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value))));
+														// Выполняем добавление названия атрибута
+														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
 													}
 												}
 											/**
@@ -1453,23 +1786,15 @@ Document anyks::Parser::xml(const string & text) noexcept {
 											 */
 											} catch(const exception &) {
 												// Если элемент не является массивом
-												if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												// Иначе добавляем в указанный индекс массива
-												} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 													// Получаем количество элементов в массиве
 													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												}
 											}
 										// Если полученное значение является числом с плавающей точкой
@@ -1479,561 +1804,790 @@ Document anyks::Parser::xml(const string & text) noexcept {
 											 */
 											try {
 												// Если элемент не является массивом
-												if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)].SetDouble(::stod(reinterpret_cast <const char *> (value)));
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
 												// Иначе добавляем в указанный индекс массива
-												} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 													// Получаем количество элементов в массиве
 													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)][size - 1].SetDouble(::stod(reinterpret_cast <const char *> (value)));
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
 												}
 											/**
 											 * Если возникает ошибка
 											 */
 											} catch(const exception &) {
 												// Если элемент не является массивом
-												if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												// Иначе добавляем в указанный индекс массива
-												} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 													// Получаем количество элементов в массиве
 													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												}
 											}
-										// Если значение не является числом
+										// Если полученное значения является строкой
 										} else {
 											// Флаг булевого значения
 											bool flag = false;
 											// Если строка является булевым значением
 											if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
 												// Если элемент не является массивом
-												if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(flag).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)].SetBool(flag);
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
 												// Иначе добавляем в указанный индекс массива
-												} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 													// Получаем количество элементов в массиве
 													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(flag).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)][size - 1].SetBool(flag);
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
 												}
 											// Если значение является обычной строкой
 											} else {
 												// Если элемент не является массивом
-												if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												// Иначе добавляем в указанный индекс массива
-												} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 													// Получаем количество элементов в массиве
 													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-													// Если у ноды есть параметры
-													if(node->properties != nullptr)
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Выполняем установку полученного значения
-													else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 												}
 											}
 										}
+										// Выполняем итерацию по аттрибутам
+										attribute = attribute->next;
 										// Выполняем освобождение памяти выделенной под значение
 										xmlFree(value);
 									}
-								// Если дочерних элементов не обнаружено
-								} else {
-									// Если корневой элемент не является объектом
-									if(!root.IsObject())
-										// Устанавливаем тип JSON как объект
-										root.SetObject();
-									// Если у ноды есть параметры
-									if(node->properties != nullptr){
-										// Если такой ключ уже существует
-										if(root.HasMember(reinterpret_cast <const char *> (node->name))){
-											// Если ключ не является массивом
-											if(!root[reinterpret_cast <const char *> (node->name)].IsArray()){
-												// Документ для извлечения данных
-												Document result(kArrayType);
-												// Добавляем в массив полученное значение
-												result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
-												// Добавляем пустой объект в список
-												result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
-												// Создаём из текущего объекта массив
-												root[reinterpret_cast <const char *> (node->name)].SetArray();
-												// Копируем полученный результат
-												root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, result.GetAllocator());
-											// Выполняем создание объекта внутри массива
-											} else root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
-										// Если такой ключ ещё не существует
-										} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
-										// Получаем список атрибутов
-										xmlAttr * attribute = node->properties;
-										/**
-										 *  Выполняем перебор всего списка атрибутов
-										 */
-										while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
-											// Выполняем получение значения
-											xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
-											// Если полученное значение является числом
-											if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
-												/**
-												 * Выполняем отлов ошибок
-												 */
-												try {
-													// Если число является отрицательным
-													if(reinterpret_cast <const char *> (value)[0] == '-'){
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														}
-													// Если число является положительным
-													} else {
-														// Если элемент не является массивом
-														if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-															// Выполняем формирования списка параметров
-															root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														// Иначе добавляем в указанный индекс массива
-														else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-															// Получаем количество элементов в массиве
-															const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-															// Выполняем добавление названия атрибута
-															root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
-														}
-													}
-												/**
-												 * Если возникает ошибка
-												 */
-												} catch(const exception &) {
-													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Иначе добавляем в указанный индекс массива
-													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-														// Получаем количество элементов в массиве
-														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													}
-												}
-											// Если полученное значение является числом с плавающей точкой
-											} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
-												/**
-												 * Выполняем отлов ошибок
-												 */
-												try {
-													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-													// Иначе добавляем в указанный индекс массива
-													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-														// Получаем количество элементов в массиве
-														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
-													}
-												/**
-												 * Если возникает ошибка
-												 */
-												} catch(const exception &) {
-													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Иначе добавляем в указанный индекс массива
-													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-														// Получаем количество элементов в массиве
-														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													}
-												}
-											// Если значение является строковым
-											} else {
-												// Флаг булевого значения
-												bool flag = false;
-												// Если строка является булевым значением
-												if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
-													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-													// Иначе добавляем в указанный индекс массива
-													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-														// Получаем количество элементов в массиве
-														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
-													}
-												// Если значение является обычной строкой
-												} else {
-													// Если элемент не является массивом
-													if(root[reinterpret_cast <const char *> (node->name)].IsObject())
-														// Выполняем формирования списка параметров
-														root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													// Иначе добавляем в указанный индекс массива
-													else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
-														// Получаем количество элементов в массиве
-														const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
-														// Выполняем добавление названия атрибута
-														root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
-													}
-												}
+								}
+								// Получаем ключ записи
+								string key("value");
+								// Если элемент не является массивом
+								if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+									/**
+									 *  Если такой ключ уже существует в объекте
+									 */
+									while(root[reinterpret_cast <const char *> (node->name)].HasMember(key.c_str()))
+										// Выполняем изменение ключа
+										key.insert(key.begin(), '_');
+								// Иначе добавляем в указанный индекс массива
+								} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+									// Получаем количество элементов в массиве
+									const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+									/**
+									 *  Если такой ключ уже существует в объекте
+									 */
+									while(root[reinterpret_cast <const char *> (node->name)][size - 1].HasMember(key.c_str()))
+										// Выполняем изменение ключа
+										key.insert(key.begin(), '_');
+								}
+								// Выполняем получение значения
+								xmlChar * value = xmlNodeListGetString(node->doc, node->xmlChildrenNode, 1);
+								// Если полученное значение является числом
+								if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
+									/**
+									 * Выполняем отлов ошибок
+									 */
+									try {
+										// Если число является отрицательным
+										if(reinterpret_cast <const char *> (value)[0] == '-'){
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+												// Если у ноды есть параметры
+												if(node->properties != nullptr)
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Выполняем установку полученного значения
+												else root[reinterpret_cast <const char *> (node->name)].SetInt64(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value))));
+											// Иначе добавляем в указанный индекс массива
+											} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Если у ноды есть параметры
+												if(node->properties != nullptr)
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Выполняем установку полученного значения
+												else root[reinterpret_cast <const char *> (node->name)][size - 1].SetInt64(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value))));
+											}
+										// Если число является положительным
+										} else {
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+												// Если у ноды есть параметры
+												if(node->properties != nullptr)
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Выполняем установку полученного значения
+												else root[reinterpret_cast <const char *> (node->name)].SetUint64(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value))));
+											// Иначе добавляем в указанный индекс массива
+											} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Если у ноды есть параметры
+												if(node->properties != nullptr)
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Выполняем установку полученного значения
+												else root[reinterpret_cast <const char *> (node->name)][size - 1].SetUint64(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value))));
 											}
-											// Выполняем итерацию по аттрибутам
-											attribute = attribute->next;
-											// Выполняем освобождение памяти выделенной под значение
-											xmlFree(value);
 										}
-									// Если тег просто присутствует в списке
-									} else {
-										// Если указанный ключ существует в корневом разделе
-										if(root.HasMember(reinterpret_cast <const char *> (node->name))){
-											// Если корневой объект не является массивом
-											if(!root[reinterpret_cast <const char *> (node->name)].IsArray())
-												// Устанавливаем значение как булевое
-												root[reinterpret_cast <const char *> (node->name)].SetBool(true);
-										// Создаём булевое значение с положительным вложением
-										} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kTrueType).Move(), allocator);
+									/**
+									 * Если возникает ошибка
+									 */
+									} catch(const exception &) {
+										// Если элемент не является массивом
+										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
+										// Иначе добавляем в указанный индекс массива
+										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+											// Получаем количество элементов в массиве
+											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
+										}
 									}
-								}
-							}
-							// Выполняем итерацию ноды
-							node = node->next;
-						}
-					};
-					// Устанавливаем в корневой объект наш первый параметр
-					result.AddMember(Value(reinterpret_cast <const char *> (node->name), result.GetAllocator()).Move(), Value(kObjectType).Move(), result.GetAllocator());
-					// Если у ноды есть параметры
-					if(node->properties != nullptr){
-						// Получаем список атрибутов
-						xmlAttr * attribute = node->properties;
-						/**
-						 *  Выполняем перебор всего списка атрибутов
-						 */
-						while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
-							// Выполняем получение значения
-							xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
-							// Если полученное значение является числом
-							if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
-								/**
-								 * Выполняем отлов ошибок
-								 */
-								try {
-									// Если число является отрицательным
-									if(reinterpret_cast <const char *> (value)[0] == '-')
-										// Выполняем формирования списка параметров
-										result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), result.GetAllocator());
-									// Выполняем формирования списка параметров
-									else result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), result.GetAllocator());
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Выполняем формирования списка параметров
-									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
-								}
-							// Если полученное значение является числом с плавающей точкой
-							} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
-								/**
-								 * Выполняем отлов ошибок
-								 */
-								try {
-									// Выполняем формирования списка параметров
-									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), result.GetAllocator());
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Выполняем формирования списка параметров
-									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
-								}
-							// Если значение является строковым
-							} else {
-								// Флаг булевого значения
-								bool flag = false;
-								// Если строка является булевым значением
-								if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value)))
-									// Выполняем формирования списка параметров
-									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
-								// Выполняем формирования списка параметров
-								else result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
-							}
-							// Выполняем итерацию по аттрибутам
-							attribute = attribute->next;
-							// Выполняем освобождение памяти выделенной под значение
-							xmlFree(value);
-						}
-					}
-					// Выполняем получение значения
-					xmlChar * value = xmlNodeListGetString(node->doc, node->xmlChildrenNode, 1);
-					// Если значение ноды существует
-					if(value != nullptr){
-						// Получаем значение текущего блока данных
-						const string item = reinterpret_cast <const char *> (value);
-						// Выполняем удаление всех лишних символов
-						this->_fmk->transform(item, fmk_t::transform_t::TRIM);
-						// Если значение получено
-						if(!item.empty()){
-							// Получаем ключ записи
-							string key("value");
-							// Если элемент не является массивом
-							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-								/**
-								 *  Если такой ключ уже существует в объекте
-								 */
-								while(result[reinterpret_cast <const char *> (node->name)].HasMember(key.c_str()))
-									// Выполняем изменение ключа
-									key.insert(key.begin(), '_');
-							// Иначе добавляем в указанный индекс массива
-							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-								// Получаем количество элементов в массиве
-								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-								/**
-								 *  Если такой ключ уже существует в объекте
-								 */
-								while(result[reinterpret_cast <const char *> (node->name)][size - 1].HasMember(key.c_str()))
-									// Выполняем изменение ключа
-									key.insert(key.begin(), '_');
-							}
-							// Если полученное значение является числом
-							if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
-								/**
-								 * Выполняем отлов ошибок
-								 */
-								try {
-									// Если число является отрицательным
-									if(item.front() == '-'){
+								// Если полученное значение является числом с плавающей точкой
+								} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
+									/**
+									 * Выполняем отлов ошибок
+									 */
+									try {
 										// Если элемент не является массивом
-										if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
 											// Если у ноды есть параметры
 											if(node->properties != nullptr)
 												// Выполняем формирования списка параметров
-												result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
 											// Выполняем установку полученного значения
-											else result[reinterpret_cast <const char *> (node->name)].SetInt64(static_cast <int64_t> (::stoll(item)));
+											else root[reinterpret_cast <const char *> (node->name)].SetDouble(::stod(reinterpret_cast <const char *> (value)));
 										// Иначе добавляем в указанный индекс массива
-										} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 											// Получаем количество элементов в массиве
-											const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
 											// Если у ноды есть параметры
 											if(node->properties != nullptr)
 												// Выполняем добавление названия атрибута
-												result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
 											// Выполняем установку полученного значения
-											else result[reinterpret_cast <const char *> (node->name)][size - 1].SetInt64(static_cast <int64_t> (::stoll(item)));
+											else root[reinterpret_cast <const char *> (node->name)][size - 1].SetDouble(::stod(reinterpret_cast <const char *> (value)));
 										}
-									// Если число является положительным
-									} else {
+									/**
+									 * Если возникает ошибка
+									 */
+									} catch(const exception &) {
 										// Если элемент не является массивом
-										if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
 											// Если у ноды есть параметры
 											if(node->properties != nullptr)
 												// Выполняем формирования списка параметров
-												result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 											// Выполняем установку полученного значения
-											else result[reinterpret_cast <const char *> (node->name)].SetUint64(static_cast <uint64_t> (::stoull(item)));
+											else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
 										// Иначе добавляем в указанный индекс массива
-										} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
 											// Получаем количество элементов в массиве
-											const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
 											// Если у ноды есть параметры
 											if(node->properties != nullptr)
 												// Выполняем добавление названия атрибута
-												result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
 											// Выполняем установку полученного значения
-											else result[reinterpret_cast <const char *> (node->name)][size - 1].SetUint64(static_cast <uint64_t> (::stoull(item)));
+											else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
 										}
 									}
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Если элемент не является массивом
-									if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем формирования списка параметров
-											result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
-									// Иначе добавляем в указанный индекс массива
-									} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-										// Получаем количество элементов в массиве
-										const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем добавление названия атрибута
-											result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
+								// Если значение не является числом
+								} else {
+									// Флаг булевого значения
+									bool flag = false;
+									// Если строка является булевым значением
+									if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
+										// Если элемент не является массивом
+										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(flag).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)].SetBool(flag);
+										// Иначе добавляем в указанный индекс массива
+										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+											// Получаем количество элементов в массиве
+											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(flag).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)][size - 1].SetBool(flag);
+										}
+									// Если значение является обычной строкой
+									} else {
+										// Если элемент не является массивом
+										if(root[reinterpret_cast <const char *> (node->name)].IsObject()){
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)].SetString(reinterpret_cast <const char *> (value), allocator);
+										// Иначе добавляем в указанный индекс массива
+										} else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+											// Получаем количество элементов в массиве
+											const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+											// Если у ноды есть параметры
+											if(node->properties != nullptr)
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Выполняем установку полученного значения
+											else root[reinterpret_cast <const char *> (node->name)][size - 1].SetString(reinterpret_cast <const char *> (value), allocator);
+										}
 									}
 								}
-							// Если полученное значение является числом с плавающей точкой
-							} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
+								// Выполняем освобождение памяти выделенной под значение
+								xmlFree(value);
+							}
+						// Если дочерних элементов не обнаружено
+						} else {
+							// Если корневой элемент не является объектом
+							if(!root.IsObject())
+								// Устанавливаем тип JSON как объект
+								root.SetObject();
+							// Если у ноды есть параметры
+							if(node->properties != nullptr){
+								// Если такой ключ уже существует
+								if(root.HasMember(reinterpret_cast <const char *> (node->name))){
+									// Если ключ не является массивом
+									if(!root[reinterpret_cast <const char *> (node->name)].IsArray()){
+										// Документ для извлечения данных
+										Document result(kArrayType);
+										// Добавляем в массив полученное значение
+										result.PushBack(Value(root[reinterpret_cast <const char *> (node->name)], result.GetAllocator()), result.GetAllocator());
+										// Добавляем пустой объект в список
+										result.PushBack(Value(kObjectType).Move(), result.GetAllocator());
+										// Создаём из текущего объекта массив
+										root[reinterpret_cast <const char *> (node->name)].SetArray();
+										// Копируем полученный результат
+										root[reinterpret_cast <const char *> (node->name)].CopyFrom(result, result.GetAllocator());
+									// Выполняем создание объекта внутри массива
+									} else root[reinterpret_cast <const char *> (node->name)].PushBack(Value(kObjectType).Move(), allocator);
+								// Если такой ключ ещё не существует
+								} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kObjectType).Move(), allocator);
+								// Получаем список атрибутов
+								xmlAttr * attribute = node->properties;
 								/**
-								 * Выполняем отлов ошибок
+								 *  Выполняем перебор всего списка атрибутов
 								 */
-								try {
-									// Если элемент не является массивом
-									if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем формирования списка параметров
-											result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(::stod(item)).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)].SetDouble(::stod(item));
-									// Иначе добавляем в указанный индекс массива
-									} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-										// Получаем количество элементов в массиве
-										const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем добавление названия атрибута
-											result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(::stod(item)).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)][size - 1].SetDouble(::stod(item));
-									}
-								/**
-								 * Если возникает ошибка
-								 */
-								} catch(const exception &) {
-									// Если элемент не является массивом
-									if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем формирования списка параметров
-											result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
-									// Иначе добавляем в указанный индекс массива
-									} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-										// Получаем количество элементов в массиве
-										const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем добавление названия атрибута
-											result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
+								while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
+									// Выполняем получение значения
+									xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
+									// Если полученное значение является числом
+									if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
+										/**
+										 * Выполняем отлов ошибок
+										 */
+										try {
+											// Если число является отрицательным
+											if(reinterpret_cast <const char *> (value)[0] == '-'){
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												}
+											// Если число является положительным
+											} else {
+												// Если элемент не является массивом
+												if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+													// Выполняем формирования списка параметров
+													root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												// Иначе добавляем в указанный индекс массива
+												else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+													// Получаем количество элементов в массиве
+													const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+													// Выполняем добавление названия атрибута
+													root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), allocator);
+												}
+											}
+										/**
+										 * Если возникает ошибка
+										 */
+										} catch(const exception &) {
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Иначе добавляем в указанный индекс массива
+											else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											}
+										}
+									// Если полученное значение является числом с плавающей точкой
+									} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
+										/**
+										 * Выполняем отлов ошибок
+										 */
+										try {
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
+											// Иначе добавляем в указанный индекс массива
+											else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), allocator);
+											}
+										/**
+										 * Если возникает ошибка
+										 */
+										} catch(const exception &) {
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Иначе добавляем в указанный индекс массива
+											else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											}
+										}
+									// Если значение является строковым
+									} else {
+										// Флаг булевого значения
+										bool flag = false;
+										// Если строка является булевым значением
+										if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value))){
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
+											// Иначе добавляем в указанный индекс массива
+											else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(flag).Move(), allocator);
+											}
+										// Если значение является обычной строкой
+										} else {
+											// Если элемент не является массивом
+											if(root[reinterpret_cast <const char *> (node->name)].IsObject())
+												// Выполняем формирования списка параметров
+												root[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											// Иначе добавляем в указанный индекс массива
+											else if(root[reinterpret_cast <const char *> (node->name)].IsArray()) {
+												// Получаем количество элементов в массиве
+												const SizeType size = root[reinterpret_cast <const char *> (node->name)].Size();
+												// Выполняем добавление названия атрибута
+												root[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(reinterpret_cast <const char *> (attribute->name), allocator).Move(), Value(reinterpret_cast <const char *> (value), allocator).Move(), allocator);
+											}
+										}
 									}
+									// Выполняем итерацию по аттрибутам
+									attribute = attribute->next;
+									// Выполняем освобождение памяти выделенной под значение
+									xmlFree(value);
 								}
-							// Если значение не является числом
+							// Если тег просто присутствует в списке
 							} else {
-								// Флаг булевого значения
-								bool flag = false;
-								// Если строка является булевым значением
-								if((flag = this->_fmk->compare("true", item)) || this->_fmk->compare("false", item)){
-									// Если элемент не является массивом
-									if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем формирования списка параметров
-											result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)].SetBool(flag);
-									// Иначе добавляем в указанный индекс массива
-									} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-										// Получаем количество элементов в массиве
-										const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем добавление названия атрибута
-											result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)][size - 1].SetBool(flag);
-									}
-								// Если значение является обычной строкой
-								} else {
-									// Если элемент не является массивом
-									if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем формирования списка параметров
-											result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
-									// Иначе добавляем в указанный индекс массива
-									} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
-										// Получаем количество элементов в массиве
-										const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
-										// Если у ноды есть параметры
-										if(node->properties != nullptr)
-											// Выполняем добавление названия атрибута
-											result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
-										// Выполняем установку полученного значения
-										else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
-									}
+								// Если указанный ключ существует в корневом разделе
+								if(root.HasMember(reinterpret_cast <const char *> (node->name))){
+									// Если корневой объект не является массивом
+									if(!root[reinterpret_cast <const char *> (node->name)].IsArray())
+										// Устанавливаем значение как булевое
+										root[reinterpret_cast <const char *> (node->name)].SetBool(true);
+								// Создаём булевое значение с положительным вложением
+								} else root.AddMember(Value(reinterpret_cast <const char *> (node->name), allocator).Move(), Value(kTrueType).Move(), allocator);
+							}
+						}
+					}
+					// Выполняем итерацию ноды
+					node = node->next;
+				}
+			};
+			// Устанавливаем в корневой объект наш первый параметр
+			result.AddMember(Value(reinterpret_cast <const char *> (node->name), result.GetAllocator()).Move(), Value(kObjectType).Move(), result.GetAllocator());
+			// Если у ноды есть параметры
+			if(node->properties != nullptr){
+				// Получаем список атрибутов
+				xmlAttr * attribute = node->properties;
+				/**
+				 *  Выполняем перебор всего списка атрибутов
+				 */
+				while((attribute != nullptr) && (attribute->name != nullptr) && (attribute->children != nullptr)){
+					// Выполняем получение значения
+					xmlChar * value = xmlNodeListGetString(node->doc, attribute->children, 1);
+					// Если полученное значение является числом
+					if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::NUMBER)){
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Если число является отрицательным
+							if(reinterpret_cast <const char *> (value)[0] == '-')
+								// Выполняем формирования списка параметров
+								result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(reinterpret_cast <const char *> (value)))).Move(), result.GetAllocator());
+							// Выполняем формирования списка параметров
+							else result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(reinterpret_cast <const char *> (value)))).Move(), result.GetAllocator());
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const exception &) {
+							// Выполняем формирования списка параметров
+							result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
+						}
+					// Если полученное значение является числом с плавающей точкой
+					} else if(this->_fmk->is(reinterpret_cast <const char *> (value), fmk_t::check_t::DECIMAL)) {
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Выполняем формирования списка параметров
+							result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(::stod(reinterpret_cast <const char *> (value))).Move(), result.GetAllocator());
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const exception &) {
+							// Выполняем формирования списка параметров
+							result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
+						}
+					// Если значение является строковым
+					} else {
+						// Флаг булевого значения
+						bool flag = false;
+						// Если строка является булевым значением
+						if((flag = this->_fmk->compare("true", reinterpret_cast <const char *> (value))) || this->_fmk->compare("false", reinterpret_cast <const char *> (value)))
+							// Выполняем формирования списка параметров
+							result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
+						// Выполняем формирования списка параметров
+						else result[reinterpret_cast <const char *> (node->name)].AddMember(Value(reinterpret_cast <const char *> (attribute->name), result.GetAllocator()).Move(), Value(reinterpret_cast <const char *> (value), result.GetAllocator()).Move(), result.GetAllocator());
+					}
+					// Выполняем итерацию по аттрибутам
+					attribute = attribute->next;
+					// Выполняем освобождение памяти выделенной под значение
+					xmlFree(value);
+				}
+			}
+			// Выполняем получение значения
+			xmlChar * value = xmlNodeListGetString(node->doc, node->xmlChildrenNode, 1);
+			// Если значение ноды существует
+			if(value != nullptr){
+				// Получаем значение текущего блока данных
+				const string item = reinterpret_cast <const char *> (value);
+				// Выполняем удаление всех лишних символов
+				this->_fmk->transform(item, fmk_t::transform_t::TRIM);
+				// Если значение получено
+				if(!item.empty()){
+					// Получаем ключ записи
+					string key("value");
+					// Если элемент не является массивом
+					if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+						/**
+						 *  Если такой ключ уже существует в объекте
+						 */
+						while(result[reinterpret_cast <const char *> (node->name)].HasMember(key.c_str()))
+							// Выполняем изменение ключа
+							key.insert(key.begin(), '_');
+					// Иначе добавляем в указанный индекс массива
+					} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+						// Получаем количество элементов в массиве
+						const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+						/**
+						 *  Если такой ключ уже существует в объекте
+						 */
+						while(result[reinterpret_cast <const char *> (node->name)][size - 1].HasMember(key.c_str()))
+							// Выполняем изменение ключа
+							key.insert(key.begin(), '_');
+					}
+					// Если полученное значение является числом
+					if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Если число является отрицательным
+							if(item.front() == '-'){
+								// Если элемент не является массивом
+								if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+									// Если у ноды есть параметры
+									if(node->properties != nullptr)
+										// Выполняем формирования списка параметров
+										result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
+									// Выполняем установку полученного значения
+									else result[reinterpret_cast <const char *> (node->name)].SetInt64(static_cast <int64_t> (::stoll(item)));
+								// Иначе добавляем в указанный индекс массива
+								} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+									// Получаем количество элементов в массиве
+									const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+									// Если у ноды есть параметры
+									if(node->properties != nullptr)
+										// Выполняем добавление названия атрибута
+										result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <int64_t> (::stoll(item))).Move(), result.GetAllocator());
+									// Выполняем установку полученного значения
+									else result[reinterpret_cast <const char *> (node->name)][size - 1].SetInt64(static_cast <int64_t> (::stoll(item)));
 								}
+							// Если число является положительным
+							} else {
+								// Если элемент не является массивом
+								if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+									// Если у ноды есть параметры
+									if(node->properties != nullptr)
+										// Выполняем формирования списка параметров
+										result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
+									// Выполняем установку полученного значения
+									else result[reinterpret_cast <const char *> (node->name)].SetUint64(static_cast <uint64_t> (::stoull(item)));
+								// Иначе добавляем в указанный индекс массива
+								} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+									// Получаем количество элементов в массиве
+									const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+									// Если у ноды есть параметры
+									if(node->properties != nullptr)
+										// Выполняем добавление названия атрибута
+										result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(static_cast <uint64_t> (::stoull(item))).Move(), result.GetAllocator());
+									// Выполняем установку полученного значения
+									else result[reinterpret_cast <const char *> (node->name)][size - 1].SetUint64(static_cast <uint64_t> (::stoull(item)));
+								}
+							}
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const exception &) {
+							// Если элемент не является массивом
+							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем формирования списка параметров
+									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
+							// Иначе добавляем в указанный индекс массива
+							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+								// Получаем количество элементов в массиве
+								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем добавление названия атрибута
+									result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
+							}
+						}
+					// Если полученное значение является числом с плавающей точкой
+					} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Если элемент не является массивом
+							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем формирования списка параметров
+									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(::stod(item)).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)].SetDouble(::stod(item));
+							// Иначе добавляем в указанный индекс массива
+							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+								// Получаем количество элементов в массиве
+								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем добавление названия атрибута
+									result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(::stod(item)).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)][size - 1].SetDouble(::stod(item));
+							}
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const exception &) {
+							// Если элемент не является массивом
+							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем формирования списка параметров
+									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
+							// Иначе добавляем в указанный индекс массива
+							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+								// Получаем количество элементов в массиве
+								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем добавление названия атрибута
+									result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
+							}
+						}
+					// Если значение не является числом
+					} else {
+						// Флаг булевого значения
+						bool flag = false;
+						// Если строка является булевым значением
+						if((flag = this->_fmk->compare("true", item)) || this->_fmk->compare("false", item)){
+							// Если элемент не является массивом
+							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем формирования списка параметров
+									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)].SetBool(flag);
+							// Иначе добавляем в указанный индекс массива
+							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+								// Получаем количество элементов в массиве
+								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем добавление названия атрибута
+									result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(flag).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)][size - 1].SetBool(flag);
+							}
+						// Если значение является обычной строкой
+						} else {
+							// Если элемент не является массивом
+							if(result[reinterpret_cast <const char *> (node->name)].IsObject()){
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем формирования списка параметров
+									result[reinterpret_cast <const char *> (node->name)].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)].SetString(item.c_str(), item.length(), result.GetAllocator());
+							// Иначе добавляем в указанный индекс массива
+							} else if(result[reinterpret_cast <const char *> (node->name)].IsArray()) {
+								// Получаем количество элементов в массиве
+								const SizeType size = result[reinterpret_cast <const char *> (node->name)].Size();
+								// Если у ноды есть параметры
+								if(node->properties != nullptr)
+									// Выполняем добавление названия атрибута
+									result[reinterpret_cast <const char *> (node->name)][size - 1].AddMember(Value(key.c_str(), key.length(), result.GetAllocator()).Move(), Value(item.c_str(), item.length(), result.GetAllocator()).Move(), result.GetAllocator());
+								// Выполняем установку полученного значения
+								else result[reinterpret_cast <const char *> (node->name)][size - 1].SetString(item.c_str(), item.length(), result.GetAllocator());
 							}
 						}
-						// Выполняем освобождение памяти выделенной под значение
-						xmlFree(value);
-						// Выполняем парсинг всего XML объекта
-						parseFn(result[reinterpret_cast <const char *> (node->name)], node->xmlChildrenNode, result.GetAllocator());
 					}
-				// Сообщаем, что переданные данные не соответствуют ожидаемым
-				} else {
+				}
+				// Выполняем освобождение памяти выделенной под значение
+				xmlFree(value);
+				// Выполняем парсинг всего XML объекта
+				parseFn(result[reinterpret_cast <const char *> (node->name)], node->xmlChildrenNode, result.GetAllocator());
+			}
+		// Сообщаем, что переданные данные не соответствуют ожидаемым
+		} else {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::WARNING, "Data received is not as expected");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::WARNING, "Data received is not as expected");
+			#endif
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод конвертации текста в формате XML в объект JSON
+ *
+ * @param text текст для конвертации
+ * @return     объект в формате JSON
+ */
+Document anyks::Parser::xml(const string_view text) noexcept {
+	// Результат работы функции
+	Document result(kObjectType);
+	// Если текст передан
+	if(!text.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем поиск первого символа
+			const size_t pos1 = text.find("<");
+			// Выполняем поиск последнего символа
+			const size_t pos2 = text.rfind(">");
+			// Если первый и последний символ получены
+			if((pos1 != string::npos) && (pos2 != string::npos)){
+				// Создаём источник данных из переданного буфера
+				xml_source_t source(text.substr(pos1, (pos2 + 1) - pos1));
+				// Выполняем парсинг XML скрипта порциями, размер буфера может превышать INT_MAX
+				xmlDocPtr doc = xmlReadIO(&xmlSourceRead, &xmlSourceClose, &source, nullptr, nullptr, (source.text.size() > static_cast <size_t> (INT_MAX) ? XML_PARSE_HUGE : 0));
+				// Если парсинг не выполнен
+				if(doc == nullptr){
 					/**
 					 * Если включён режим отладки
 					 */
 					#if DEBUG_MODE
 						// Выводим сообщение об ошибке
-						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::WARNING, "Data received is not as expected");
+						this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, "Document not parsed successfully");
 					/**
 					* Если режим отладки не включён
 					*/
 					#else
 						// Выводим сообщение об ошибке
-						this->_log->print("%s", log_t::flag_t::WARNING, "Data received is not as expected");
+						this->_log->print("%s", log_t::flag_t::CRITICAL, "Document not parsed successfully");
 					#endif
+					// Выводим результат
+					return result;
 				}
+				// Выполняем конвертирование корневой ноды
+				this->xml(xmlDocGetRootElement(doc), result);
 				// Выполняем очистку выделенной памяти под ноду
 				// xmlFreeNode(node);
 				// Выполняем очистку выделенных данных парсера
 				xmlFreeDoc(doc);
-				// Выполняем очистку глобальных параметров парсера
-				xmlCleanupParser();
 			// Сообщаем, что переданные данные не соответствуют ожидаемым
 			} else {
 				/**
@@ -2041,7 +2595,7 @@ Document anyks::Parser::xml(const string & text) noexcept {
 				 */
 				#if DEBUG_MODE
 					// Выводим сообщение об ошибке
-					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::WARNING, "Data received is not as expected");
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::WARNING, "Data received is not as expected");
 				/**
 				* Если режим отладки не включён
 				*/
@@ -2059,7 +2613,7 @@ Document anyks::Parser::xml(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -2072,6 +2626,129 @@ Document anyks::Parser::xml(const string & text) noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод чтения записей XML из потокового читателя
+ *
+ * @param reader   потоковый читатель XML
+ * @param record   название повторяющегося элемента записи
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::xml(xmlTextReaderPtr reader, const string & record, function <void (const Document &)> callback) noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если потоковый читатель передан
+	if(reader != nullptr){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем чтение первой ноды
+			int32_t status = xmlTextReaderRead(reader);
+			// Выполняем чтение всех нод документа
+			while(status == 1){
+				// Если найден открывающий элемент записи
+				if((xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT) && (record.compare(reinterpret_cast <const char *> (xmlTextReaderConstName(reader))) == 0)){
+					// Выполняем чтение всего поддерева записи
+					xmlNodePtr node = xmlTextReaderExpand(reader);
+					// Если поддерево записи получено
+					if(node != nullptr){
+						// Объект записи в формате JSON
+						Document item(kObjectType);
+						// Выполняем конвертирование ноды записи
+						this->xml(node, item);
+						// Увеличиваем количество полученных записей
+						result++;
+						// Если функция обратного вызова установлена
+						if(callback != nullptr)
+							// Выводим полученную запись
+							callback(item);
+					}
+					// Переходим к следующей ноде минуя поддерево записи, память которого освобождается читателем
+					status = xmlTextReaderNext(reader);
+				// Переходим к следующей ноде
+				} else status = xmlTextReaderRead(reader);
+			}
+			// Если при чтении документа произошла ошибка
+			if(status < 0){
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(record), log_t::flag_t::WARNING, "XML document is not well-formed");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::WARNING, "XML document is not well-formed");
+				#endif
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(record), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+		// Выполняем освобождение памяти потокового читателя
+		xmlFreeTextReader(reader);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод потоковой конвертации текста в формате XML по отдельным записям
+ *
+ * @param text     текст для конвертации
+ * @param record   название повторяющегося элемента записи
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::xml(const string_view text, const string & record, function <void (const Document &)> callback) noexcept {
+	// Если текст и название записи переданы
+	if(!text.empty() && !record.empty()){
+		// Выполняем поиск первого символа
+		const size_t pos = text.find("<");
+		// Если первый символ найден
+		if(pos != string::npos){
+			// Создаём источник данных из переданного буфера, он живёт до освобождения читателя
+			xml_source_t source(text.substr(pos));
+			// Выполняем чтение записей порциями, размер буфера может превышать INT_MAX
+			return this->xml(xmlReaderForIO(&xmlSourceRead, &xmlSourceClose, &source, nullptr, nullptr, XML_PARSE_HUGE), record, callback);
+		}
+	}
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод потоковой конвертации данных в формате XML из файлового дескриптора по отдельным записям
+ *
+ * @param fd       файловый дескриптор для чтения данных
+ * @param record   название повторяющегося элемента записи
+ * @param callback функция обратного вызова при получении записи
+ * @return         количество полученных записей
+ */
+size_t anyks::Parser::xml(const int32_t fd, const string & record, function <void (const Document &)> callback) noexcept {
+	// Если файловый дескриптор и название записи переданы
+	if((fd > -1) && !record.empty())
+		// Выполняем чтение записей из файлового дескриптора
+		return this->xml(xmlReaderForFd(fd, nullptr, nullptr, XML_PARSE_HUGE), record, callback);
+	// Выводим результат
+	return 0;
+}
 /**
  * @brief Метод конвертации объекта JSON в текст в формате XML
  *
@@ -2084,8 +2761,6 @@ string anyks::Parser::xml(const Document & data, const bool prettify) noexcept {
 	string result = "";
 	// Если данные переданы
 	if((data.IsObject() && !data.ObjectEmpty()) || (data.IsArray() && !data.Empty())){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
@@ -3197,25 +3872,23 @@ string anyks::Parser::xml(const Document & data, const bool prettify) noexcept {
  * @param text текст для конвертации
  * @return     объект в формате JSON
  */
-Document anyks::Parser::json(const string & text) noexcept {
+Document anyks::Parser::json(const string_view text) noexcept {
 	// Результат работы функции
 	Document result(kObjectType);
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
 			// Выполняем парсинг полученных текстовых данных
-			if(result.Parse(text.c_str(), text.size()).HasParseError()){
+			if(result.Parse(text.data(), text.size()).HasParseError()){
 				/**
 				 * Если включён режим отладки
 				 */
 				#if DEBUG_MODE
 					// Выводим сообщение об ошибке
-					this->_log->debug("Parsing JSON: (offset %d): %s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, result.GetErrorOffset(), GetParseError_En(result.GetParseError()));
+					this->_log->debug("Parsing JSON: (offset %d): %s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, result.GetErrorOffset(), GetParseError_En(result.GetParseError()));
 				/**
 				* Если режим отладки не включён
 				*/
@@ -3233,7 +3906,7 @@ Document anyks::Parser::json(const string & text) noexcept {
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -3256,8 +3929,6 @@ Document anyks::Parser::json(const string & text) noexcept {
 string anyks::Parser::json(const Document & data, const bool prettify) noexcept {
 	// Если данные переданы
 	if((data.IsObject() && !data.ObjectEmpty()) || (data.IsArray() && !data.Empty())){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
@@ -3304,31 +3975,814 @@ string anyks::Parser::json(const Document & data, const bool prettify) noexcept
 	return "";
 }
 /**
- * @brief Метод конвертации текста в формате CEF в объект JSON
+ * @brief Метод конвертации текста в формате CEF в объект JSON
+ *
+ * @param text текст для конвертации
+ * @param mode режим парсинга
+ * @return     объект в формате JSON
+ */
+Document anyks::Parser::cef(const string_view text, const cef_t::mode_t mode) noexcept {
+	// Результат работы функции
+	Document result(kObjectType);
+	// Если текст передан
+	if(!text.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем объект модуля CEF из пула
+			auto cef = this->_cef.get();
+			// Выполняем очистку объекта
+			cef->clear();
+			// Устанавливаем строгий режим работы
+			cef->mode(mode);
+			// Выполняем парсинг текста
+			(* cef) = string(text);
+			// Получаем полученный результат
+			result = cef->dump();
+			// Возвращаем объект модуля CEF в пул
+			this->_cef.put(cef);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), static_cast <uint16_t> (mode)), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод конвертации объекта JSON в текст в формате CEF
+ *
+ * @param data данные в объекте JSON
+ * @param mode режим парсинга
+ * @return     текст после конвертации
+ */
+string anyks::Parser::cef(const Document & data, const cef_t::mode_t mode) noexcept {
+	// Результат работы функции
+	string result = "";
+	// Если данные переданы
+	if(data.IsObject() && !data.ObjectEmpty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем объект модуля CEF из пула
+			auto cef = this->_cef.get();
+			// Выполняем очистку объекта
+			cef->clear();
+			// Устанавливаем строгий режим работы
+			cef->mode(mode);
+			// Устанавливаем полученные данные обратно
+			cef->dump(data);
+			// Получаем полученный результат
+			result = cef->cef();
+			// Возвращаем объект модуля CEF в пул
+			this->_cef.put(cef);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод подготовки вывода очередного значения
+ *
+ */
+void anyks::Parser::Emitter::value() noexcept {
+	// Если значение выводится внутри объекта или массива
+	if(!this->_levels.empty()){
+		// Получаем текущий уровень вложенности
+		level_t & level = this->_levels.back();
+		// Если вывод уровня ещё не начат
+		if(!level.begin){
+			// Если уровень является объектом
+			if(level.map)
+				// Выполняем начало вывода объекта
+				this->_emitter << YAML::BeginMap;
+			// Выполняем начало вывода массива
+			else this->_emitter << YAML::BeginSeq;
+			// Запоминаем, что вывод уровня начат
+			level.begin = true;
+		}
+		// Если значение выводится внутри объекта
+		if(level.map && this->_pending)
+			// Выполняем вывод ключа ожидающего значения
+			this->_emitter << YAML::Key << this->_key << YAML::Value;
+	}
+	// Снимаем флаг наличия ключа ожидающего значения
+	this->_pending = false;
+}
+/**
+ * @brief Метод получения результата
+ *
+ * @return текст в формате YAML
+ */
+string anyks::Parser::Emitter::get() const noexcept {
+	// Если генерация YAML выполнена без ошибок
+	if(this->_emitter.good())
+		// Выводим полученный результат
+		return string(this->_emitter.c_str(), this->_emitter.size());
+	// Выводим пустой результат
+	return "";
+}
+/**
+ * @brief Метод обработки пустого значения
  *
- * @param text текст для конвертации
- * @param mode режим парсинга
- * @return     объект в формате JSON
+ * @return результат обработки
+ */
+bool anyks::Parser::Emitter::Null() noexcept {
+	// Пустые значения в YAML не выводятся, вместе с ними удаляется и ключ
+	this->_pending = false;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки булевого значения
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Bool(const bool value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки отрицательного 32-х битного числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Int(const int32_t value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки положительного 32-х битного числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Uint(const uint32_t value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки отрицательного 64-х битного числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Int64(const int64_t value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки положительного 64-х битного числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Uint64(const uint64_t value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки числа с плавающей точкой
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::Double(const double value) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << value;
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки числа в текстовом виде
+ *
+ * @param str    текст числа
+ * @param length длина текста числа
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Emitter::RawNumber(const char * str, const SizeType length, const bool copy) noexcept {
+	// Выполняем вывод числа как строки
+	return this->String(str, length, copy);
+}
+/**
+ * @brief Метод обработки строкового значения
+ *
+ * @param str    текст значения
+ * @param length длина текста значения
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Emitter::String(const char * str, const SizeType length, const bool) noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Выполняем вывод значения
+	this->_emitter << string(str, length);
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки начала объекта
+ *
+ * @return результат обработки
+ */
+bool anyks::Parser::Emitter::StartObject() noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Добавляем новый уровень вложенности (вывод начинается с первого значения)
+	this->_levels.emplace_back(true);
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки ключа объекта
+ *
+ * @param str    текст ключа
+ * @param length длина текста ключа
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Emitter::Key(const char * str, const SizeType length, const bool) noexcept {
+	// Запоминаем ключ до получения значения
+	this->_key.assign(str, length);
+	// Устанавливаем флаг наличия ключа ожидающего значения
+	this->_pending = true;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки завершения объекта
+ *
+ * @param count количество элементов объекта
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::EndObject(const SizeType) noexcept {
+	// Если уровень вложенности существует
+	if(!this->_levels.empty()){
+		// Если вывод объекта был начат
+		if(this->_levels.back().begin)
+			// Выполняем завершение вывода объекта
+			this->_emitter << YAML::EndMap;
+		// Если пустой объект является вложенным, выводим его как пустое значение
+		else if(this->_levels.size() > 1)
+			// Выполняем вывод пустого значения
+			this->_emitter << YAML::Null;
+		// Удаляем уровень вложенности
+		this->_levels.pop_back();
+	}
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки начала массива
+ *
+ * @return результат обработки
+ */
+bool anyks::Parser::Emitter::StartArray() noexcept {
+	// Выполняем подготовку вывода значения
+	this->value();
+	// Добавляем новый уровень вложенности (вывод начинается с первого значения)
+	this->_levels.emplace_back(false);
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод обработки завершения массива
+ *
+ * @param count количество элементов массива
+ * @return      результат обработки
+ */
+bool anyks::Parser::Emitter::EndArray(const SizeType) noexcept {
+	// Если уровень вложенности существует
+	if(!this->_levels.empty()){
+		// Если вывод массива был начат
+		if(this->_levels.back().begin)
+			// Выполняем завершение вывода массива
+			this->_emitter << YAML::EndSeq;
+		// Если пустой массив является вложенным, выводим его как пустое значение
+		else if(this->_levels.size() > 1)
+			// Выполняем вывод пустого значения
+			this->_emitter << YAML::Null;
+		// Удаляем уровень вложенности
+		this->_levels.pop_back();
+	}
+	// Выводим результат
+	return this->_emitter.good();
+}
+/**
+ * @brief Метод вывода строки CSV
+ *
+ * @param cols список столбцов строки
+ */
+void anyks::Parser::Tabulator::emit(const vector <string> & cols) noexcept {
+	// Увеличиваем количество выведенных строк
+	this->_rows++;
+	// Если функция обратного вызова установлена
+	if(this->_callback != nullptr)
+		// Выводим сформированную строку
+		this->_callback(this->_csv.row(cols, this->_delim));
+}
+/**
+ * @brief Метод вывода записи массива
+ *
+ * @param record запись для вывода
+ */
+void anyks::Parser::Tabulator::write(const record_t & record) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Если запись является объектом
+		if(record.map){
+			// Список столбцов строки в порядке заголовков
+			vector <string> cols(this->_keys.size());
+			// Выполняем перебор всех значений записи
+			for(auto & item : record.cols){
+				// Выполняем поиск столбца по ключу
+				auto i = this->_index.find(item.first);
+				// Если столбец найден
+				if(i != this->_index.end())
+					// Устанавливаем значение столбца
+					cols.at(i->second) = item.second;
+				// Увеличиваем количество пропущенных значений
+				else this->_dropped++;
+			}
+			// Выводим сформированную строку
+			this->emit(cols);
+		// Если запись является массивом
+		} else {
+			// Список столбцов строки
+			vector <string> cols;
+			// Выделяем память под столбцы
+			cols.reserve(record.cols.size());
+			// Выполняем перебор всех значений записи
+			for(auto & item : record.cols)
+				// Добавляем значение столбца
+				cols.push_back(item.second);
+			// Выводим сформированную строку
+			this->emit(cols);
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception &) {
+		// Увеличиваем количество пропущенных значений
+		this->_dropped += record.cols.size();
+	}
+}
+/**
+ * @brief Метод определения заголовков и вывода накопленных записей
+ *
+ */
+void anyks::Parser::Tabulator::prepare() noexcept {
+	// Если заголовки ещё не определены
+	if(!this->_ready){
+		// Запоминаем, что заголовки определены
+		this->_ready = true;
+		// Выполняем перебор всех накопленных записей
+		for(auto & record : this->_buffer){
+			// Если запись является объектом
+			if(record.map){
+				// Выполняем перебор всех ключей записи
+				for(auto & item : record.cols){
+					// Если такого заголовка ещё нет
+					if(this->_index.emplace(item.first, this->_keys.size()).second)
+						// Добавляем заголовок в порядке появления
+						this->_keys.push_back(item.first);
+				}
+			}
+		}
+		// Если заголовки требуется вывести
+		if(this->_header && !this->_keys.empty())
+			// Выводим строку заголовков
+			this->emit(this->_keys);
+		// Выполняем перебор всех накопленных записей
+		for(auto & record : this->_buffer)
+			// Выводим накопленную запись
+			this->write(record);
+		// Выполняем освобождение памяти накопленных записей
+		vector <record_t> ().swap(this->_buffer);
+	}
+}
+/**
+ * @brief Метод завершения текущей записи
+ *
+ */
+void anyks::Parser::Tabulator::commit() noexcept {
+	// Если заголовки уже определены
+	if(this->_ready)
+		// Выводим запись сразу
+		this->write(this->_record);
+	// Если заголовки ещё не определены
+	else {
+		// Добавляем запись в буфер для определения заголовков
+		this->_buffer.push_back(std::move(this->_record));
+		// Если накоплено достаточно записей
+		if(this->_buffer.size() >= this->_sample)
+			// Выполняем определение заголовков
+			this->prepare();
+	}
+	// Выполняем сброс текущей записи
+	this->_record = record_t();
+}
+/**
+ * @brief Метод добавления значения в текущую запись
+ *
+ * @param value значение для добавления
+ * @return      результат добавления
+ */
+bool anyks::Parser::Tabulator::add(const string & value) noexcept {
+	// Определяем уровень вложенности
+	switch(this->_depth){
+		// Если значение не находится внутри массива записей
+		case 0: return false;
+		// Если значение является самостоятельной записью массива
+		case 1: {
+			// Добавляем значение в запись
+			this->_record.cols.emplace_back("", value);
+			// Выполняем завершение записи
+			this->commit();
+		} break;
+		// Если значение является столбцом записи
+		case 2:
+			// Добавляем значение в запись
+			this->_record.cols.emplace_back(this->_key, value);
+		break;
+	}
+	// Вложенные объекты и массивы записей в CSV не выводятся
+	return true;
+}
+/**
+ * @brief Метод получения количества выведенных строк
+ *
+ * @return количество выведенных строк
+ */
+size_t anyks::Parser::Tabulator::rows() const noexcept {
+	// Выводим количество выведенных строк
+	return this->_rows;
+}
+/**
+ * @brief Метод получения количества пропущенных значений
+ *
+ * @return количество значений, ключей которых нет в заголовках
+ */
+size_t anyks::Parser::Tabulator::dropped() const noexcept {
+	// Выводим количество пропущенных значений
+	return this->_dropped;
+}
+/**
+ * @brief Метод обработки пустого значения
+ *
+ * @return результат обработки
+ */
+bool anyks::Parser::Tabulator::Null() noexcept {
+	// Пустое значение выводится как пустой столбец
+	return this->add("");
+}
+/**
+ * @brief Метод обработки булевого значения
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Bool(const bool value) noexcept {
+	// Выполняем добавление значения
+	return this->add(value ? "true" : "false");
+}
+/**
+ * @brief Метод обработки целого числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Int(const int32_t value) noexcept {
+	// Выполняем добавление значения
+	return this->add(std::to_string(value));
+}
+/**
+ * @brief Метод обработки беззнакового целого числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Uint(const uint32_t value) noexcept {
+	// Выполняем добавление значения
+	return this->add(std::to_string(value));
+}
+/**
+ * @brief Метод обработки большого целого числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Int64(const int64_t value) noexcept {
+	// Выполняем добавление значения
+	return this->add(std::to_string(value));
+}
+/**
+ * @brief Метод обработки большого беззнакового целого числа
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Uint64(const uint64_t value) noexcept {
+	// Выполняем добавление значения
+	return this->add(std::to_string(value));
+}
+/**
+ * @brief Метод обработки числа с плавающей точкой
+ *
+ * @param value значение для обработки
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::Double(const double value) noexcept {
+	// Выполняем добавление значения без экспоненциальной записи
+	return this->add(this->_fmk->noexp(value, true));
+}
+/**
+ * @brief Метод обработки числа в виде текста
+ *
+ * @param str    текст числа
+ * @param length длина текста числа
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Tabulator::RawNumber(const char * str, const SizeType length, const bool) noexcept {
+	// Выполняем добавление значения
+	return this->add(string(str, length));
+}
+/**
+ * @brief Метод обработки строки
+ *
+ * @param str    текст строки
+ * @param length длина текста строки
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Tabulator::String(const char * str, const SizeType length, const bool) noexcept {
+	// Выполняем добавление значения
+	return this->add(string(str, length));
+}
+/**
+ * @brief Метод обработки начала объекта
+ *
+ * @return результат обработки
+ */
+bool anyks::Parser::Tabulator::StartObject() noexcept {
+	// Потоково конвертируется только массив записей
+	if(this->_depth == 0)
+		// Выводим результат
+		return false;
+	// Если объект является записью массива
+	else if(this->_depth == 1)
+		// Запоминаем, что запись является объектом
+		this->_record.map = true;
+	// Увеличиваем уровень вложенности
+	this->_depth++;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки ключа объекта
+ *
+ * @param str    текст ключа
+ * @param length длина текста ключа
+ * @param copy   флаг копирования текста
+ * @return       результат обработки
+ */
+bool anyks::Parser::Tabulator::Key(const char * str, const SizeType length, const bool) noexcept {
+	// Если ключ принадлежит записи массива
+	if(this->_depth == 2)
+		// Запоминаем ключ до получения значения
+		this->_key.assign(str, length);
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки завершения объекта
+ *
+ * @param count количество элементов объекта
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::EndObject(const SizeType) noexcept {
+	// Уменьшаем уровень вложенности
+	this->_depth--;
+	// Если завершена запись массива
+	if(this->_depth == 1)
+		// Выполняем завершение записи
+		this->commit();
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки начала массива
+ *
+ * @return результат обработки
+ */
+bool anyks::Parser::Tabulator::StartArray() noexcept {
+	// Если массив является записью массива
+	if(this->_depth == 1)
+		// Запоминаем, что запись является массивом
+		this->_record.map = false;
+	// Увеличиваем уровень вложенности
+	this->_depth++;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки завершения массива
+ *
+ * @param count количество элементов массива
+ * @return      результат обработки
+ */
+bool anyks::Parser::Tabulator::EndArray(const SizeType) noexcept {
+	// Уменьшаем уровень вложенности
+	this->_depth--;
+	// Если завершена запись массива
+	if(this->_depth == 1)
+		// Выполняем завершение записи
+		this->commit();
+	// Если завершён массив записей
+	else if(this->_depth == 0)
+		// Выполняем вывод оставшихся записей
+		this->prepare();
+	// Выводим результат
+	return true;
+}
+/**
+ * Шаблон обработчика событий разбора
+ */
+template <typename Handler>
+/**
+ * @brief Метод разбора текста с передачей событий обработчику без построения объекта JSON
+ *
+ * @param text    текст для разбора
+ * @param from    формат текста для разбора
+ * @param handler обработчик событий разбора
+ * @return        результат разбора
  */
-Document anyks::Parser::cef(const string & text, const cef_t::mode_t mode) noexcept {
+bool anyks::Parser::read(const string_view text, const format_t from, Handler & handler) noexcept {
 	// Результат работы функции
-	Document result(kObjectType);
+	bool result = false;
 	// Если текст передан
 	if(!text.empty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем очистку объекта
-			this->_cef.clear();
-			// Устанавливаем строгий режим работы
-			this->_cef.mode(mode);
-			// Выполняем парсинг текста
-			this->_cef = text;
-			// Выводим полученный результат
-			return this->_cef.dump();
+			// Определяем формат данных
+			switch(static_cast <uint8_t> (from)){
+				// Если формат данных указан как JSON
+				case static_cast <uint8_t> (format_t::JSON): {
+					// Получаем позицию первого значащего символа
+					const size_t pos = text.find_first_not_of(" \t\r\n");
+					// Напрямую конвертируются только объекты и массивы
+					if((pos == string_view::npos) || ((text[pos] != '{') && (text[pos] != '[')))
+						// Выходим из функции
+						break;
+					// Получаем позицию следующего значащего символа
+					const size_t next = text.find_first_not_of(" \t\r\n", pos + 1);
+					// Пустые объекты и массивы не конвертируются
+					if((next == string_view::npos) || (text[next] == '}') || (text[next] == ']'))
+						// Выходим из функции
+						break;
+					// Создаём объект потокового парсера JSON
+					Reader reader;
+					// Создаём поток чтения данных из памяти без копирования
+					MemoryStream stream(text.data(), text.size());
+					// Создаём поток чтения с учётом кодировки
+					EncodedInputStream <UTF8 <>, MemoryStream> input(stream);
+					// Выполняем разбор текста с передачей событий обработчику
+					result = !reader.Parse(input, handler).IsError();
+				} break;
+				// Если формат данных указан как CSV
+				case static_cast <uint8_t> (format_t::CSV): {
+					// Количество полученных строк
+					SizeType rows = 0;
+					// Создаём объект модуля CSV для текущего вызова
+					csv_t csv(this->_fmk, this->_log);
+					// Выполняем начало массива строк
+					handler.StartArray();
+					// Выполняем разбор текста построчно
+					csv.parse(text, [&rows, &handler, this](const vector <string> & row) noexcept -> void {
+						// Увеличиваем количество полученных строк
+						rows++;
+						// Выполняем начало массива столбцов
+						handler.StartArray();
+						// Выполняем перебор всех столбцов строки
+						for(auto & item : row){
+							// Если запись является числом
+							if(this->_fmk->is(item, fmk_t::check_t::NUMBER)){
+								/**
+								 * Выполняем отлов ошибок
+								 */
+								try {
+									// Если число положительное
+									if(item.front() != '-')
+										// Выводим полученное значение
+										handler.Uint64(static_cast <uint64_t> (::stoull(item)));
+									// Выводим полученное значение
+									else handler.Int64(static_cast <int64_t> (::stoll(item)));
+								/**
+								 * Если возникает ошибка
+								 */
+								} catch(const exception &) {
+									// Выводим полученное значение как строку
+									handler.String(item.c_str(), static_cast <SizeType> (item.length()), true);
+								}
+							// Если запись является числом с плавающей точкой
+							} else if(this->_fmk->is(item, fmk_t::check_t::DECIMAL)) {
+								/**
+								 * Выполняем отлов ошибок
+								 */
+								try {
+									// Выводим полученное значение
+									handler.Double(::stod(item));
+								/**
+								 * Если возникает ошибка
+								 */
+								} catch(const exception &) {
+									// Выводим полученное значение как строку
+									handler.String(item.c_str(), static_cast <SizeType> (item.length()), true);
+								}
+							// Если число является булевым истинным значением
+							} else if(this->_fmk->compare("true", item))
+								// Выводим полученное значение
+								handler.Bool(true);
+							// Если число является булевым ложным значением
+							else if(this->_fmk->compare("false", item))
+								// Выводим полученное значение
+								handler.Bool(false);
+							// Выводим полученное значение как строку
+							else handler.String(item.c_str(), static_cast <SizeType> (item.length()), true);
+						}
+						// Выполняем завершение массива столбцов
+						handler.EndArray(static_cast <SizeType> (row.size()));
+					// Большие тексты разбираются участками параллельно, строки выводятся в исходном порядке
+					}, '0', this->_threads);
+					// Выполняем завершение массива строк
+					handler.EndArray(rows);
+					// Запоминаем результат разбора
+					result = (rows > 0);
+				} break;
+			}
 		/**
 		 * Если возникает ошибка
 		 */
@@ -3338,7 +4792,7 @@ Document anyks::Parser::cef(const string & text, const cef_t::mode_t mode) noexc
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(text, static_cast <uint16_t> (mode)), log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), static_cast <uint16_t> (from)), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -3346,35 +4800,128 @@ Document anyks::Parser::cef(const string & text, const cef_t::mode_t mode) noexc
 				// Выводим сообщение об ошибке
 				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
 			#endif
+			// Сбрасываем результат разбора
+			result = false;
 		}
 	}
 	// Выводим результат
 	return result;
 }
 /**
- * @brief Метод конвертации объекта JSON в текст в формате CEF
+ * @brief Метод проверки возможности прямого конвертирования без построения объекта JSON
  *
- * @param data данные в объекте JSON
- * @param mode режим парсинга
- * @return     текст после конвертации
+ * @param from формат исходных данных
+ * @param to   формат данных для конвертации
+ * @return     результат проверки
  */
-string anyks::Parser::cef(const Document & data, const cef_t::mode_t mode) noexcept {
-	// Если данные переданы
-	if(data.IsObject() && !data.ObjectEmpty()){
-		// Выполняем блокировку потока
-		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+bool anyks::Parser::transcodable(const format_t from, const format_t to) const noexcept {
+	// Выводим результат проверки
+	return (
+		(((from == format_t::JSON) || (from == format_t::CSV)) && ((to == format_t::JSON) || (to == format_t::YAML))) ||
+		// Массив записей JSON конвертируется в CSV построчно
+		((from == format_t::JSON) && (to == format_t::CSV))
+	);
+}
+/**
+ * @brief Метод прямого конвертирования текста без построения объекта JSON
+ *
+ * @param text     текст для конвертации
+ * @param from     формат исходных данных
+ * @param to       формат данных для конвертации
+ * @param prettify флаг генерации читаемого формата
+ * @param header   флаг формирования заголовков для формата CSV
+ * @param delim    разделитель используемый для формата CSV
+ * @return         текст после конвертации или пустая строка, если прямое конвертирование невозможно
+ */
+string anyks::Parser::transcode(const string_view text, const format_t from, const format_t to, const bool prettify, const bool header, const char delim) noexcept {
+	// Результат работы функции
+	string result = "";
+	// Выполняем прямое конвертирование со сборкой частей результата
+	if(this->transcode(text, from, to, prettify, header, delim, [&result](const string & data) noexcept -> void {
+		// Добавляем полученную часть результата
+		result.append(data);
+	}) == 0)
+		// Сбрасываем результат
+		result.clear();
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод прямого конвертирования текста без построения объекта JSON с выводом результата по частям
+ *
+ * @param text     текст для конвертации
+ * @param from     формат исходных данных
+ * @param to       формат данных для конвертации
+ * @param prettify флаг генерации читаемого формата
+ * @param header   флаг формирования заголовков для формата CSV
+ * @param delim    разделитель используемый для формата CSV
+ * @param callback функция обратного вызова при получении части результата (для формата CSV - каждой строки)
+ * @return         количество выведенных частей результата или 0, если прямое конвертирование невозможно
+ */
+size_t anyks::Parser::transcode(const string_view text, const format_t from, const format_t to, const bool prettify, const bool header, const char delim, function <void (const string &)> callback) noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если текст передан и прямое конвертирование возможно
+	if(!text.empty() && (callback != nullptr) && this->transcodable(from, to)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем очистку объекта
-			this->_cef.clear();
-			// Устанавливаем строгий режим работы
-			this->_cef.mode(mode);
-			// Устанавливаем полученные данные обратно
-			this->_cef.dump(data);
-			// Выводим полученный результат
-			return this->_cef.cef();
+			// Определяем формат данных
+			switch(static_cast <uint8_t> (to)){
+				// Если формат данных для конвертации указан как JSON
+				case static_cast <uint8_t> (format_t::JSON): {
+					// Создаём результьрующий буфер
+					StringBuffer buffer;
+					// Если нам нужно вывести результат в красивом формате
+					if(prettify){
+						// Выполняем создание объекта писателя
+						PrettyWriter <StringBuffer> writer(buffer);
+						// Выполняем передачу событий разбора писателю
+						if(this->read(text, from, writer) && writer.IsComplete())
+							// Устанавливаем количество полученных частей результата
+							result = 1;
+					// Если нужно вывести результат в обычном формате
+					} else {
+						// Выполняем создание объекта писателя
+						Writer <StringBuffer> writer(buffer);
+						// Выполняем передачу событий разбора писателю
+						if(this->read(text, from, writer) && writer.IsComplete())
+							// Устанавливаем количество полученных частей результата
+							result = 1;
+					}
+					// Если запись в формате JSON создана
+					if(result > 0)
+						// Выводим созданную запись строки в формате JSON
+						callback(string(buffer.GetString(), buffer.GetSize()));
+				} break;
+				// Если формат данных для конвертации указан как YAML
+				case static_cast <uint8_t> (format_t::YAML): {
+					// Создаём объект писателя YAML
+					emitter_t emitter;
+					// Выполняем передачу событий разбора писателю
+					if(this->read(text, from, emitter)){
+						// Устанавливаем количество полученных частей результата
+						result = 1;
+						// Выводим созданную запись строки в формате YAML
+						callback(emitter.get());
+					}
+				} break;
+				// Если формат данных для конвертации указан как CSV
+				case static_cast <uint8_t> (format_t::CSV): {
+					// Буфер строки с разделителем
+					string line = "";
+					// Выполняем построчную конвертацию массива записей, каждая строка выводится по завершении записи
+					result = this->csv(text, header, delim, [&line, &callback](const string & row) noexcept -> void {
+						// Формируем строку
+						line.assign(row);
+						// Добавляем разделитель строки
+						line.append("\r\n");
+						// Выводим полученную строку
+						callback(line);
+					});
+				} break;
+			}
 		/**
 		 * Если возникает ошибка
 		 */
@@ -3384,7 +4931,7 @@ string anyks::Parser::cef(const Document & data, const cef_t::mode_t mode) noexc
 			 */
 			#if DEBUG_MODE
 				// Выводим сообщение об ошибке
-				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), static_cast <uint16_t> (from), static_cast <uint16_t> (to), prettify, header, delim), log_t::flag_t::CRITICAL, error.what());
 			/**
 			* Если режим отладки не включён
 			*/
@@ -3392,8 +4939,10 @@ string anyks::Parser::cef(const Document & data, const cef_t::mode_t mode) noexc
 				// Выводим сообщение об ошибке
 				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
 			#endif
+			// Сбрасываем результат
+			result = 0;
 		}
 	}
 	// Выводим результат
-	return "";
+	return result;
 }
@@ -0,0 +1,259 @@
+/**
+ * @file: prefilter.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <prefilter.hpp>
+
+/**
+ * Подписываемся на пространство имён awh
+ */
+using namespace awh;
+
+/**
+ * @brief Функция приведения символа ASCII к нижнему регистру
+ *
+ * @param letter символ для приведения
+ * @return       символ в нижнем регистре
+ */
+static inline uint8_t lower(const uint8_t letter) noexcept {
+	// Выводим символ в нижнем регистре
+	return (((letter >= 'A') && (letter <= 'Z')) ? (letter + 0x20) : letter);
+}
+/**
+ * @brief Метод очистки данных
+ *
+ */
+void anyks::Prefilter::clear() noexcept {
+	// Сбрасываем флаг готовности автомата
+	this->_ready = false;
+	// Выполняем очистку состояний автомата
+	this->_states.clear();
+	// Выполняем очистку списка литералов
+	this->_literals.clear();
+	// Выполняем освобождение памяти состояний автомата
+	vector <state_t> ().swap(this->_states);
+	// Выполняем освобождение памяти списка литералов
+	std::unordered_map <string, uint32_t> ().swap(this->_literals);
+}
+/**
+ * @brief Метод получения количества добавленных литералов
+ *
+ * @return количество литералов
+ */
+size_t anyks::Prefilter::count() const noexcept {
+	// Выводим количество литералов
+	return this->_literals.size();
+}
+/**
+ * @brief Метод добавления литерала для поиска
+ *
+ * @param literal литерал для поиска
+ * @return        идентификатор литерала
+ */
+uint32_t anyks::Prefilter::add(const string & literal) noexcept {
+	// Результат работы функции
+	uint32_t result = 0;
+	// Если литерал передан
+	if(!literal.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Литерал в нижнем регистре
+			string key = literal;
+			// Переходим по всем символам литерала
+			for(auto & letter : key)
+				// Приводим символ к нижнему регистру
+				letter = static_cast <char> (::lower(static_cast <uint8_t> (letter)));
+			// Выполняем поиск уже добавленного литерала
+			auto i = this->_literals.find(key);
+			// Если литерал уже добавлен
+			if(i != this->_literals.end())
+				// Выводим идентификатор литерала
+				return i->second;
+			// Если корневое состояние ещё не создано
+			if(this->_states.empty())
+				// Создаём корневое состояние
+				this->_states.emplace_back();
+			// Текущее состояние автомата
+			uint32_t state = 0;
+			// Переходим по всем символам литерала
+			for(auto & letter : key){
+				// Получаем следующее состояние
+				const uint32_t next = this->_states[state].next[static_cast <uint8_t> (letter)];
+				// Если переход уже существует
+				if(next > 0)
+					// Переходим в следующее состояние
+					state = next;
+				// Если перехода ещё нет
+				else {
+					// Создаём новое состояние
+					this->_states.emplace_back();
+					// Добавляем переход в новое состояние
+					this->_states[state].next[static_cast <uint8_t> (letter)] = static_cast <uint32_t> (this->_states.size() - 1);
+					// Переходим в новое состояние
+					state = static_cast <uint32_t> (this->_states.size() - 1);
+				}
+			}
+			// Получаем идентификатор литерала
+			result = static_cast <uint32_t> (this->_literals.size());
+			// Запоминаем, что литерал завершается в текущем состоянии
+			this->_states[state].out.push_back(result);
+			// Добавляем литерал в список
+			this->_literals.emplace(::move(key), result);
+			// Сбрасываем флаг готовности автомата
+			this->_ready = false;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(literal), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод построения переходов автомата после добавления всех литералов
+ *
+ */
+void anyks::Prefilter::compile() noexcept {
+	// Если литералы добавлены
+	if(!this->_states.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Очередь обхода состояний в ширину
+			vector <uint32_t> queue;
+			// Выделяем память для очереди
+			queue.reserve(this->_states.size());
+			// Переходим по всем переходам корневого состояния
+			for(uint16_t letter = 0; letter < 256; letter++){
+				// Получаем следующее состояние
+				const uint32_t next = this->_states[0].next[letter];
+				// Если переход существует
+				if(next > 0){
+					// Состояния первого уровня при ошибке возвращаются в корень
+					this->_states[next].fail = 0;
+					// Добавляем состояние в очередь
+					queue.push_back(next);
+				}
+			}
+			// Выполняем обход всех состояний в ширину
+			for(size_t i = 0; i < queue.size(); i++){
+				// Получаем текущее состояние
+				const uint32_t state = queue[i];
+				// Переходим по всем возможным символам
+				for(uint16_t letter = 0; letter < 256; letter++){
+					// Получаем следующее состояние
+					const uint32_t next = this->_states[state].next[letter];
+					// Получаем переход состояния ошибки по текущему символу
+					const uint32_t fail = this->_states[this->_states[state].fail].next[letter];
+					// Если переход существует
+					if(next > 0){
+						// Устанавливаем состояние перехода по ошибке
+						this->_states[next].fail = fail;
+						// Добавляем литералы, завершающиеся в состоянии ошибки
+						this->_states[next].out.insert(this->_states[next].out.end(), this->_states[fail].out.begin(), this->_states[fail].out.end());
+						// Добавляем состояние в очередь
+						queue.push_back(next);
+					// Достраиваем переход, чтобы поиск выполнял одно обращение к таблице на байт
+					} else this->_states[state].next[letter] = fail;
+				}
+			}
+			// Устанавливаем флаг готовности автомата
+			this->_ready = true;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
+/**
+ * @brief Метод поиска литералов в тексте за один проход
+ *
+ * @param text  текст для поиска
+ * @param marks список отметок найденных литералов (индекс - идентификатор литерала)
+ * @param stamp значение отметки текущего поиска
+ */
+void anyks::Prefilter::scan(const string_view text, vector <uint32_t> & marks, const uint32_t stamp) const noexcept {
+	// Если автомат построен и текст передан
+	if(this->_ready && !text.empty()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Если список отметок меньше количества литералов
+			if(marks.size() < this->_literals.size())
+				// Увеличиваем список отметок
+				marks.resize(this->_literals.size(), 0);
+			// Текущее состояние автомата
+			uint32_t state = 0;
+			// Переходим по всем символам текста
+			for(auto & letter : text){
+				// Переходим в следующее состояние
+				state = this->_states[state].next[::lower(static_cast <uint8_t> (letter))];
+				// Переходим по всем литералам, завершающимся в состоянии
+				for(auto & id : this->_states[state].out)
+					// Отмечаем найденный литерал
+					marks[id] = stamp;
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(string(text), stamp), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
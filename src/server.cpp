@@ -580,8 +580,8 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 						if(request.HasMember("text") && request.HasMember("from") && request.HasMember("to") &&
 						   request["text"].IsString() && request["from"].IsString() && request["to"].IsString() &&
 						   !request.HasMember("date") && !request.HasMember("bytes") && !request.HasMember("seconds")){
-							// Регулярное выражение в формате GROK
-							string express = "";
+							// Список регулярных выражений в формате GROK в порядке перебора
+							vector <string> expressions;
 							// Выполняем инициализацию объекта парсера
 							parser_t parser(this->_fmk, this->_log);
 							// Тип конвертируемого формата данных и тип формата для конвертации
@@ -618,6 +618,8 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 							else if(this->_fmk->compare("grok", request["from"].GetString())) {
 								// Определяем формат данных
 								from = type_t::GROK;
+								// Выполняем установку ограничений выполнения регулярных выражений
+								parser.limits(this->_limits);
 								// Если файл шаблона указан
 								if(request.HasMember("patterns") && request["patterns"].IsObject()){
 									// Создаём объект JSON шаблонов
@@ -626,13 +628,26 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 									patterns.CopyFrom(request["patterns"], patterns.GetAllocator());
 									// Выполняем добавление поддерживаемых шаблонов
 									parser.patterns(patterns);
-								}
+								// Если пакет шаблонов указан, загружаем его вместо сборки базовых шаблонов
+								} else if(this->_bundled)
+									// Используем шаблоны пакета, загруженного один раз при конфигурировании сервера
+									parser.share(this->_patterns);
 								// Если регулярное выражение передано
 								if(request.HasMember("express") && request["express"].IsString())
 									// Устанавливаем полученное регулярное выражение
-									express = request["express"].GetString();
-								// Выводим сообщение об ошибке
-								else {
+									expressions.emplace_back(request["express"].GetString());
+								// Если передан список альтернативных регулярных выражений
+								else if(request.HasMember("express") && request["express"].IsArray()) {
+									// Переходим по всем регулярным выражениям списка
+									for(auto & item : request["express"].GetArray()){
+										// Если регулярное выражение является строкой
+										if(item.IsString() && (item.GetStringLength() > 0))
+											// Добавляем регулярное выражение в список
+											expressions.emplace_back(item.GetString());
+									}
+								}
+								// Если регулярное выражение не получено
+								if(expressions.empty()){
 									// Выпоолняем генерацию ошибки запроса
 									this->error(sid, bid, 400, "Regular expression in GROK format is not set");
 									// Выводим удачное завершение работы
@@ -765,71 +780,125 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 									}
 								}
 							}
+							// Форматы прямого конвертирования без построения объекта JSON
+							parser_t::format_t source = parser_t::format_t::NONE, target = parser_t::format_t::NONE;
+							// Если формат входящих данных указан как JSON
+							if(from == type_t::JSON)
+								// Устанавливаем формат прямого конвертирования
+								source = parser_t::format_t::JSON;
+							// Если формат входящих данных указан как CSV без заголовков
+							else if((from == type_t::CSV) && !(request.HasMember("header") && request["header"].IsBool() && request["header"].GetBool()))
+								// Устанавливаем формат прямого конвертирования
+								source = parser_t::format_t::CSV;
+							// Если формат исходящих данных указан как JSON
+							if(to == type_t::JSON)
+								// Устанавливаем формат прямого конвертирования
+								target = parser_t::format_t::JSON;
+							// Если формат исходящих данных указан как YAML
+							else if(to == type_t::YAML)
+								// Устанавливаем формат прямого конвертирования
+								target = parser_t::format_t::YAML;
+							// Если массив записей JSON конвертируется в формат CSV
+							else if((to == type_t::CSV) && (from == type_t::JSON))
+								// Устанавливаем формат прямого конвертирования
+								target = parser_t::format_t::CSV;
+							// Флаг формирования заголовков для формата CSV
+							const bool header = (request.HasMember("header") && request["header"].IsBool() && request["header"].GetBool());
+							// Разделитель используемый для формата CSV
+							const char delim = ((request.HasMember("delim") && request["delim"].IsString() && (request["delim"].GetStringLength() > 0)) ? request["delim"].GetString()[0] : ';');
+							// Выполняем прямое конвертирование без построения промежуточного объекта JSON
+							const string transcoded = parser.transcode(request["text"].GetString(), source, target, request.HasMember("prettify") && request["prettify"].IsBool() && request["prettify"].GetBool(), header, delim);
 							// Объект ответа парсера в формате JSON
 							json answer(kObjectType);
-							/**
-							 * Определяем формат данных
-							 */
-							switch(static_cast <uint8_t> (from)){
-								// Если формат входящих данных указан как Text
-								case static_cast <uint8_t> (type_t::TEXT):
-									// Выполняем передачу данных как она есть
-									answer.SetString(request["text"].GetString(), answer.GetAllocator());
-								break;
-								// Если формат входящих данных указан как XML
-								case static_cast <uint8_t> (type_t::XML):
-									// Выполняем конвертацию данных
-									answer = parser.xml(request["text"].GetString());
-								break;
-								// Если формат входящих данных указан как JSON
-								case static_cast <uint8_t> (type_t::JSON):
-									// Выполняем конвертацию данных
-									answer = parser.json(request["text"].GetString());
-								break;
-								// Если формат входящих данных указан как INI
-								case static_cast <uint8_t> (type_t::INI):
-									// Выполняем конвертацию данных
-									answer = parser.ini(request["text"].GetString());
-								break;
-								// Если формат входящих данных указан как YAML
-								case static_cast <uint8_t> (type_t::YAML):
-									// Выполняем конвертацию данных
-									answer = parser.yaml(request["text"].GetString());
-								break;
-								// Если формат входящих данных указан как CEF
-								case static_cast <uint8_t> (type_t::CEF):
-									// Выполняем конвертацию данных
-									answer = parser.cef(request["text"].GetString(), cef_t::mode_t::NONE);
-								break;
-								// Если формат входящих данных указан как CSV
-								case static_cast <uint8_t> (type_t::CSV):
-									// Выполняем конвертацию данных
-									answer = parser.csv(
-										request["text"].GetString(),
-										request.HasMember("header") &&
-										request["header"].IsBool() &&
-										request["header"].GetBool()
-									);
-								break;
-								// Если формат входящих данных указан как GROK
-								case static_cast <uint8_t> (type_t::GROK):
-									// Выполняем конвертацию данных
-									answer = parser.grok(request["text"].GetString(), express);
-								break;
-								// Если формат входящих данных указан как SysLog
-								case static_cast <uint8_t> (type_t::SYSLOG):
-									// Выполняем конвертацию данных
-									answer = parser.syslog(request["text"].GetString());
-								break;
-								// Если формат входящих данных указан как BASE64
-								case static_cast <uint8_t> (type_t::BASE64): {
-									// Получаем текстове значение буфера
-									const string & text = request["text"].GetString();
-									// Выполняем декодирование полученных данных
-									const string & hash = this->_hash.decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
-									// Выполняем декодирование хэша BASE64
-									answer.SetString(hash, answer.GetAllocator());
-								} break;
+							// Если прямое конвертирование не выполнено
+							if(transcoded.empty()){
+								/**
+								 * Определяем формат данных
+								 */
+								switch(static_cast <uint8_t> (from)){
+									// Если формат входящих данных указан как Text
+									case static_cast <uint8_t> (type_t::TEXT):
+										// Выполняем передачу данных как она есть
+										answer.SetString(request["text"].GetString(), answer.GetAllocator());
+									break;
+									// Если формат входящих данных указан как XML
+									case static_cast <uint8_t> (type_t::XML):
+										// Выполняем конвертацию данных
+										answer = parser.xml(request["text"].GetString());
+									break;
+									// Если формат входящих данных указан как JSON
+									case static_cast <uint8_t> (type_t::JSON):
+										// Выполняем конвертацию данных
+										answer = parser.json(request["text"].GetString());
+									break;
+									// Если формат входящих данных указан как INI
+									case static_cast <uint8_t> (type_t::INI):
+										// Выполняем конвертацию данных
+										answer = parser.ini(request["text"].GetString());
+									break;
+									// Если формат входящих данных указан как YAML
+									case static_cast <uint8_t> (type_t::YAML):
+										// Выполняем конвертацию данных
+										answer = parser.yaml(request["text"].GetString());
+									break;
+									// Если формат входящих данных указан как CEF
+									case static_cast <uint8_t> (type_t::CEF):
+										// Выполняем конвертацию данных
+										answer = parser.cef(request["text"].GetString(), cef_t::mode_t::NONE);
+									break;
+									// Если формат входящих данных указан как CSV
+									case static_cast <uint8_t> (type_t::CSV):
+										// Выполняем конвертацию данных
+										answer = parser.csv(
+											request["text"].GetString(),
+											request.HasMember("header") &&
+											request["header"].IsBool() &&
+											request["header"].GetBool()
+										);
+									break;
+									// Если формат входящих данных указан как GROK
+									case static_cast <uint8_t> (type_t::GROK):
+										// Выполняем конвертацию данных
+										answer = parser.grok(request["text"].GetString(), expressions);
+										// Если строка пропущена из-за превышения ограничений
+										if(parser.skipped(expressions) > 0){
+											// Получаем количество превышений ограничений каждого выражения
+											const auto & timeouts = parser.timeouts(expressions);
+											// Переходим по всем выражениям
+											for(size_t i = 0; i < timeouts.size(); i++){
+												// Если выражение превышало ограничения
+												if(timeouts.at(i) > 0)
+													// Выводим сообщение о превышении ограничений
+													this->_log->print("GROK expression #%zu exceeded the match limits", log_t::flag_t::WARNING, i + 1);
+											}
+										}
+										/**
+										 * Если включён режим отладки
+										 */
+										#if DEBUG_MODE
+										{
+											// Получаем счётчики общего кэша собранных регулярных выражений
+											const auto stat = grok_t::stat();
+											// Выводим счётчики общего кэша
+											this->_log->debug("GROK cache: SIZE=%zu/%zu, HITS=%llu, MISSES=%llu, EVICTIONS=%llu", __PRETTY_FUNCTION__, {}, log_t::flag_t::INFO, stat.size, stat.capacity, static_cast <unsigned long long> (stat.hits), static_cast <unsigned long long> (stat.misses), static_cast <unsigned long long> (stat.evictions));
+										}
+										#endif
+									break;
+									// Если формат входящих данных указан как SysLog
+									case static_cast <uint8_t> (type_t::SYSLOG):
+										// Выполняем конвертацию данных
+										answer = parser.syslog(request["text"].GetString());
+									break;
+									// Если формат входящих данных указан как BASE64
+									case static_cast <uint8_t> (type_t::BASE64): {
+										// Получаем текстове значение буфера
+										const string & text = request["text"].GetString();
+										// Выполняем декодирование полученных данных
+										const string & hash = this->_hash.decode <string> (text.data(), text.size(), hash_t::cipher_t::BASE64);
+										// Выполняем декодирование хэша BASE64
+										answer.SetString(hash, answer.GetAllocator());
+									} break;
+								}
 							}
 							// Если ответ парсера получен
 							if(!answer.IsNull()){
@@ -856,8 +925,12 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 									break;
 									// Если формат входящих данных указан как JSON
 									case static_cast <uint8_t> (type_t::JSON):
+										// Если прямое конвертирование выполнено
+										if(!transcoded.empty())
+											// Выполняем вывод результата прямого конвертирования
+											text = transcoded;
 										// Выполняем конвертирование в формат JSON
-										text = parser.json(
+										else text = parser.json(
 											answer,
 											request.HasMember("prettify") &&
 											request["prettify"].IsBool() &&
@@ -872,7 +945,7 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 									// Если формат входящих данных указан как YAML
 									case static_cast <uint8_t> (type_t::YAML):
 										// Выполняем конвертирование в формат YAML
-										text = parser.yaml(answer);
+										text = (!transcoded.empty() ? transcoded : parser.yaml(answer));
 									break;
 									// Если формат входящих данных указан как CEF
 									case static_cast <uint8_t> (type_t::CEF):
@@ -881,13 +954,12 @@ void anyks::Server::complete(const int32_t sid, const uint64_t bid, const awh::w
 									break;
 									// Если формат входящих данных указан как CSV
 									case static_cast <uint8_t> (type_t::CSV): {
+										// Если прямое конвертирование выполнено
+										if(!transcoded.empty())
+											// Выполняем вывод результата прямого конвертирования
+											text = transcoded;
 										// Выполняем конвертирование в формат CSV
-										text = parser.csv(
-											answer,
-											request.HasMember("header") &&
-											request["header"].IsBool() &&
-											request["header"].GetBool()
-										);
+										else text = parser.csv(answer, header, delim);
 									} break;
 									// Если формат входящих данных указан как SysLog
 									case static_cast <uint8_t> (type_t::SYSLOG):
@@ -1688,6 +1760,37 @@ void anyks::Server::config(const json & config) noexcept {
 			if(config.HasMember("favicon") && config["favicon"].IsString())
 				// Выполняем установку адреса favicon.ico
 				this->_favicon = this->_fs.realPath(config["favicon"].GetString());
+			// Если адрес пакета предварительно собранных шаблонов GROK установлен
+			if(config.HasMember("bundle") && config["bundle"].IsString())
+				// Выполняем установку адреса пакета шаблонов GROK
+				this->_bundle = this->_fs.realPath(config["bundle"].GetString());
+			// Если адрес пакета шаблонов GROK получен
+			if(!this->_bundle.empty())
+				// Выполняем загрузку пакета шаблонов, собранного без пользовательских шаблонов, один раз для всех запросов
+				this->_bundled = this->_patterns.loadPatterns(this->_bundle, 0);
+			// Если ограничения выполнения регулярных выражений GROK установлены
+			if(config.HasMember("grokLimits") && config["grokLimits"].IsObject()){
+				// Если максимальное количество шагов сопоставления установлено
+				if(config["grokLimits"].HasMember("match") && config["grokLimits"]["match"].IsUint())
+					// Выполняем установку максимального количества шагов сопоставления
+					this->_limits.match = config["grokLimits"]["match"].GetUint();
+				// Если максимальная глубина возвратов установлена
+				if(config["grokLimits"].HasMember("depth") && config["grokLimits"]["depth"].IsUint())
+					// Выполняем установку максимальной глубины возвратов
+					this->_limits.depth = config["grokLimits"]["depth"].GetUint();
+				// Если максимальный размер стека JIT установлен
+				if(config["grokLimits"].HasMember("stack") && config["grokLimits"]["stack"].IsUint())
+					// Выполняем установку максимального размера стека JIT
+					this->_limits.stack = static_cast <size_t> (config["grokLimits"]["stack"].GetUint());
+				// Если максимальное время сопоставления строки установлено
+				if(config["grokLimits"].HasMember("budget") && config["grokLimits"]["budget"].IsUint64())
+					// Выполняем установку максимального времени сопоставления строки
+					this->_limits.budget = config["grokLimits"]["budget"].GetUint64();
+			}
+			// Если максимальное количество собранных регулярных выражений GROK в общем кэше установлено
+			if(config.HasMember("grokCache") && config["grokCache"].IsUint())
+				// Выполняем установку максимального количества записей общего кэша
+				grok_t::capacity(static_cast <size_t> (config["grokCache"].GetUint()), this->_log);
 			// Если адрес установлен ресурс с которого разрешено выполнять доступ к API-сервера
 			if(config.HasMember("origin") && config["origin"].IsString()){
 				// Выполняем установку ресурса с которого разрешено выполнять доступ к API-сервера
@@ -2178,8 +2281,8 @@ void anyks::Server::start() noexcept {
  */
 anyks::Server::Server(const fmk_t * fmk, const log_t * log) noexcept :
  _fs(fmk, log), _uri(fmk, log), _hash(log),
- _root{""}, _index{""}, _origin{""}, _favicon{""},
- _chrono(fmk), _http(fmk, log), _maxRequests(100),
+ _root{""}, _index{""}, _origin{""}, _favicon{""}, _bundle{""},
+ _bundled(false), _patterns(fmk, log), _chrono(fmk), _http(fmk, log), _maxRequests(100),
  _core(fmk, log), _awh(&_core, fmk, log), _fmk(fmk), _log(log) {
 	// Выполняем установку идентификатора клиента
 	this->_awh.ident(AWH_SHORT_NAME, AWH_NAME, AWH_VERSION);
@@ -0,0 +1,332 @@
+/**
+ * @file: stream.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <stream.hpp>
+
+/**
+ * Подписываемся на пространство имён awh
+ */
+using namespace awh;
+
+/**
+ * @brief Метод извлечения заголовка записи с префиксом длины
+ *
+ * @param buffer буфер данных для проверки
+ * @param size   размер буфера данных для проверки
+ * @param length размер записи указанный в заголовке
+ * @return       размер заголовка, 0 если запись без префикса длины или string::npos если заголовок не получен полностью
+ */
+size_t anyks::Stream::header(const char * buffer, const size_t size, size_t & length) const noexcept {
+	// Сбрасываем размер записи
+	length = 0;
+	// Если записи разделены только переводом строки
+	if(this->_framing == framing_t::LINE)
+		// Выходим из функции
+		return 0;
+	// Выполняем перебор первых символов записи (длина не может превышать 10 цифр)
+	for(size_t i = 0; (i < size) && (i < 11); i++){
+		// Если текущий символ является цифрой
+		if((buffer[i] >= '0') && (buffer[i] <= '9'))
+			// Увеличиваем размер записи
+			length = ((length * 10) + (buffer[i] - '0'));
+		// Если после цифр найден пробел, значит это заголовок RFC 6587
+		else if((buffer[i] == ' ') && (i > 0) && (length > 0) && (length <= this->_max))
+			// Выводим размер заголовка
+			return (i + 1);
+		// Если запись не является записью с префиксом длины
+		else {
+			// Сбрасываем размер записи
+			length = 0;
+			// Выходим из функции
+			return 0;
+		}
+	}
+	// Если цифр слишком много, значит это не заголовок
+	if(size >= 11){
+		// Сбрасываем размер записи
+		length = 0;
+		// Выходим из функции
+		return 0;
+	}
+	// Сообщаем, что заголовок получен не полностью
+	return string::npos;
+}
+/**
+ * @brief Метод определения количества байт, необходимых для завершения записи в буфере
+ *
+ * @param buffer буфер входящих данных
+ * @param size   размер буфера входящих данных
+ * @return       количество байт или string::npos если запись в этих данных не завершается
+ */
+size_t anyks::Stream::need(const char * buffer, const size_t size) const noexcept {
+	// Размер записи указанный в заголовке
+	size_t length = 0;
+	// Получаем размер заголовка незавершённой записи
+	const size_t bytes = this->header(this->_buffer.data(), this->_buffer.size(), length);
+	// Если заголовок получен не полностью
+	if(bytes == string::npos)
+		// Запрашиваем следующий символ для определения типа записи
+		return (size > 0 ? 1 : string::npos);
+	// Если запись содержит префикс длины
+	else if(bytes > 0) {
+		// Получаем количество недостающих байт
+		const size_t rest = ((bytes + length) - this->_buffer.size());
+		// Выводим количество недостающих байт
+		return (rest <= size ? rest : string::npos);
+	}
+	// Выполняем поиск перевода строки
+	const char * end = reinterpret_cast <const char *> (::memchr(buffer, '\n', size));
+	// Выводим количество байт до перевода строки включительно
+	return (end != nullptr ? static_cast <size_t> (end - buffer) + 1 : string::npos);
+}
+/**
+ * @brief Метод вывода полученной записи
+ *
+ * @param buffer буфер данных записи
+ * @param size   размер буфера данных записи
+ */
+void anyks::Stream::emit(const char * buffer, const size_t size) const noexcept {
+	// Размер записи
+	size_t length = size;
+	// Удаляем завершающий символ возврата каретки
+	while((length > 0) && (buffer[length - 1] == '\r'))
+		// Уменьшаем размер записи
+		length--;
+	// Если запись не пустая (или пустые записи разрешены) и функция обратного вызова установлена
+	if(((length > 0) || this->_blank) && (this->_callback != nullptr))
+		// Выводим полученную запись
+		this->_callback(buffer, length);
+}
+/**
+ * @brief Метод извлечения всех завершённых записей из буфера
+ *
+ * @param buffer буфер данных для разбора
+ * @param size   размер буфера данных для разбора
+ * @return       количество обработанных байт
+ */
+size_t anyks::Stream::frame(const char * buffer, const size_t size) noexcept {
+	// Количество обработанных байт
+	size_t offset = 0;
+	// Размер заголовка и размер записи
+	size_t bytes = 0, length = 0;
+	// Выполняем перебор всех записей буфера
+	while(offset < size){
+		// Если после записи с префиксом длины ожидаются переводы строк (они могут прийти в следующей порции данных)
+		if(this->_skip){
+			// Пропускаем переводы строк, которые некоторые отправители добавляют после записи
+			while((offset < size) && ((buffer[offset] == '\r') || (buffer[offset] == '\n')))
+				// Увеличиваем смещение
+				offset++;
+			// Если данные закончились, продолжаем пропуск в следующей порции данных
+			if(offset == size)
+				// Выходим из цикла
+				break;
+			// Снимаем флаг пропуска переводов строк
+			this->_skip = false;
+			// Переходим к следующей записи
+			continue;
+		}
+		// Получаем текущую позицию в буфере
+		const char * data = (buffer + offset);
+		// Получаем количество оставшихся байт
+		const size_t rest = (size - offset);
+		// Если запись может содержать префикс длины
+		if(this->_framing == framing_t::AUTO){
+			// Если заголовок получен не полностью
+			if((bytes = this->header(data, rest, length)) == string::npos)
+				// Выходим из цикла
+				break;
+			// Если запись содержит префикс длины
+			else if(bytes > 0) {
+				// Если запись получена не полностью
+				if((bytes + length) > rest)
+					// Выходим из цикла
+					break;
+				// Выводим полученную запись
+				this->emit(data + bytes, length);
+				// Смещаемся на размер записи
+				offset += (bytes + length);
+				// Отмечаем, что следующие переводы строк относятся к этой записи
+				this->_skip = true;
+				// Переходим к следующей записи
+				continue;
+			}
+		}
+		// Выполняем поиск перевода строки
+		const char * end = reinterpret_cast <const char *> (::memchr(data, '\n', rest));
+		// Если перевод строки не найден
+		if(end == nullptr)
+			// Выходим из цикла
+			break;
+		// Выводим полученную запись
+		this->emit(data, static_cast <size_t> (end - data));
+		// Смещаемся на размер записи
+		offset += (static_cast <size_t> (end - data) + 1);
+	}
+	// Выводим количество обработанных байт
+	return offset;
+}
+/**
+ * @brief Метод очистки данных
+ *
+ */
+void anyks::Stream::clear() noexcept {
+	// Снимаем флаг пропуска переводов строк
+	this->_skip = false;
+	// Выполняем очистку буфера незавершённой записи
+	this->_buffer.clear();
+	// Выполняем освобождение выделенной памяти
+	vector <char> ().swap(this->_buffer);
+}
+/**
+ * @brief Метод добавления очередной порции данных
+ *
+ * @param buffer буфер данных для добавления
+ * @param size   размер буфера данных для добавления
+ */
+void anyks::Stream::push(const char * buffer, const size_t size) noexcept {
+	// Если данные переданы
+	if((buffer != nullptr) && (size > 0)){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Количество обработанных байт
+			size_t offset = 0;
+			// Выполняем завершение записи, начатой в предыдущей порции данных
+			while(!this->_buffer.empty() && (offset < size)){
+				// Получаем количество байт, необходимых для завершения записи
+				const size_t bytes = this->need(buffer + offset, size - offset);
+				// Если запись в этой порции данных не завершается
+				if(bytes == string::npos){
+					// Добавляем все оставшиеся данные в буфер
+					this->_buffer.insert(this->_buffer.end(), buffer + offset, buffer + size);
+					// Запоминаем, что все данные обработаны
+					offset = size;
+					// Если размер записи превышает максимально допустимый
+					if(this->_buffer.size() > this->_max){
+						// Выводим накопленную часть записи как отдельную запись
+						this->emit(this->_buffer.data(), this->_buffer.size());
+						// Выполняем очистку буфера
+						this->_buffer.clear();
+					}
+				// Если запись завершается в этой порции данных
+				} else {
+					// Добавляем недостающие данные записи в буфер
+					this->_buffer.insert(this->_buffer.end(), buffer + offset, buffer + offset + bytes);
+					// Смещаемся на количество добавленных байт
+					offset += bytes;
+					// Выполняем извлечение записи из буфера
+					const size_t length = this->frame(this->_buffer.data(), this->_buffer.size());
+					// Удаляем обработанные данные из буфера
+					this->_buffer.erase(this->_buffer.begin(), this->_buffer.begin() + length);
+				}
+			}
+			// Если в порции данных остались необработанные данные
+			if(offset < size){
+				// Выполняем извлечение записей прямо из полученной порции данных
+				offset += this->frame(buffer + offset, size - offset);
+				// Если осталась незавершённая запись
+				if(offset < size)
+					// Сохраняем незавершённую запись в буфер
+					this->_buffer.assign(buffer + offset, buffer + size);
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(size), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+			// Выполняем очистку буфера незавершённой записи
+			this->_buffer.clear();
+		}
+	}
+}
+/**
+ * @brief Метод завершения потока и вывода последней записи
+ *
+ */
+void anyks::Stream::finish() noexcept {
+	// Если в буфере осталась незавершённая запись
+	if(!this->_buffer.empty()){
+		// Выполняем извлечение завершённых записей
+		const size_t offset = this->frame(this->_buffer.data(), this->_buffer.size());
+		// Если в буфере остались данные
+		if(offset < this->_buffer.size()){
+			// Размер записи указанный в заголовке
+			size_t length = 0;
+			// Получаем размер заголовка оставшейся записи
+			size_t bytes = this->header(this->_buffer.data() + offset, this->_buffer.size() - offset, length);
+			// Если заголовок получен не полностью
+			if(bytes == string::npos)
+				// Выводим запись без заголовка
+				bytes = 0;
+			// Выводим оставшуюся запись как есть
+			this->emit(this->_buffer.data() + offset + bytes, this->_buffer.size() - (offset + bytes));
+		}
+		// Выполняем очистку буфера незавершённой записи
+		this->clear();
+	}
+	// Снимаем флаг пропуска переводов строк для следующего потока
+	this->_skip = false;
+}
+/**
+ * @brief Метод установки максимального размера одной записи
+ *
+ * @param size максимальный размер записи
+ */
+void anyks::Stream::max(const size_t size) noexcept {
+	// Устанавливаем максимальный размер записи
+	this->_max = (size > 0 ? size : STREAM_RECORD_SIZE);
+}
+/**
+ * @brief Метод установки режима разделения записей
+ *
+ * @param framing режим разделения записей
+ */
+void anyks::Stream::framing(const framing_t framing) noexcept {
+	// Устанавливаем режим разделения записей
+	this->_framing = framing;
+}
+/**
+ * @brief Метод разрешения вывода пустых записей
+ *
+ * @param mode флаг вывода пустых записей
+ */
+void anyks::Stream::blank(const bool mode) noexcept {
+	// Устанавливаем флаг вывода пустых записей
+	this->_blank = mode;
+}
+/**
+ * @brief Метод установки функции обратного вызова при получении записи
+ *
+ * @param callback функция обратного вызова
+ */
+void anyks::Stream::on(function <void (const char *, const size_t)> callback) noexcept {
+	// Устанавливаем функцию обратного вызова
+	this->_callback = callback;
+}
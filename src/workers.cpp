@@ -0,0 +1,230 @@
+/**
+ * @file: workers.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <workers.hpp>
+
+/**
+ * Подписываемся на пространство имён awh
+ */
+using namespace awh;
+
+/**
+ * @brief Метод обработки очереди задач рабочим потоком
+ *
+ */
+void anyks::Workers::process() noexcept {
+	// Выполняем обработку задач до остановки пула
+	for(;;){
+		// Задача для выполнения
+		function <void (void)> task = nullptr;
+		{
+			// Выполняем блокировку очереди задач
+			unique_lock <std::mutex> lock(this->_mtx);
+			// Ожидаем появления задачи или остановки пула
+			this->_task.wait(lock, [this]() noexcept -> bool {
+				// Выводим результат проверки
+				return (this->_stop || !this->_tasks.empty());
+			});
+			// Если пул остановлен и задач больше нет
+			if(this->_tasks.empty())
+				// Завершаем работу потока
+				return;
+			// Извлекаем задачу из очереди
+			task = std::move(this->_tasks.front());
+			// Удаляем задачу из очереди
+			this->_tasks.pop();
+			// Увеличиваем количество выполняемых задач
+			this->_active++;
+		}
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем задачу
+			task();
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+		{
+			// Выполняем блокировку очереди задач
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Уменьшаем количество выполняемых задач
+			this->_active--;
+			// Если все задачи выполнены
+			if(this->_tasks.empty() && (this->_active == 0))
+				// Сообщаем ожидающим о завершении задач
+				this->_done.notify_all();
+		}
+	}
+}
+/**
+ * @brief Метод получения количества запущенных рабочих потоков
+ *
+ * @return количество рабочих потоков
+ */
+size_t anyks::Workers::count() const noexcept {
+	// Выводим количество рабочих потоков
+	return this->_threads.size();
+}
+/**
+ * @brief Метод запуска рабочих потоков (уже запущенные потоки продолжают работу)
+ *
+ * @param count необходимое количество рабочих потоков
+ */
+void anyks::Workers::start(const size_t count) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Выполняем запуск недостающих рабочих потоков
+		while(this->_threads.size() < count)
+			// Добавляем рабочий поток
+			this->_threads.emplace_back(&Workers::process, this);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(count), log_t::flag_t::WARNING, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::WARNING, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод остановки рабочих потоков после выполнения оставшихся задач
+ *
+ */
+void anyks::Workers::stop() noexcept {
+	{
+		// Выполняем блокировку очереди задач
+		const lock_guard <std::mutex> lock(this->_mtx);
+		// Устанавливаем флаг остановки рабочих потоков
+		this->_stop = true;
+	}
+	// Сообщаем рабочим потокам об остановке
+	this->_task.notify_all();
+	// Выполняем перебор всех рабочих потоков
+	for(auto & thread : this->_threads){
+		// Если поток можно ожидать
+		if(thread.joinable())
+			// Ожидаем завершения потока
+			thread.join();
+	}
+	// Выполняем очистку списка рабочих потоков
+	this->_threads.clear();
+	// Снимаем флаг остановки для повторного запуска
+	this->_stop = false;
+}
+/**
+ * @brief Метод добавления задачи в очередь (без рабочих потоков задача выполняется сразу)
+ *
+ * @param task задача для выполнения
+ */
+void anyks::Workers::push(function <void (void)> task) noexcept {
+	// Если задача передана
+	if(task != nullptr){
+		// Если рабочие потоки запущены
+		if(!this->_threads.empty()){
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				{
+					// Выполняем блокировку очереди задач
+					const lock_guard <std::mutex> lock(this->_mtx);
+					// Добавляем задачу в очередь
+					this->_tasks.push(std::move(task));
+				}
+				// Сообщаем рабочему потоку о новой задаче
+				this->_task.notify_one();
+				// Выходим из функции
+				return;
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const exception & error) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::WARNING, error.what());
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::WARNING, error.what());
+				#endif
+			}
+		}
+		// Выполняем задачу в текущем потоке
+		task();
+	}
+}
+/**
+ * @brief Метод ожидания выполнения всех задач очереди
+ *
+ */
+void anyks::Workers::wait() noexcept {
+	// Выполняем блокировку очереди задач
+	unique_lock <std::mutex> lock(this->_mtx);
+	// Ожидаем выполнения всех задач
+	this->_done.wait(lock, [this]() noexcept -> bool {
+		// Выводим результат проверки
+		return (this->_tasks.empty() && (this->_active == 0));
+	});
+}
+/**
+ * @brief Конструктор
+ *
+ * @param fmk объект фреймворка
+ * @param log объект для работы с логами
+ */
+anyks::Workers::Workers(const fmk_t * fmk, const log_t * log) noexcept :
+ _stop(false), _active(0), _fmk(fmk), _log(log) {}
+/**
+ * @brief Деструктор
+ *
+ */
+anyks::Workers::~Workers() noexcept {
+	// Выполняем остановку рабочих потоков
+	this->stop();
+}
@@ -0,0 +1,191 @@
+/**
+ * @file: bundle.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <fstream>
+
+/**
+ * Подключаем модуль GROK
+ */
+#include <grok.hpp>
+
+/**
+ * Подключаем заголовочные файлы JSON
+ */
+#include <rapidjson/writer.h>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * serialize Функция получения текста объекта JSON
+ * @param data объект JSON
+ * @return     текст объекта JSON
+ */
+static string serialize(const Document & data) noexcept {
+	// Буфер для записи текста
+	StringBuffer buffer;
+	// Объект записи текста
+	Writer <StringBuffer> writer(buffer);
+	// Выполняем запись объекта
+	data.Accept(writer);
+	// Выводим результат
+	return buffer.GetString();
+}
+/**
+ * results Функция получения результатов сопоставления строк набором выражений
+ * @param grok        объект модуля GROK
+ * @param expressions список выражений в порядке перебора
+ * @param lines       список строк для сопоставления
+ * @return            список результатов сопоставления в формате JSON
+ */
+static vector <string> results(grok_t & grok, const vector <string> & expressions, const vector <string> & lines) noexcept {
+	// Результат работы функции
+	vector <string> result;
+	// Выполняем сборку набора выражений
+	const uint64_t mid = grok.build(expressions);
+	// Выполняем перебор всех строк
+	for(auto & line : lines){
+		// Результат сопоставления строки
+		grok_t::mapping_t mapping;
+		// Добавляем результат сопоставления строки
+		result.push_back(grok.find(line, mid, mapping) > 0 ? serialize(grok.dump(mapping)) : "{}");
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * main Главная функция приложения
+ * @param count  длина массива параметров
+ * @param params массив параметров
+ * @return       код выхода из приложения
+ */
+int32_t main(int32_t count, char * params[]) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Отметка исходных шаблонов пакета
+	const uint64_t stamp = 0x1405;
+	// Адрес временного файла пакета
+	const string filename = (count > 1 ? string(params[1]) : string("bundle_test.tmp"));
+	// Список выражений, собираемых в пакет
+	const vector <string> expressions = {
+		"%{SESSION:session} %{WORD:method} %{URIPATHPARAM:request} %{INT:status:int} %{NUMBER:took:float}",
+		"(?<level>[A-Z]+): %{GREEDYDATA:message}",
+		"%{IP:client} %{WORD:method}"
+	};
+	// Список строк для сопоставления
+	const vector <string> lines = {
+		"ab12 GET /index.html?id=1 200 0.25",
+		"zz9 POST /api/v1/items 404 12",
+		"ERROR: disk full",
+		"warning: lower case level",
+		"10.0.0.1 DELETE",
+		"nothing to match here"
+	};
+	// Эталонные результаты сопоставления
+	vector <string> expected;
+	{
+		// Создаём объект модуля GROK, собирающий пакет
+		grok_t grok(&fmk, &log);
+		// Добавляем внешний шаблон
+		grok.pattern("SESSION", "[a-z]{2}\\d+");
+		// Получаем эталонные результаты сопоставления
+		expected = results(grok, expressions, lines);
+		// Если пакет не сохранён
+		if(!grok.savePatterns(filename, stamp)){
+			// Выводим сообщение об ошибке
+			::fprintf(stderr, "Bundle \"%s\" was not saved\n", filename.c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+	}{
+		// Создаём объект модуля GROK, загружающий пакет
+		grok_t grok(&fmk, &log);
+		// Если пакет не загружен
+		if(!grok.loadPatterns(filename, stamp)){
+			// Выводим сообщение об ошибке
+			::fprintf(stderr, "Bundle \"%s\" was not loaded\n", filename.c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+		// Получаем результаты сопоставления по загруженному пакету
+		const vector <string> & result = results(grok, expressions, lines);
+		// Выполняем перебор всех строк
+		for(size_t i = 0; i < lines.size(); i++){
+			// Если результат расходится с эталоном
+			if(result.at(i) != expected.at(i)){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Bundle mismatch: \"%s\" -> %s, expected %s\n", lines.at(i).c_str(), result.at(i).c_str(), expected.at(i).c_str());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}{
+		// Создаём объект модуля GROK
+		grok_t grok(&fmk, &log);
+		// Если пакет загружен для других исходных шаблонов
+		if(grok.loadPatterns(filename, stamp + 1)){
+			// Выводим сообщение об ошибке
+			::fprintf(stderr, "Bundle \"%s\" was loaded with a foreign stamp\n", filename.c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+	}{
+		// Содержимое файла пакета
+		string data = "";
+		{
+			// Открываем файл пакета на чтение
+			std::ifstream file(filename, ios::in | ios::binary);
+			// Читаем содержимое файла пакета
+			data.assign(std::istreambuf_iterator <char> (file), std::istreambuf_iterator <char> ());
+		}{
+			// Открываем файл пакета на запись
+			std::ofstream file(filename, ios::out | ios::binary | ios::trunc);
+			// Записываем усечённый пакет
+			file.write(data.data(), data.size() / 2);
+		}
+		// Создаём объект модуля GROK
+		grok_t grok(&fmk, &log);
+		// Если усечённый пакет загружен
+		if(grok.loadPatterns(filename, stamp)){
+			// Выводим сообщение об ошибке
+			::fprintf(stderr, "Truncated bundle \"%s\" was loaded\n", filename.c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+		// Добавляем внешний шаблон
+		grok.pattern("SESSION", "[a-z]{2}\\d+");
+		// Получаем результаты сопоставления после отказа в загрузке пакета
+		if(results(grok, expressions, lines) != expected){
+			// Выводим сообщение о расхождении
+			::fprintf(stderr, "Module is broken after a rejected bundle\n");
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+	}
+	// Удаляем временный файл
+	::remove(filename.c_str());
+	// Выводим результат проверки
+	::printf("GROK bundle round-trip check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
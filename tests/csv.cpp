@@ -0,0 +1,378 @@
+/**
+ * @file: csv.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <fstream>
+
+/**
+ * Подключаем модуль CSV
+ */
+#include <csv.hpp>
+
+/**
+ * Подключаем заголовочные файлы JSON
+ */
+#include <rapidjson/writer.h>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * Список строк таблицы
+ */
+typedef vector <vector <string>> table_t;
+
+/**
+ * reference Функция эталонного разбора текста по RFC 4180
+ * @param text  текст для разбора
+ * @param delim используемый разделитель ('0' - определяется автоматически для каждой строки)
+ * @return      список разобранных строк
+ */
+static table_t reference(const string & text, const char delim) noexcept {
+	// Результат работы функции
+	table_t result;
+	// Ячейки текущей строки
+	vector <string> row;
+	// Значение текущей ячейки
+	string cell = "";
+	// Разделитель текущей строки
+	char current = delim;
+	// Флаги кавычек, наличия данных и начала ячейки
+	bool quote = false, data = false, begin = true;
+	// Функция проверки символа разделителя
+	auto isDelim = [&current](const char letter) noexcept -> bool {
+		// Если разделитель уже определён
+		if(current != '0')
+			// Выводим результат сравнения
+			return (letter == current);
+		// Выводим результат проверки допустимых разделителей
+		return ((letter == ',') || (letter == ';') || (letter == '|'));
+	};
+	// Функция завершения строки
+	auto end = [&]() noexcept -> void {
+		// Если строка содержит данные
+		if(data){
+			// Добавляем последнюю ячейку
+			row.push_back(cell);
+			// Добавляем строку в результат
+			result.push_back(row);
+		}
+		// Выполняем сброс состояния строки
+		row.clear();
+		cell.clear();
+		data = false;
+		begin = true;
+		current = delim;
+	};
+	// Выполняем перебор всего текста
+	for(size_t i = 0; i < text.size(); i++){
+		// Получаем текущий символ
+		const char letter = text[i];
+		// Если мы находимся внутри кавычек
+		if(quote){
+			// Если найдена кавычка
+			if(letter == '"'){
+				// Если кавычка экранирована второй кавычкой
+				if(((i + 1) < text.size()) && (text[i + 1] == '"')){
+					// Добавляем кавычку в ячейку
+					cell.append(1, '"');
+					// Пропускаем вторую кавычку
+					i++;
+				// Закрываем кавычки
+				} else quote = false;
+			// Добавляем символ в ячейку
+			} else cell.append(1, letter);
+		// Если возврат каретки стоит перед переносом строки или в конце текста
+		} else if((letter == '\r') && (((i + 1) == text.size()) || (text[i + 1] == '\n')))
+			// Пропускаем возврат каретки
+			continue;
+		// Если найден перенос строки
+		else if(letter == '\n')
+			// Завершаем строку
+			end();
+		// Если кавычка открывает ячейку
+		else if((letter == '"') && begin) {
+			// Открываем кавычки
+			quote = true;
+			// Снимаем флаг начала ячейки
+			begin = false;
+			// Отмечаем наличие данных
+			data = true;
+		// Если найден разделитель
+		} else if(isDelim(letter)) {
+			// Если разделитель ещё не определён
+			if(current == '0')
+				// Запоминаем разделитель строки
+				current = letter;
+			// Добавляем ячейку в строку
+			row.push_back(cell);
+			// Очищаем значение ячейки
+			cell.clear();
+			// Отмечаем начало новой ячейки
+			begin = true;
+			// Отмечаем наличие данных
+			data = true;
+		// Если найден обычный символ
+		} else {
+			// Добавляем символ в ячейку
+			cell.append(1, letter);
+			// Снимаем флаг начала ячейки
+			begin = false;
+			// Отмечаем наличие данных
+			data = true;
+		}
+	}
+	// Завершаем последнюю строку
+	end();
+	// Выводим результат
+	return result;
+}
+/**
+ * main Главная функция приложения
+ * @param count  длина массива параметров
+ * @param params массив параметров
+ * @return       код выхода из приложения
+ */
+int32_t main(int32_t count, char * params[]) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Генератор случайных чисел с фиксированным зерном
+	std::mt19937 random(21);
+	// Алфавит для генерации текста
+	const string alphabet = "ab,\"\n\r x;|";
+	// Адрес временного файла для проверки чтения
+	const string filename = (count > 1 ? string(params[1]) : string("csv_test.tmp"));
+	// Выполняем генерацию случайных текстов
+	for(size_t test = 0; test < 20000; test++){
+		// Текст для проверки
+		string text = "";
+		// Получаем длину текста
+		const size_t length = (random() % ((test % 10) == 0 ? 400 : 120));
+		// Выполняем генерацию текста
+		for(size_t i = 0; i < length; i++)
+			// Добавляем в текст случайный символ
+			text.append(1, alphabet[random() % alphabet.size()]);
+		// Получаем используемый разделитель
+		const char delim = ((test % 2) ? ',' : '0');
+		// Получаем эталонный результат разбора
+		const table_t & expected = reference(text, delim);
+		// Если нужно проверить чтение из файла
+		if((test % 20) == 0){
+			// Открываем временный файл на запись
+			std::ofstream file(filename, ios::out | ios::binary | ios::trunc);
+			// Записываем текст в файл
+			file.write(text.data(), text.size());
+		}
+		// Выполняем перебор режимов разбора
+		for(uint8_t mode = 0; mode < 6; mode++){
+			// Если файл для проверки чтения не создан
+			if((mode > 3) && ((test % 20) != 0))
+				// Пропускаем проверку
+				continue;
+			// Полученный результат разбора
+			table_t result;
+			// Создаём объект модуля CSV
+			csv_t csv(&fmk, &log);
+			// Функция сбора разобранных строк
+			auto callback = [&result](const vector <string> & row) noexcept -> void {
+				// Добавляем строку в результат
+				result.push_back(row);
+			};
+			// Если строки хранятся в едином буфере
+			if((mode % 2) != 0)
+				// Устанавливаем режим хранения ячеек
+				csv.storage(csv_t::storage_t::ARENA);
+			// Определяем режим разбора
+			switch(mode){
+				// Потоковый разбор случайными блоками с сохранением в контейнер
+				case 0:
+				case 1:
+				// Потоковый разбор мелкими блоками с функцией обратного вызова
+				case 2:
+				case 3: {
+					// Если разобранные строки выводятся функцией обратного вызова
+					if(mode > 1)
+						// Устанавливаем функцию обратного вызова
+						csv.on(callback);
+					// Выполняем перебор текста случайными блоками
+					for(size_t offset = 0; offset < text.size();){
+						// Получаем размер очередного блока
+						const size_t size = std::min(static_cast <size_t> (1 + random() % (mode > 1 ? 7 : 70)), text.size() - offset);
+						// Выполняем разбор блока
+						csv.feed(text.data() + offset, size, delim);
+						// Смещаемся к следующему блоку
+						offset += size;
+					}
+					// Завершаем потоковый разбор
+					csv.finish();
+				} break;
+				// Чтение файла с сохранением в контейнер
+				case 4:
+					// Выполняем чтение файла
+					csv.read(filename, delim);
+				break;
+				// Чтение файла с функцией обратного вызова
+				case 5:
+					// Выполняем чтение файла
+					csv.read(filename, callback, delim);
+				break;
+			}
+			// Если строки сохранялись в контейнер
+			if((mode == 0) || (mode == 1) || (mode == 4))
+				// Получаем сохранённые строки
+				result = csv.get();
+			// Если результат расходится с эталоном
+			if(result != expected){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Mismatch: test %zu, mode %u, delim '%c', rows %zu, expected %zu\n", test, mode, delim, result.size(), expected.size());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Удаляем временный файл
+	::remove(filename.c_str());
+	// Текст столбца, тип которого определён по выборке, и ожидаемый результат
+	string numbers = "n\n", expected = "{\"n\":[";
+	// Выполняем генерацию значений за пределами выборки
+	for(size_t i = 1; i <= 40; i++){
+		// Добавляем значение в текст
+		numbers.append(std::to_string(i) + "\n");
+		// Добавляем значение в ожидаемый результат
+		expected.append(std::to_string(i) + ",");
+	}
+	// Строка за пределами выборки проверяется по отдельности
+	numbers.append("abc\n");
+	// Завершаем ожидаемый результат
+	expected.append("\"abc\"]}");
+	// Список проверок определения типов: текст, флаг заголовка и ожидаемый результат
+	const vector <std::tuple <string, bool, string>> dumps = {
+		{
+			"id,price,flag,name,mixed,amount,empty\n1,2.5,true,abc,1,10,\n-2,3.25,false,def,2.5,7.5,\n3,-0.5,true,7,x,12,\n", true,
+			"{\"id\":[1,-2,3],\"price\":[2.5,3.25,-0.5],\"flag\":[true,false,true],\"name\":[\"abc\",\"def\",\"7\"],\"mixed\":[\"1\",\"2.5\",\"x\"],\"amount\":[10,7.5,12],\"empty\":[\"\",\"\",\"\"]}"
+		},
+		{"1,a,true\n2,b,false\n-3,4,true\n", false, "[[1,\"a\",true],[2,\"b\",false],[-3,\"4\",true]]"},
+		{numbers, true, expected}
+	};
+	// Выполняем перебор всех проверок
+	for(auto & test : dumps){
+		// Создаём объект модуля CSV
+		csv_t csv(&fmk, &log);
+		// Устанавливаем флаг заголовка
+		csv.header(std::get <1> (test));
+		// Выполняем разбор текста
+		csv.feed(std::get <0> (test).data(), std::get <0> (test).size(), ',');
+		// Завершаем потоковый разбор
+		csv.finish();
+		// Буфер для записи текста
+		StringBuffer buffer;
+		// Объект записи текста
+		Writer <StringBuffer> writer(buffer);
+		// Выполняем запись дампа данных
+		csv.dump().Accept(writer);
+		// Если результат расходится с ожидаемым
+		if(std::get <2> (test).compare(buffer.GetString()) != 0){
+			// Выводим сообщение о расхождении
+			::fprintf(stderr, "Dump mismatch: %s, expected %s\n", buffer.GetString(), std::get <2> (test).c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+	}
+	// Фрагменты текста для проверки параллельного разбора (кавычка не в начале ячейки не открывает значение)
+	const vector <string> pieces = {"abc", "abc\"", "a\"b", ",", ",", "\n", "\r\n", "\"q,\nq\"", "\"x\"\"\ny\"", "\"\n\"\"", "\"\"", "1.5"};
+	// Размер участка текста для параллельного разбора
+	const size_t chunk = 0x400000;
+	// Выполняем генерацию текстов больше нескольких участков параллельного разбора
+	for(size_t test = 0; test < 4; test++){
+		// Текст для проверки
+		string text = "";
+		// Флаг добавления длинного значения в кавычках, пересекающего границы участков
+		bool quoted = (test < 2);
+		// Выполняем генерацию текста
+		while(text.size() < (chunk * 2 + chunk / 2)){
+			// Если нужно добавить длинное значение в кавычках
+			if(!quoted && (text.size() > (chunk / 2))){
+				// Открываем значение в кавычках
+				text.append("\n\"");
+				// Выполняем генерацию значения
+				for(size_t i = 0; i < (chunk + chunk / 2); i++)
+					// Добавляем в значение случайный символ
+					text.append(1, "ab,\n"[random() % 4]);
+				// Закрываем значение в кавычках
+				text.append("\"\n");
+				// Запоминаем, что значение добавлено
+				quoted = true;
+			// Добавляем случайный фрагмент текста
+			} else text.append(pieces[random() % pieces.size()]);
+		}
+		// Если нужно проверить текст, завершающийся внутри незакрытых кавычек
+		if((test % 3) == 2)
+			// Добавляем незакрытую кавычку
+			text.append(",\"tail\n");
+		// Получаем используемый разделитель
+		const char delim = ((test % 2) ? ',' : '0');
+		// Создаём объект модуля CSV для последовательного разбора
+		csv_t serial(&fmk, &log);
+		// Выполняем последовательный разбор текста
+		serial.parse(text, delim);
+		// Получаем результат последовательного разбора
+		const table_t & expected = serial.get();
+		// Выполняем перебор режимов параллельного разбора
+		for(uint8_t mode = 0; mode < 3; mode++){
+			// Полученный результат разбора
+			table_t result;
+			// Создаём объект модуля CSV
+			csv_t csv(&fmk, &log);
+			// Если строки хранятся в едином буфере
+			if(mode == 1)
+				// Устанавливаем режим хранения ячеек
+				csv.storage(csv_t::storage_t::ARENA);
+			// Если строки выводятся функцией обратного вызова
+			if(mode == 2)
+				// Выполняем параллельный разбор проходами по два участка
+				csv.parse(text, [&result](const vector <string> & row) noexcept -> void {
+					// Добавляем строку в результат
+					result.push_back(row);
+				}, delim, 2);
+			// Если строки сохраняются в контейнер
+			else {
+				// Выполняем параллельный разбор текста
+				csv.parse(text, delim, 4);
+				// Получаем сохранённые строки
+				result = csv.get();
+			}
+			// Если результат расходится с последовательным разбором
+			if(result != expected){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Parallel mismatch: test %zu, mode %u, delim '%c', rows %zu, expected %zu\n", test, mode, delim, result.size(), expected.size());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Выводим результат проверки
+	::printf("CSV split-feed check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
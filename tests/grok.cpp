@@ -0,0 +1,119 @@
+/**
+ * @file: grok.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <tuple>
+
+/**
+ * Подключаем модуль GROK
+ */
+#include <grok.hpp>
+
+/**
+ * Подключаем заголовочные файлы JSON
+ */
+#include <rapidjson/writer.h>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * serialize Функция получения текста объекта JSON
+ * @param data объект JSON
+ * @return     текст объекта JSON
+ */
+static string serialize(const Document & data) noexcept {
+	// Буфер для записи текста
+	StringBuffer buffer;
+	// Объект записи текста
+	Writer <StringBuffer> writer(buffer);
+	// Выполняем запись объекта
+	data.Accept(writer);
+	// Выводим результат
+	return buffer.GetString();
+}
+/**
+ * main Главная функция приложения
+ * @return код выхода из приложения
+ */
+int32_t main() noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Создаём объект модуля GROK
+	grok_t grok(&fmk, &log);
+	// Список проверок: тип переменной, захваченное значение и ожидаемое значение JSON
+	const vector <std::tuple <string, string, string>> tests = {
+		{"int", "42", "42"},
+		{"int", "-7", "-7"},
+		{"int", "+15", "15"},
+		{"int", "9223372036854775807", "9223372036854775807"},
+		{"int", "9223372036854775808", "\"9223372036854775808\""},
+		{"int", "12.5", "\"12.5\""},
+		{"int", "1e3", "\"1e3\""},
+		{"int", "+-5", "\"+-5\""},
+		{"int", "abc", "\"abc\""},
+		{"float", "0.25", "0.25"},
+		{"float", "-1.5e3", "-1500.0"},
+		{"float", "+2.5", "2.5"},
+		{"float", ".5", "0.5"},
+		{"float", "12", "12.0"},
+		{"float", "0x10", "\"0x10\""},
+		{"float", "inf", "\"inf\""},
+		{"float", "nan", "\"nan\""},
+		{"float", "1e999", "\"1e999\""},
+		{"float", "1.5kb", "\"1.5kb\""},
+		{"float", "-", "\"-\""},
+		{"bool", "true", "true"},
+		{"bool", "Yes", "true"},
+		{"bool", "OFF", "false"},
+		{"bool", "0", "false"},
+		{"bool", "maybe", "\"maybe\""},
+		{"ts", "1740268539", "1740268539"},
+		{"ts", "1740268539.834", "1740268539.834"},
+		{"ts", "2025-02-23T02:55:39", "\"2025-02-23T02:55:39\""},
+		{"unknown", "42", "\"42\""}
+	};
+	// Выполняем перебор всех проверок
+	for(auto & test : tests){
+		// Формируем выражение с типизированной переменной
+		string express = ("value=%{NOTSPACE:value:" + std::get <0> (test) + "}");
+		// Формируем строку для сопоставления
+		const string line = ("value=" + std::get <1> (test));
+		// Результат сопоставления
+		grok_t::mapping_t mapping;
+		// Ожидаемый результат сопоставления
+		const string expected = ("{\"value\":" + std::get <2> (test) + "}");
+		// Получаем результат сопоставления
+		const string result = (grok.parse(line, grok.build(express), mapping) ? serialize(grok.dump(mapping)) : "{}");
+		// Если результат расходится с ожидаемым
+		if(result != expected){
+			// Выводим сообщение о расхождении
+			::fprintf(stderr, "Typed capture mismatch: %s as %s -> %s, expected %s\n", std::get <1> (test).c_str(), std::get <0> (test).c_str(), result.c_str(), expected.c_str());
+			// Увеличиваем количество расхождений
+			failures++;
+		}
+	}
+	// Выводим результат проверки
+	::printf("GROK typed captures check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
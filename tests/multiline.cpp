@@ -0,0 +1,158 @@
+/**
+ * @file: multiline.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <random>
+
+/**
+ * Подключаем модуль сборки многострочных событий
+ */
+#include <multiline.hpp>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * reference Функция эталонной сборки событий
+ * @param lines  список строк потока
+ * @param indent правило отступов (иначе событие начинает строка с префиксом "E")
+ * @param limit  максимальное количество строк события
+ * @return       список собранных событий
+ */
+static vector <string> reference(const vector <string> & lines, const bool indent, const size_t limit) noexcept {
+	// Результат работы функции
+	vector <string> result;
+	// Строки текущего события
+	vector <string> event;
+	// Функция вывода текущего события
+	auto emit = [&]() noexcept -> void {
+		// Удаляем пустые строки в конце события
+		while(!event.empty() && event.back().empty())
+			// Удаляем завершающую пустую строку
+			event.pop_back();
+		// Если событие содержит строки
+		if(!event.empty()){
+			// Текст события
+			string text = event.front();
+			// Переходим по остальным строкам события
+			for(size_t i = 1; i < event.size(); i++)
+				// Добавляем строку через перевод строки
+				text.append("\n" + event.at(i));
+			// Добавляем событие в результат
+			result.push_back(text);
+		}
+		// Очищаем строки события
+		event.clear();
+	};
+	// Переходим по всем строкам потока
+	for(auto & line : lines){
+		// Если получена пустая строка
+		if(line.empty()){
+			// Если событие накапливается
+			if(!event.empty()){
+				// Если используется правило отступов
+				if(indent)
+					// Пустая строка завершает событие
+					emit();
+				// Пустая строка продолжает событие
+				else event.push_back(line);
+			}
+		// Если строка начинает новое событие
+		} else if(indent ? ((line.front() != ' ') && (line.front() != '\t')) : (line.front() == 'E')) {
+			// Выводим накопленное событие
+			emit();
+			// Начинаем новое событие
+			event.push_back(line);
+		// Строка продолжает событие
+		} else event.push_back(line);
+		// Если событие достигло максимального количества строк
+		if(event.size() >= limit)
+			// Выводим накопленное событие
+			emit();
+	}
+	// Выводим последнее событие
+	emit();
+	// Выводим результат
+	return result;
+}
+/**
+ * main Главная функция приложения
+ * @return код выхода из приложения
+ */
+int32_t main() noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Генератор случайных чисел с фиксированным зерном
+	std::mt19937 random(20);
+	// Варианты строк потока
+	const vector <string> variants = {"E1 start", "E2 other", "  at frame", "\tcaused by", "plain text", ""};
+	// Выполняем генерацию случайных потоков
+	for(size_t test = 0; test < 5000; test++){
+		// Список строк потока
+		vector <string> lines;
+		// Получаем количество строк потока
+		const size_t count = (random() % 30);
+		// Выполняем генерацию строк
+		for(size_t i = 0; i < count; i++)
+			// Добавляем случайную строку
+			lines.push_back(variants.at(random() % variants.size()));
+		// Получаем максимальное количество строк события
+		const size_t limit = (2 + random() % 10);
+		// Выполняем перебор правил начала события
+		for(uint8_t mode = 0; mode < 2; mode++){
+			// Полученный список событий
+			vector <string> result;
+			// Создаём объект сборки событий
+			multiline_t joiner(&fmk, &log);
+			// Устанавливаем ограничение количества строк события
+			joiner.max(limit, 0);
+			// Если используется правило отступов
+			if(mode == 0)
+				// Устанавливаем правило отступов
+				joiner.indent();
+			// Устанавливаем регулярное выражение начала события
+			else joiner.pattern("^E\\d+");
+			// Устанавливаем функцию сбора событий
+			joiner.on([&result](const char * buffer, const size_t size) noexcept -> void {
+				// Добавляем событие в результат
+				result.emplace_back(buffer, size);
+			});
+			// Переходим по всем строкам потока
+			for(auto & line : lines)
+				// Передаём строку
+				joiner.push(line.data(), line.size());
+			// Завершаем поток
+			joiner.finish();
+			// Если результат расходится с эталоном
+			if(result != reference(lines, (mode == 0), limit)){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Mismatch: test %zu, mode %u, events %zu\n", test, mode, result.size());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Выводим результат проверки
+	::printf("Multiline join check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
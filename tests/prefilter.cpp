@@ -0,0 +1,183 @@
+/**
+ * @file: prefilter.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <random>
+
+/**
+ * Подключаем модули GROK и предварительного отбора
+ */
+#include <grok.hpp>
+#include <prefilter.hpp>
+
+/**
+ * Подключаем заголовочные файлы JSON
+ */
+#include <rapidjson/writer.h>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * lower Функция приведения текста к нижнему регистру ASCII
+ * @param text текст для приведения
+ * @return     текст в нижнем регистре
+ */
+static string lower(string text) noexcept {
+	// Переходим по всем символам текста
+	for(auto & letter : text)
+		// Приводим символ к нижнему регистру
+		letter = static_cast <char> (::tolower(static_cast <uint8_t> (letter)));
+	// Выводим результат
+	return text;
+}
+/**
+ * serialize Функция получения текста объекта JSON
+ * @param data объект JSON
+ * @return     текст объекта JSON
+ */
+static string serialize(const Document & data) noexcept {
+	// Буфер для записи текста
+	StringBuffer buffer;
+	// Объект записи текста
+	Writer <StringBuffer> writer(buffer);
+	// Выполняем запись объекта
+	data.Accept(writer);
+	// Выводим результат
+	return buffer.GetString();
+}
+/**
+ * main Главная функция приложения
+ * @return код выхода из приложения
+ */
+int32_t main() noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Генератор случайных чисел с фиксированным зерном
+	std::mt19937 random(12);
+	// Алфавит для генерации литералов и текстов
+	const string alphabet = "abAB.";
+	// Выполняем проверку поиска литералов с эталонным поиском подстроки
+	for(size_t test = 0; test < 2000; test++){
+		// Создаём объект предварительного отбора
+		prefilter_t prefilter(&log);
+		// Список добавленных литералов
+		vector <string> literals;
+		// Идентификаторы добавленных литералов
+		vector <uint32_t> ids;
+		// Получаем количество литералов
+		const size_t count = (1 + random() % 8);
+		// Выполняем генерацию литералов
+		for(size_t i = 0; i < count; i++){
+			// Литерал для поиска
+			string literal = "";
+			// Получаем длину литерала
+			const size_t length = (1 + random() % 4);
+			// Выполняем генерацию литерала
+			for(size_t j = 0; j < length; j++)
+				// Добавляем в литерал случайный символ
+				literal.append(1, alphabet[random() % alphabet.size()]);
+			// Добавляем литерал для поиска
+			ids.push_back(prefilter.add(literal));
+			// Запоминаем литерал
+			literals.push_back(literal);
+		}
+		// Выполняем построение автомата
+		prefilter.compile();
+		// Текст для поиска
+		string text = "";
+		// Получаем длину текста
+		const size_t length = (random() % 40);
+		// Выполняем генерацию текста
+		for(size_t i = 0; i < length; i++)
+			// Добавляем в текст случайный символ
+			text.append(1, alphabet[random() % alphabet.size()]);
+		// Список отметок найденных литералов
+		vector <uint32_t> marks;
+		// Выполняем поиск литералов
+		prefilter.scan(text, marks, 1);
+		// Выполняем перебор всех литералов
+		for(size_t i = 0; i < literals.size(); i++){
+			// Получаем эталонный результат поиска без учёта регистра
+			const bool expected = (lower(text).find(lower(literals.at(i))) != string::npos);
+			// Получаем результат поиска автоматом
+			const bool found = ((ids.at(i) < marks.size()) && (marks.at(ids.at(i)) == 1));
+			// Если результат расходится с эталоном
+			if(found != expected){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Prefilter mismatch: test %zu, literal \"%s\", text \"%s\"\n", test, literals.at(i).c_str(), text.c_str());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Список альтернативных выражений в порядке перебора
+	const vector <string> expressions = {
+		"%{WORD:method} /login user=%{WORD:user}",
+		"%{WORD:method} /api/%{WORD:version}/%{WORD:entity}",
+		"ERROR %{GREEDYDATA:message}",
+		"%{WORD:method} %{URIPATHPARAM:request}"
+	};
+	// Фрагменты для генерации строк журнала
+	const vector <string> methods = {"GET", "POST", "get", "ERROR"};
+	const vector <string> paths = {"/login user=admin", "/LOGIN user=root", "/api/v1/items", "/api/v2", "/index.html", " disk full", "/login"};
+	// Создаём объект модуля GROK
+	grok_t grok(&fmk, &log);
+	// Выполняем сборку набора выражений
+	const uint64_t mid = grok.build(expressions);
+	// Выполняем перебор всех сочетаний фрагментов строк
+	for(auto & method : methods){
+		for(auto & path : paths){
+			// Формируем строку журнала
+			const string line = (method + (path.front() == '/' ? " " : "") + path);
+			// Результат сопоставления набора выражений
+			grok_t::mapping_t mapping;
+			// Ожидаемый результат первого совпавшего выражения
+			string expected = "{}";
+			// Выполняем перебор выражений по отдельности в порядке набора
+			for(auto & express : expressions){
+				// Результат сопоставления отдельного выражения
+				grok_t::mapping_t single;
+				// Если выражение совпало
+				if(grok.find(line, grok.build(vector <string> {express}), single) > 0){
+					// Запоминаем результат первого совпавшего выражения
+					expected = serialize(grok.dump(single));
+					// Выходим из цикла
+					break;
+				}
+			}
+			// Получаем результат сопоставления набора с предварительным отбором
+			const string result = (grok.find(line, mid, mapping) > 0 ? serialize(grok.dump(mapping)) : "{}");
+			// Если результат расходится с перебором выражений
+			if(result != expected){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Expression set mismatch: \"%s\" -> %s, expected %s\n", line.c_str(), result.c_str(), expected.c_str());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Выводим результат проверки
+	::printf("Prefilter check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
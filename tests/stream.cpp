@@ -0,0 +1,137 @@
+/**
+ * @file: stream.cpp
+ * @date: 2026-10-18
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем зависимые заголовки
+ */
+#include <cstdio>
+#include <random>
+
+/**
+ * Подключаем модуль разбора потока
+ */
+#include <stream.hpp>
+
+/**
+ * Подписываемся на пространство имён anyks
+ */
+using namespace anyks;
+
+/**
+ * main Главная функция приложения
+ * @return код выхода из приложения
+ */
+int32_t main() noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Количество найденных расхождений
+	size_t failures = 0;
+	// Генератор случайных чисел с фиксированным зерном
+	std::mt19937 random(1);
+	// Выполняем генерацию случайных потоков
+	for(size_t test = 0; test < 5000; test++){
+		// Текст потока
+		string text = "";
+		// Ожидаемый список записей
+		vector <string> expected;
+		// Флаг предыдущей записи с префиксом длины (после неё переводы строк пропускаются)
+		bool counted = false;
+		// Получаем количество записей потока
+		const size_t count = (1 + random() % 12);
+		// Выполняем генерацию записей
+		for(size_t i = 0; i < count; i++){
+			// Значение записи
+			string record = "";
+			// Получаем длину записи
+			const size_t length = (1 + random() % 20);
+			// Определяем тип записи
+			switch(random() % 3){
+				// Запись с префиксом длины (RFC 6587), может содержать переводы строк
+				case 0: {
+					// Выполняем генерацию записи
+					for(size_t j = 0; j < length; j++)
+						// Добавляем в запись случайный символ
+						record.append(1, "ab \n"[random() % 4]);
+					// Добавляем запись с префиксом длины
+					text.append(std::to_string(record.size()) + " " + record);
+					// Добавляем завершающий перевод строки, который добавляют некоторые отправители
+					text.append((random() % 2) ? "\r\n" : "\n");
+					// Отмечаем запись с префиксом длины
+					counted = true;
+				} break;
+				// Запись разделённая переводом строки
+				case 1: {
+					// Выполняем генерацию записи
+					for(size_t j = 0; j < length; j++)
+						// Добавляем в запись случайный символ
+						record.append(1, "ab "[random() % 3]);
+					// Добавляем запись с переводом строки
+					text.append(record + "\n");
+					// Снимаем флаг записи с префиксом длины
+					counted = false;
+				} break;
+				// Пустая строка
+				case 2: {
+					// Добавляем пустую строку
+					text.append("\n");
+					// Если пустая строка не относится к записи с префиксом длины
+					if(counted)
+						// Пропускаем проверку пустой записи
+						continue;
+				} break;
+			}
+			// Добавляем ожидаемую запись
+			expected.push_back(record);
+		}
+		// Выполняем перебор режимов разбиения потока
+		for(uint8_t mode = 0; mode < 3; mode++){
+			// Полученный список записей
+			vector <string> result;
+			// Создаём объект разбора потока
+			stream_t reader(&fmk, &log);
+			// Разрешаем вывод пустых записей
+			reader.blank(true);
+			// Разрешаем автоматическое определение префикса длины
+			reader.framing(stream_t::framing_t::AUTO);
+			// Устанавливаем функцию сбора записей
+			reader.on([&result](const char * buffer, const size_t size) noexcept -> void {
+				// Добавляем запись в результат
+				result.emplace_back(buffer, size);
+			});
+			// Выполняем перебор потока порциями
+			for(size_t offset = 0; offset < text.size();){
+				// Получаем размер порции (весь поток, по одному байту или случайными порциями)
+				const size_t size = (mode == 0 ? text.size() : (mode == 1 ? 1 : std::min(static_cast <size_t> (1 + random() % 16), text.size() - offset)));
+				// Передаём порцию данных
+				reader.push(text.data() + offset, size);
+				// Смещаемся к следующей порции
+				offset += size;
+			}
+			// Завершаем поток
+			reader.finish();
+			// Если результат расходится с ожидаемым
+			if(result != expected){
+				// Выводим сообщение о расхождении
+				::fprintf(stderr, "Mismatch: test %zu, mode %u, records %zu, expected %zu\n", test, mode, result.size(), expected.size());
+				// Увеличиваем количество расхождений
+				failures++;
+			}
+		}
+	}
+	// Выводим результат проверки
+	::printf("Stream framing check: %zu failures\n", failures);
+	// Выводим код выхода
+	return (failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}